@@ -21,9 +21,12 @@
 #define COMMON_H
 
 #include <bftypes.h>
+#include <bfsupport.h>
 #include <bferrorcodes.h>
 #include <bfelf_loader.h>
 #include <bfdebugringinterface.h>
+#include <bftraceringinterface.h>
+#include <bfstatusinterface.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -134,6 +137,59 @@ common_start_vmm(void);
 int64_t
 common_stop_vmm(void);
 
+/**
+ * Suspend VMM
+ *
+ * Suspends the VMM on each CPU that it is running on, before the system
+ * is suspended. Unlike common_stop_vmm(), only VMX operation is disabled,
+ * and the vCPUs, and the rest of the VMM's memory, are kept, which means
+ * common_resume_vmm() does not have to create them again. The state of the
+ * VMM remains VMM_RUNNING while it is suspended. If the VMM cannot be
+ * suspended, the VMM is corrupt.
+ *
+ * @return BF_SUCCESS on success, negative error code on failure
+ */
+int64_t
+common_suspend_vmm(void);
+
+/**
+ * Resume VMM
+ *
+ * Resumes the VMM on each CPU that it was suspended on, after the system
+ * is resumed. If the VMM cannot be resumed on a CPU, the VMM is stopped.
+ *
+ * @return BF_SUCCESS on success, negative error code on failure
+ */
+int64_t
+common_resume_vmm(void);
+
+/**
+ * Start CPU
+ *
+ * Starts the VMM on a CPU that came online after the VMM was started (i.e.
+ * CPU hotplug). This must be called on the CPU that is being started, and
+ * does nothing unless the VMM is running.
+ *
+ * @param cpuid the CPU to start the VMM on (i.e. the current CPU)
+ * @return BF_SUCCESS on success, negative error code on failure
+ */
+int64_t
+common_start_cpu(int64_t cpuid);
+
+/**
+ * Stop CPU
+ *
+ * Stops the VMM on a CPU that is about to go offline (i.e. CPU hotplug).
+ * This must be called on the CPU that is being stopped, and does nothing
+ * unless the VMM is running. If the VMM cannot be stopped, the VMM is
+ * corrupt.
+ *
+ * @param cpuid the CPU to stop the VMM on (i.e. the current CPU)
+ * @return BF_SUCCESS on success, negative error code on failure
+ */
+int64_t
+common_stop_cpu(int64_t cpuid);
+
 /**
  * Dump VMM
  *
@@ -149,6 +205,77 @@ common_stop_vmm(void);
 int64_t
 common_dump_vmm(struct debug_ring_resources_t **drr, uint64_t vcpuid);
 
+/**
+ * Dump Trace
+ *
+ * This grabs a CPU's trace ring, which contains binary trace records that
+ * need to be decoded by the user (i.e. bfm). Note that the VMM must at least
+ * be loaded for this function to work as it has to do a symbol lookup
+ *
+ * @param trr a pointer to the trr provided by the user
+ * @param cpuid indicates which trr to get as each cpu has its own trr
+ * @return BF_SUCCESS on success, negative error code on failure
+ */
+int64_t
+common_dump_trace(struct trace_ring_resources_t **trr, uint64_t cpuid);
+
+/**
+ * Set Debug Level
+ *
+ * Changes the debug level of one of the VMM's subsystems at runtime. Note
+ * that the VMM must at least be loaded for this function to work as it has
+ * to do a symbol lookup
+ *
+ * @param subsystem the subsystem to change (BFDEBUG_SUBSYSTEM_xxx), or
+ *     BFDEBUG_SUBSYSTEM_ALL to change every subsystem
+ * @param level the new debug level
+ * @return BF_SUCCESS on success, negative error code on failure
+ */
+int64_t
+common_set_debug_level(uint64_t subsystem, int64_t level);
+
+/**
+ * Set Debug Ring Size
+ *
+ * Sets the size of the VMM's debug rings. The size is given to the VMM when
+ * it is loaded, which means the VMM must be unloaded for this function to
+ * work. The size is reset to DEBUG_RING_SIZE when the VMM is unloaded.
+ *
+ * @param size the size of each debug ring's buffer. Must be a power of 2
+ *     between DEBUG_RING_MIN_SIZE and DEBUG_RING_MAX_SIZE
+ * @return BF_SUCCESS on success, negative error code on failure
+ */
+int64_t
+common_set_debug_ring_size(uint64_t size);
+
+/**
+ * Get TSC Info
+ *
+ * Returns the TSC frequency, and the wall-clock anchor that were given to
+ * the VMM when it was loaded. This is what is needed to convert the TSC
+ * stamps in the debug rings into wall-clock times. Note that the VMM must
+ * at least be loaded for this function to work.
+ *
+ * @param info where to store the TSC info
+ * @return BF_SUCCESS on success, negative error code on failure
+ */
+int64_t
+common_get_tsc_info(struct tsc_info_t *info);
+
+/**
+ * Get Status
+ *
+ * Returns the driver's status page (see vmm_status_t), which can be mapped
+ * read-only into user space so that the state of the VMM can be polled
+ * without an ioctl. The status page exists from common_init() until
+ * common_fini(), regardless of the state of the VMM.
+ *
+ * @param status where to store the address of the status page
+ * @return BF_SUCCESS on success, negative error code on failure
+ */
+int64_t
+common_get_status(struct vmm_status_t **status);
+
 #ifdef __cplusplus
 }
 #endif
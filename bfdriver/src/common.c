@@ -38,7 +38,16 @@ _start_t _start_func = 0;
 struct crt_info_t g_info;
 struct bfelf_loader_t g_loader;
 
-int64_t g_num_cpus_started = 0;
+/*
+ * If the VMM was added as a bundle (see bfelf_bundle_create()), the bundle
+ * is the only module, and it has already been relocated, which means that
+ * loading the VMM is a single copy, followed by the bundle's fixups. In
+ * this case, the bundle's image is stored in g_modules[0].exec, and the
+ * bundle's segments are used instead of the module's load instructions.
+ */
+
+const struct bfelf_bundle_header *g_bundle = 0;
+
 int64_t g_vmm_status = VMM_UNLOADED;
 
 void *g_tls = 0;
@@ -48,6 +57,43 @@ uint64_t g_tls_size = 0;
 uint64_t g_stack_size = 0;
 uint64_t g_stack_top = 0;
 
+uint64_t g_debug_ring_size = DEBUG_RING_SIZE;
+
+/*
+ * The status page (see vmm_status_t) is allocated when the driver is
+ * initialized, and is only freed when the driver is finalized, so that user
+ * space can map it regardless of the state of the VMM. g_memory is the
+ * number of bytes of memory that have been given to the VMM.
+ */
+
+struct vmm_status_t *g_status = 0;
+uint64_t g_memory = 0;
+
+/*
+ * The state of each CPU. ret is the result of the last request that was
+ * made on the CPU (by platform_call_on_each_cpu()), and started is set
+ * while the VMM is running on the CPU. This is what allows the CPUs to be
+ * started and stopped without the ioctl thread being migrated to each CPU.
+ * suspended is set while the VMM is suspended on the CPU (see
+ * common_suspend_vmm()), in which case the CPU is not started, but its vCPU
+ * still exists.
+ *
+ * Each CPU also has its own stack, and its own copy of the crt info (which
+ * is where the arguments of a request are stored), so that the VMM can be
+ * entered from more than one CPU at the same time.
+ */
+
+struct cpu_state_t {
+    int64_t ret;
+    int64_t started;
+    int64_t suspended;
+
+    struct crt_info_t info;
+};
+
+int64_t g_num_cpus = 0;
+struct cpu_state_t *g_cpus = 0;
+
 /* -------------------------------------------------------------------------- */
 /* Helpers                                                                    */
 /* -------------------------------------------------------------------------- */
@@ -55,7 +101,15 @@ uint64_t g_stack_top = 0;
 int64_t
 private_setup_stack(void)
 {
-    g_stack_size = STACK_SIZE * 2;
+    /*
+     * Each CPU has its own stack, directly below the stack of the previous
+     * CPU (see private_stack_top()). The thread context sits at the top of
+     * each stack, and is found by aligning the stack pointer to STACK_SIZE,
+     * which is why the stacks must be aligned. The extra stack is what
+     * allows the stacks to be aligned.
+     */
+
+    g_stack_size = STACK_SIZE * ((uint64_t)platform_num_cpus() + 1);
 
     g_stack = platform_alloc_rw(g_stack_size);
     if (g_stack == 0) {
@@ -69,6 +123,10 @@ private_setup_stack(void)
     return BF_SUCCESS;
 }
 
+uint64_t
+private_stack_top(int64_t cpuid)
+{ return g_stack_top - (STACK_SIZE * (uint64_t)cpuid); }
+
 int64_t
 private_setup_tls(void)
 {
@@ -83,10 +141,103 @@ private_setup_tls(void)
     return BF_SUCCESS;
 }
 
+int64_t
+private_setup_cpus(void)
+{
+    g_num_cpus = platform_num_cpus();
+
+    g_cpus = (struct cpu_state_t *)platform_alloc_rw(sizeof(struct cpu_state_t) * (uint64_t)g_num_cpus);
+    if (g_cpus == 0) {
+        return BF_ERROR_OUT_OF_MEMORY;
+    }
+
+    platform_memset(g_cpus, 0, sizeof(struct cpu_state_t) * (uint64_t)g_num_cpus);
+    return BF_SUCCESS;
+}
+
 int64_t
 private_setup_info(void)
 {
-    return platform_populate_info(&g_info.platform_info);
+    int64_t ret = platform_populate_info(&g_info.platform_info);
+    if (ret != BF_SUCCESS) {
+        return ret;
+    }
+
+    g_info.platform_info.debug_ring_size = g_debug_ring_size;
+    g_info.platform_info.status = (uintptr_t)g_status;
+
+    if (g_status != 0) {
+        platform_memset(g_status->exits, 0, sizeof(g_status->exits));
+    }
+
+    return BF_SUCCESS;
+}
+
+void
+private_update_status(void)
+{
+    int64_t cpuid = 0;
+    uint64_t num_cpus_started = 0;
+
+    if (g_status == 0) {
+        return;
+    }
+
+    for (cpuid = 0; cpuid < g_num_cpus; cpuid++) {
+        if (g_cpus[cpuid].started != 0) {
+            num_cpus_started++;
+        }
+    }
+
+    vmm_status_write_begin(g_status);
+
+    g_status->state = g_vmm_status;
+    g_status->num_cpus = (uint64_t)g_num_cpus;
+    g_status->num_cpus_started = num_cpus_started;
+    g_status->memory = g_memory;
+
+    vmm_status_write_end(g_status);
+}
+
+void
+private_set_vmm_status(int64_t status)
+{
+    g_vmm_status = status;
+    private_update_status();
+}
+
+void
+private_setup_status(void)
+{
+    if (g_status != 0) {
+        return;
+    }
+
+    g_status = (struct vmm_status_t *)platform_alloc_rw(VMM_STATUS_SIZE);
+    if (g_status == 0) {
+        BFALERT("failed to allocate the status page\n");
+        return;
+    }
+
+    platform_memset(g_status, 0, VMM_STATUS_SIZE);
+
+    g_status->tag1 = VMM_STATUS_TAG1;
+    g_status->version = VMM_STATUS_VERSION;
+    g_status->tag2 = VMM_STATUS_TAG2;
+
+    private_update_status();
+}
+
+int64_t
+private_setup_cpu_info(void)
+{
+    int64_t cpuid = 0;
+
+    for (cpuid = 0; cpuid < g_num_cpus; cpuid++) {
+        platform_memcpy(&g_cpus[cpuid].info, &g_info, sizeof(struct crt_info_t));
+    }
+
+    return BF_SUCCESS;
 }
 
 int64_t
@@ -95,19 +246,28 @@ private_call_vmm(uintptr_t request, uintptr_t arg1, uintptr_t arg2, uintptr_t ar
     int64_t ret = 0;
     int64_t cpuid = 0;
     int64_t ignored_ret = 0;
-    struct thread_context_t *tc = (struct thread_context_t *)(g_stack_top - sizeof(struct thread_context_t));
-
-    ignored_ret = bfelf_set_integer_args(&g_info, request, arg1, arg2, arg3);
-    bfignored(ignored_ret);
+    struct cpu_state_t *cpu = 0;
+    struct thread_context_t *tc = 0;
 
     cpuid = platform_get_current_cpu_num();
 
+    if (cpuid < 0 || cpuid >= g_num_cpus) {
+        platform_restore_preemption();
+        return BF_ERROR_UNKNOWN;
+    }
+
+    cpu = &g_cpus[cpuid];
+    tc = (struct thread_context_t *)(private_stack_top(cpuid) - sizeof(struct thread_context_t));
+
+    ignored_ret = bfelf_set_integer_args(&cpu->info, request, arg1, arg2, arg3);
+    bfignored(ignored_ret);
+
     tc->cpuid = (uint64_t)cpuid;
     tc->tlsptr = (uint64_t)g_tls + (THREAD_LOCAL_STORAGE_SIZE * (uint64_t)cpuid);
 
-    ret = _start_func((void *)(g_stack_top - sizeof(struct thread_context_t) - 1), &g_info);
+    ret = _start_func((void *)(private_stack_top(cpuid) - sizeof(struct thread_context_t) - 1), &cpu->info);
 
-    ignored_ret = bfelf_set_integer_args(&g_info, 0, 0, 0, 0);
+    ignored_ret = bfelf_set_integer_args(&cpu->info, 0, 0, 0, 0);
     bfignored(ignored_ret);
 
     platform_restore_preemption();
@@ -115,21 +275,74 @@ private_call_vmm(uintptr_t request, uintptr_t arg1, uintptr_t arg2, uintptr_t ar
 }
 
 int64_t
-private_add_raw_md_to_memory_manager(uint64_t virt, uint64_t type)
+private_add_extent_md_to_memory_manager(struct memory_descriptor *md, uint64_t size)
+{
+    int64_t ret = private_call_vmm(BF_REQUEST_ADD_MDL, (uintptr_t)md, (uintptr_t)size, 0);
+    if (ret != MEMORY_MANAGER_SUCCESS) {
+        return ret;
+    }
+
+    g_memory += size;
+    return BF_SUCCESS;
+}
+
+/*
+ * Memory is given to the VMM as extents (i.e. runs of pages that are
+ * physically contiguous), instead of one page at a time. How many extents
+ * a block of memory has depends on the platform's allocator (see
+ * platform_alloc_rw() and platform_alloc_rwe()), so each page is still
+ * translated, and a new extent is started whenever the physical address of
+ * a page does not follow the previous page.
+ */
+
+int64_t
+private_add_raw_md_to_memory_manager(uint64_t virt, uint64_t size, uint64_t type)
 {
     int64_t ret = 0;
+    uint64_t offset = 0;
     struct memory_descriptor md = {0, 0, 0};
 
-    md.virt = virt;
-    md.phys = (uint64_t)platform_virt_to_phys((void *)md.virt);
-    md.type = type;
+    if (size == 0) {
+        return BF_SUCCESS;
+    }
 
-    ret = private_call_vmm(BF_REQUEST_ADD_MDL, (uintptr_t)&md, 0, 0);
-    if (ret != MEMORY_MANAGER_SUCCESS) {
-        return ret;
+    for (offset = 0; offset < size; offset += MAX_PAGE_SIZE) {
+        uint64_t phys = (uint64_t)platform_virt_to_phys((void *)(virt + offset));
+
+        if (offset != 0 && md.phys + (virt + offset - md.virt) == phys) {
+            continue;
+        }
+
+        if (offset != 0) {
+            ret = private_add_extent_md_to_memory_manager(&md, virt + offset - md.virt);
+            if (ret != BF_SUCCESS) {
+                return ret;
+            }
+        }
+
+        md.virt = virt + offset;
+        md.phys = phys;
+        md.type = type;
     }
 
-    return BF_SUCCESS;
+    return private_add_extent_md_to_memory_manager(&md, virt + offset - md.virt);
+}
+
+int64_t
+private_add_segment_md_to_memory_manager(uint64_t exec_s, uint64_t size, uint64_t perm)
+{
+    uint64_t exec_e = exec_s + size;
+
+    exec_s &= ~(MAX_PAGE_SIZE - 1);
+    exec_e &= ~(MAX_PAGE_SIZE - 1);
+
+    if ((perm & bfpf_x) != 0) {
+        return private_add_raw_md_to_memory_manager(
+                   exec_s, exec_e - exec_s + MAX_PAGE_SIZE, MEMORY_TYPE_R | MEMORY_TYPE_E);
+    }
+
+    return private_add_raw_md_to_memory_manager(
+               exec_s, exec_e - exec_s + MAX_PAGE_SIZE, MEMORY_TYPE_R | MEMORY_TYPE_W);
 }
 
 int64_t
@@ -140,30 +353,15 @@ private_add_md_to_memory_manager(struct bfelf_binary_t *module)
     for (s = 0; s < bfelf_file_get_num_load_instrs(&module->ef); s++) {
 
         int64_t ret = 0;
-
-        uint64_t exec_s = 0;
-        uint64_t exec_e = 0;
         const struct bfelf_load_instr *instr = 0;
 
         ret = bfelf_file_get_load_instr(&module->ef, s, &instr);
         bfignored(ret);
 
-        exec_s = (uint64_t)module->exec + instr->mem_offset;
-        exec_e = (uint64_t)module->exec + instr->mem_offset + instr->memsz;
-        exec_s &= ~(MAX_PAGE_SIZE - 1);
-        exec_e &= ~(MAX_PAGE_SIZE - 1);
-
-        for (; exec_s <= exec_e; exec_s += MAX_PAGE_SIZE) {
-            if ((instr->perm & bfpf_x) != 0) {
-                ret = private_add_raw_md_to_memory_manager(exec_s, MEMORY_TYPE_R | MEMORY_TYPE_E);
-            }
-            else {
-                ret = private_add_raw_md_to_memory_manager(exec_s, MEMORY_TYPE_R | MEMORY_TYPE_W);
-            }
-
-            if (ret != MEMORY_MANAGER_SUCCESS) {
-                return ret;
-            }
+        ret = private_add_segment_md_to_memory_manager(
+                  (uint64_t)module->exec + instr->mem_offset, instr->memsz, instr->perm);
+        if (ret != BF_SUCCESS) {
+            return ret;
         }
     }
 
@@ -171,12 +369,15 @@ private_add_md_to_memory_manager(struct bfelf_binary_t *module)
 }
 
 int64_t
-private_add_tss_mdl(void)
+private_add_bundle_md_to_memory_manager(struct bfelf_binary_t *module)
 {
-    uint64_t i = 0;
+    uint64_t s = 0;
 
-    for (i = 0; i < g_tls_size; i += MAX_PAGE_SIZE) {
-        int64_t ret = private_add_raw_md_to_memory_manager((uint64_t)g_tls + i, MEMORY_TYPE_R | MEMORY_TYPE_W);
+    for (s = 0; s < g_bundle->num_segments; s++) {
+        const struct bfelf_bundle_segment *segment = bfelf_bundle_get_segment(g_bundle, s);
+
+        int64_t ret = private_add_segment_md_to_memory_manager(
+                          (uint64_t)module->exec + segment->offset, segment->size, segment->perm);
         if (ret != BF_SUCCESS) {
             return ret;
         }
@@ -185,11 +386,59 @@ private_add_tss_mdl(void)
     return BF_SUCCESS;
 }
 
+int64_t
+private_load_bundle(void)
+{
+    int64_t ret = bfelf_bundle_init(g_modules[0].file, g_modules[0].file_size, &g_bundle);
+    if (ret != BFELF_SUCCESS) {
+        return ret;
+    }
+
+    g_modules[0].exec_size = g_bundle->image_size;
+    g_modules[0].exec = (char *)platform_alloc_rwe(g_modules[0].exec_size);
+
+    if (g_modules[0].exec == 0) {
+        return BF_ERROR_OUT_OF_MEMORY;
+    }
+
+    return bfelf_bundle_load(g_bundle, g_modules[0].exec, (void **)&_start_func, &g_info);
+}
+
+int64_t
+private_load_modules(void)
+{
+    if (g_num_modules == 1 && bfelf_is_bundle(g_modules[0].file, g_modules[0].file_size) != 0) {
+        return private_load_bundle();
+    }
+
+    return bfelf_load(g_modules, (uint64_t)g_num_modules, (void **)&_start_func, &g_info, &g_loader);
+}
+
+int64_t
+private_add_tss_mdl(void)
+{
+    return private_add_raw_md_to_memory_manager((uint64_t)g_tls, g_tls_size, MEMORY_TYPE_R | MEMORY_TYPE_W);
+}
+
+int64_t
+private_add_status_mdl(void)
+{
+    if (g_status == 0) {
+        return BF_SUCCESS;
+    }
+
+    return private_add_raw_md_to_memory_manager((uint64_t)g_status, VMM_STATUS_SIZE, MEMORY_TYPE_R | MEMORY_TYPE_W);
+}
+
 int64_t
 private_add_modules_mdl(void)
 {
     int64_t i = 0;
 
+    if (g_bundle != 0) {
+        return private_add_bundle_md_to_memory_manager(&g_modules[0]);
+    }
+
     for (i = 0; i < g_num_modules; i++) {
         int64_t ret = private_add_md_to_memory_manager(&g_modules[i]);
         if (ret != BF_SUCCESS) {
@@ -200,6 +449,38 @@ private_add_modules_mdl(void)
     return BF_SUCCESS;
 }
 
+/*
+ * Creating a vCPU allocates its VMCS, its exit handler's stack, etc...
+ * which is slow enough that doing it when the VMM is started leaves a large
+ * window where some of the CPUs are in a VM and others are not. Instead, the
+ * vCPUs are prepared when the VMM is loaded, on all of the CPUs at the same
+ * time, which leaves only VMXON and VMLAUNCH for the start. Preparing is
+ * only an optimization, as any vCPU that was not prepared is created when
+ * the VMM is started, so a failure is reported by the start, not the load.
+ */
+
+void
+private_prepare_cpu(void *arg)
+{
+    int64_t cpuid = platform_get_current_cpu_num();
+    platform_restore_preemption();
+
+    bfignored(arg);
+
+    if (cpuid < 0 || cpuid >= g_num_cpus) {
+        return;
+    }
+
+    g_cpus[cpuid].ret = private_call_vmm(BF_REQUEST_VMM_PREPARE, (uint64_t)cpuid, 0, 0);
+}
+
+void
+private_prepare_cpus(void)
+{
+    int64_t ignore_ret = platform_call_on_each_cpu(private_prepare_cpu, 0);
+    bfignored(ignore_ret);
+}
+
 /* -------------------------------------------------------------------------- */
 /* Implementation                                                             */
 /* -------------------------------------------------------------------------- */
@@ -229,9 +510,9 @@ common_reset(void)
     platform_memset(&g_loader, 0, sizeof(struct bfelf_loader_t));
 
     _start_func = 0;
+    g_bundle = 0;
 
     g_num_modules = 0;
-    g_num_cpus_started = 0;
     g_vmm_status = VMM_UNLOADED;
 
     if (g_tls != 0) {
@@ -242,15 +523,28 @@ common_reset(void)
         platform_free_rw(g_stack, g_stack_size);
     }
 
+    if (g_cpus != 0) {
+        platform_free_rw(g_cpus, sizeof(struct cpu_state_t) * (uint64_t)g_num_cpus);
+    }
+
     g_tls = 0;
     g_stack = 0;
     g_stack_top = 0;
+
+    g_cpus = 0;
+    g_num_cpus = 0;
+
+    g_memory = 0;
+    g_debug_ring_size = DEBUG_RING_SIZE;
+
+    private_update_status();
 }
 
 void
 common_init(void)
 {
     common_reset();
+    private_setup_status();
 }
 
 int64_t
@@ -276,6 +570,11 @@ common_fini(void)
         common_reset();
     }
 
+    if (g_status != 0) {
+        platform_free_rw(g_status, VMM_STATUS_SIZE);
+        g_status = 0;
+    }
+
     return BF_SUCCESS;
 }
 
@@ -339,12 +638,22 @@ common_load_vmm(void)
         goto failure;
     }
 
+    ret = private_setup_cpus();
+    if (ret != BF_SUCCESS) {
+        goto failure;
+    }
+
     ret = private_setup_info();
     if (ret != BF_SUCCESS) {
         goto failure;
     }
 
-    ret = bfelf_load(g_modules, (uint64_t)g_num_modules, (void **)&_start_func, &g_info, &g_loader);
+    ret = private_load_modules();
+    if (ret != BF_SUCCESS) {
+        goto failure;
+    }
+
+    ret = private_setup_cpu_info();
     if (ret != BF_SUCCESS) {
         goto failure;
     }
@@ -364,7 +673,14 @@ common_load_vmm(void)
         goto failure;
     }
 
-    g_vmm_status = VMM_LOADED;
+    ret = private_add_status_mdl();
+    if (ret != BF_SUCCESS) {
+        goto failure;
+    }
+
+    private_prepare_cpus();
+
+    private_set_vmm_status(VMM_LOADED);
     return BF_SUCCESS;
 
 failure:
@@ -400,22 +716,65 @@ unloaded:
 
     common_reset();
 
-    g_vmm_status = VMM_UNLOADED;
+    private_set_vmm_status(VMM_UNLOADED);
     return BF_SUCCESS;
 
 corrupted:
 
-    g_vmm_status = VMM_CORRUPT;
+    private_set_vmm_status(VMM_CORRUPT);
     return ret;
 }
 
+void
+private_start_cpu(void *arg)
+{
+    int64_t cpuid = platform_get_current_cpu_num();
+    platform_restore_preemption();
+
+    bfignored(arg);
+
+    if (cpuid < 0 || cpuid >= g_num_cpus) {
+        return;
+    }
+
+    g_cpus[cpuid].ret = private_call_vmm(BF_REQUEST_VMM_INIT, (uint64_t)cpuid, 0, 0);
+    g_cpus[cpuid].suspended = 0;
+
+    if (g_cpus[cpuid].ret != BF_SUCCESS) {
+        return;
+    }
+
+    g_cpus[cpuid].started = 1;
+    platform_start();
+}
+
+void
+private_stop_cpu(void *arg)
+{
+    int64_t cpuid = platform_get_current_cpu_num();
+    platform_restore_preemption();
+
+    bfignored(arg);
+
+    if (cpuid < 0 || cpuid >= g_num_cpus || g_cpus[cpuid].started == 0) {
+        return;
+    }
+
+    g_cpus[cpuid].ret = private_call_vmm(BF_REQUEST_VMM_FINI, (uint64_t)cpuid, 0, 0);
+    if (g_cpus[cpuid].ret != BF_SUCCESS) {
+        return;
+    }
+
+    g_cpus[cpuid].started = 0;
+    platform_stop();
+}
+
 int64_t
 common_start_vmm(void)
 {
     int64_t ret = 0;
     int64_t cpuid = 0;
     int64_t ignore_ret = 0;
-    int64_t caller_affinity = 0;
 
     switch (common_vmm_status()) {
         case VMM_CORRUPT:
@@ -428,32 +787,44 @@ common_start_vmm(void)
             break;
     }
 
-    for (cpuid = 0, g_num_cpus_started = 0; cpuid < platform_num_cpus(); cpuid++) {
+    /*
+     * An online CPU that func is never executed on keeps the error below,
+     * which means that the start fails, and the CPUs that did start are
+     * stopped. CPUs that are offline are started if they come online later
+     * (see common_start_cpu()).
+     */
 
-        ret = caller_affinity = platform_set_affinity(cpuid);
-        if (caller_affinity < 0) {
-            goto failure;
-        }
+    for (cpuid = 0; cpuid < g_num_cpus; cpuid++) {
+        g_cpus[cpuid].ret = platform_cpu_online(cpuid) != 0 ? BF_ERROR_UNKNOWN : BF_SUCCESS;
+    }
 
-        ret = private_call_vmm(BF_REQUEST_VMM_INIT, (uint64_t)cpuid, 0, 0);
-        if (ret != BF_SUCCESS) {
-            goto failure;
+    ret = platform_call_on_each_cpu(private_start_cpu, 0);
+
+    for (cpuid = 0; cpuid < g_num_cpus; cpuid++) {
+        if (g_cpus[cpuid].started != 0) {
+            g_vmm_status = VMM_RUNNING;
         }
 
-        g_num_cpus_started++;
+        if (ret == BF_SUCCESS) {
+            ret = g_cpus[cpuid].ret;
+        }
+    }
 
-        platform_start();
-        platform_restore_affinity(caller_affinity);
+    /*
+     * If no CPU was started (e.g. because they are all offline), the VMM
+     * is not running, so the start fails.
+     */
 
-        g_vmm_status = VMM_RUNNING;
+    if (ret == BF_SUCCESS && g_vmm_status != VMM_RUNNING) {
+        ret = BF_ERROR_UNKNOWN;
     }
 
-    return BF_SUCCESS;
+    private_update_status();
 
-failure:
-
-    ignore_ret = common_stop_vmm();
-    bfignored(ignore_ret);
+    if (ret != BF_SUCCESS) {
+        ignore_ret = common_stop_vmm();
+        bfignored(ignore_ret);
+    }
 
     return ret;
 }
@@ -463,7 +834,6 @@ common_stop_vmm(void)
 {
     int64_t ret = 0;
     int64_t cpuid = 0;
-    int64_t caller_affinity = 0;
 
     switch (common_vmm_status()) {
         case VMM_CORRUPT:
@@ -476,33 +846,231 @@ common_stop_vmm(void)
             break;
     }
 
-    for (cpuid = g_num_cpus_started - 1; cpuid >= 0 ; cpuid--) {
+    for (cpuid = 0; cpuid < g_num_cpus; cpuid++) {
+        g_cpus[cpuid].ret = g_cpus[cpuid].started != 0 ? BF_ERROR_UNKNOWN : BF_SUCCESS;
+    }
 
-        ret = caller_affinity = platform_set_affinity(cpuid);
-        if (caller_affinity < 0) {
-            goto corrupted;
-        }
+    ret = platform_call_on_each_cpu(private_stop_cpu, 0);
 
-        ret = private_call_vmm(BF_REQUEST_VMM_FINI, (uint64_t)cpuid, 0, 0);
-        if (ret != BFELF_SUCCESS) {
-            goto corrupted;
+    for (cpuid = 0; cpuid < g_num_cpus; cpuid++) {
+        if (ret == BF_SUCCESS) {
+            ret = g_cpus[cpuid].ret;
         }
+    }
 
-        g_num_cpus_started--;
-
-        platform_stop();
-        platform_restore_affinity(caller_affinity);
+    if (ret != BF_SUCCESS) {
+        goto corrupted;
     }
 
-    g_vmm_status = VMM_LOADED;
+    private_set_vmm_status(VMM_LOADED);
     return BF_SUCCESS;
 
 corrupted:
 
-    g_vmm_status = VMM_CORRUPT;
+    private_set_vmm_status(VMM_CORRUPT);
+    return ret;
+}
+
+/*
+ * Suspending the VMM on a CPU executes VMXOFF, but keeps the CPU's vCPU
+ * (i.e. its VMCS, exit handler, etc...), and all of the VMM's memory. A
+ * suspended CPU is resumed using BF_REQUEST_VMM_INIT, which runs the vCPU
+ * that already exists (i.e. VMXON, VMCLEAR, VMPTRLD and VMLAUNCH). If the
+ * resume fails, the vCPU is deleted by the VMM, so the CPU is no longer
+ * suspended either way.
+ */
+
+void
+private_suspend_cpu(void *arg)
+{
+    int64_t cpuid = platform_get_current_cpu_num();
+    platform_restore_preemption();
+
+    bfignored(arg);
+
+    if (cpuid < 0 || cpuid >= g_num_cpus || g_cpus[cpuid].started == 0) {
+        return;
+    }
+
+    g_cpus[cpuid].ret = private_call_vmm(BF_REQUEST_VMM_SUSPEND, (uint64_t)cpuid, 0, 0);
+    if (g_cpus[cpuid].ret != BF_SUCCESS) {
+        return;
+    }
+
+    g_cpus[cpuid].started = 0;
+    g_cpus[cpuid].suspended = 1;
+
+    platform_stop();
+}
+
+void
+private_resume_cpu(void *arg)
+{
+    int64_t cpuid = platform_get_current_cpu_num();
+    platform_restore_preemption();
+
+    bfignored(arg);
+
+    if (cpuid < 0 || cpuid >= g_num_cpus || g_cpus[cpuid].suspended == 0) {
+        return;
+    }
+
+    private_start_cpu(arg);
+}
+
+int64_t
+common_suspend_vmm(void)
+{
+    int64_t ret = 0;
+    int64_t cpuid = 0;
+
+    switch (common_vmm_status()) {
+        case VMM_CORRUPT:
+            return BF_ERROR_VMM_CORRUPTED;
+        case VMM_RUNNING:
+            break;
+        default:
+            return BF_SUCCESS;
+    }
+
+    for (cpuid = 0; cpuid < g_num_cpus; cpuid++) {
+        g_cpus[cpuid].ret = g_cpus[cpuid].started != 0 ? BF_ERROR_UNKNOWN : BF_SUCCESS;
+    }
+
+    ret = platform_call_on_each_cpu(private_suspend_cpu, 0);
+
+    for (cpuid = 0; cpuid < g_num_cpus; cpuid++) {
+        if (ret == BF_SUCCESS) {
+            ret = g_cpus[cpuid].ret;
+        }
+    }
+
+    if (ret != BF_SUCCESS) {
+        private_set_vmm_status(VMM_CORRUPT);
+        return ret;
+    }
+
+    private_update_status();
+    return BF_SUCCESS;
+}
+
+int64_t
+common_resume_vmm(void)
+{
+    int64_t ret = 0;
+    int64_t cpuid = 0;
+    int64_t ignore_ret = 0;
+
+    switch (common_vmm_status()) {
+        case VMM_CORRUPT:
+            return BF_ERROR_VMM_CORRUPTED;
+        case VMM_RUNNING:
+            break;
+        default:
+            return BF_SUCCESS;
+    }
+
+    /*
+     * A suspended CPU that is offline stays suspended, and is resumed by
+     * common_start_cpu() once it comes online.
+     */
+
+    for (cpuid = 0; cpuid < g_num_cpus; cpuid++) {
+        if (g_cpus[cpuid].suspended != 0 && platform_cpu_online(cpuid) != 0) {
+            g_cpus[cpuid].ret = BF_ERROR_UNKNOWN;
+        }
+        else {
+            g_cpus[cpuid].ret = BF_SUCCESS;
+        }
+    }
+
+    ret = platform_call_on_each_cpu(private_resume_cpu, 0);
+
+    for (cpuid = 0; cpuid < g_num_cpus; cpuid++) {
+        if (ret == BF_SUCCESS) {
+            ret = g_cpus[cpuid].ret;
+        }
+    }
+
+    private_update_status();
+
+    if (ret != BF_SUCCESS) {
+        ignore_ret = common_stop_vmm();
+        bfignored(ignore_ret);
+    }
+
     return ret;
 }
 
+int64_t
+private_current_cpu_is(int64_t cpuid)
+{
+    int64_t current = platform_get_current_cpu_num();
+    platform_restore_preemption();
+
+    return current == cpuid ? 1 : 0;
+}
+
+int64_t
+common_start_cpu(int64_t cpuid)
+{
+    switch (common_vmm_status()) {
+        case VMM_CORRUPT:
+            return BF_ERROR_VMM_CORRUPTED;
+        case VMM_RUNNING:
+            break;
+        default:
+            return BF_SUCCESS;
+    }
+
+    if (cpuid < 0 || cpuid >= g_num_cpus || private_current_cpu_is(cpuid) == 0) {
+        return BF_ERROR_INVALID_ARG;
+    }
+
+    if (g_cpus[cpuid].started != 0) {
+        return BF_SUCCESS;
+    }
+
+    g_cpus[cpuid].ret = BF_ERROR_UNKNOWN;
+
+    private_start_cpu(0);
+    private_update_status();
+
+    return g_cpus[cpuid].ret;
+}
+
+int64_t
+common_stop_cpu(int64_t cpuid)
+{
+    switch (common_vmm_status()) {
+        case VMM_CORRUPT:
+            return BF_ERROR_VMM_CORRUPTED;
+        case VMM_RUNNING:
+            break;
+        default:
+            return BF_SUCCESS;
+    }
+
+    if (cpuid < 0 || cpuid >= g_num_cpus || private_current_cpu_is(cpuid) == 0) {
+        return BF_ERROR_INVALID_ARG;
+    }
+
+    if (g_cpus[cpuid].started == 0) {
+        return BF_SUCCESS;
+    }
+
+    g_cpus[cpuid].ret = BF_ERROR_UNKNOWN;
+    private_stop_cpu(0);
+
+    if (g_cpus[cpuid].ret != BF_SUCCESS) {
+        private_set_vmm_status(VMM_CORRUPT);
+        return g_cpus[cpuid].ret;
+    }
+
+    private_update_status();
+    return BF_SUCCESS;
+}
+
 int64_t
 common_dump_vmm(struct debug_ring_resources_t **drr, uint64_t vcpuid)
 {
@@ -523,3 +1091,90 @@ common_dump_vmm(struct debug_ring_resources_t **drr, uint64_t vcpuid)
 
     return BF_SUCCESS;
 }
+
+int64_t
+common_dump_trace(struct trace_ring_resources_t **trr, uint64_t cpuid)
+{
+    int64_t ret = 0;
+
+    if (trr == 0) {
+        return BF_ERROR_INVALID_ARG;
+    }
+
+    if (common_vmm_status() == VMM_UNLOADED) {
+        return BF_ERROR_VMM_INVALID_STATE;
+    }
+
+    ret = private_call_vmm(BF_REQUEST_GET_TRR, (uint64_t)cpuid, (uint64_t)trr, 0);
+    if (ret != BFELF_SUCCESS) {
+        return ret;
+    }
+
+    return BF_SUCCESS;
+}
+
+int64_t
+common_set_debug_level(uint64_t subsystem, int64_t level)
+{
+    int64_t ret = 0;
+
+    if (subsystem >= BFDEBUG_SUBSYSTEM_NUM && subsystem != BFDEBUG_SUBSYSTEM_ALL) {
+        return BF_ERROR_INVALID_ARG;
+    }
+
+    if (common_vmm_status() == VMM_UNLOADED) {
+        return BF_ERROR_VMM_INVALID_STATE;
+    }
+
+    ret = private_call_vmm(BF_REQUEST_SET_DEBUG_LEVEL, subsystem, (uint64_t)level, 0);
+    if (ret != BFELF_SUCCESS) {
+        return ret;
+    }
+
+    return BF_SUCCESS;
+}
+
+int64_t
+common_set_debug_ring_size(uint64_t size)
+{
+    if (debug_ring_size_valid(size) == 0) {
+        return BF_ERROR_INVALID_ARG;
+    }
+
+    if (common_vmm_status() != VMM_UNLOADED) {
+        return BF_ERROR_VMM_INVALID_STATE;
+    }
+
+    g_debug_ring_size = size;
+    return BF_SUCCESS;
+}
+
+int64_t
+common_get_tsc_info(struct tsc_info_t *info)
+{
+    if (info == 0) {
+        return BF_ERROR_INVALID_ARG;
+    }
+
+    if (common_vmm_status() == VMM_UNLOADED) {
+        return BF_ERROR_VMM_INVALID_STATE;
+    }
+
+    *info = g_info.platform_info.tsc_info;
+    return BF_SUCCESS;
+}
+
+int64_t
+common_get_status(struct vmm_status_t **status)
+{
+    if (status == 0) {
+        return BF_ERROR_INVALID_ARG;
+    }
+
+    if (g_status == 0) {
+        return BF_ERROR_OUT_OF_MEMORY;
+    }
+
+    *status = g_status;
+    return BF_SUCCESS;
+}
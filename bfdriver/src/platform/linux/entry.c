@@ -18,12 +18,18 @@
  */
 
 #include <linux/fs.h>
+#include <linux/mm.h>
+#include <linux/cpu.h>
+#include <linux/cpuhotplug.h>
 #include <linux/module.h>
+#include <linux/version.h>
+#include <linux/vmalloc.h>
 #include <linux/uaccess.h>
 #include <linux/miscdevice.h>
 #include <linux/kallsyms.h>
 #include <linux/notifier.h>
 #include <linux/reboot.h>
+#include <linux/suspend.h>
 
 #include <common.h>
 
@@ -47,6 +53,8 @@ struct pmodule_t {
 uint64_t g_num_pmodules = 0;
 struct pmodule_t pmodules[MAX_NUM_MODULES] = { 0 };
 
+int g_cpuhp_state = -1;
+
 /* -------------------------------------------------------------------------- */
 /* Misc Device                                                                */
 /* -------------------------------------------------------------------------- */
@@ -72,7 +80,7 @@ dev_release(struct inode *inode, struct file *file)
 }
 
 static long
-ioctl_add_module(const char *file)
+private_add_module(const char *file, uint64_t len)
 {
     char *buf;
     int64_t ret;
@@ -82,19 +90,19 @@ ioctl_add_module(const char *file)
         return BF_IOCTL_FAILURE;
     }
 
-    buf = platform_alloc_rw(g_module_length);
+    buf = platform_alloc_rw(len);
     if (buf == NULL) {
         BFALERT("IOCTL_ADD_MODULE: failed to allocate memory for the module\n");
         return BF_IOCTL_FAILURE;
     }
 
-    ret = copy_from_user(buf, file, g_module_length);
+    ret = copy_from_user(buf, file, len);
     if (ret != 0) {
         BFALERT("IOCTL_ADD_MODULE: failed to copy memory from userspace\n");
         goto failed;
     }
 
-    ret = common_add_module(buf, g_module_length);
+    ret = common_add_module(buf, len);
     if (ret != BF_SUCCESS) {
         BFALERT("IOCTL_ADD_MODULE: common_add_module failed: %p - %s\n", \
                 (void *)ret, ec_to_str(ret));
@@ -102,18 +110,86 @@ ioctl_add_module(const char *file)
     }
 
     pmodules[g_num_pmodules].data = buf;
-    pmodules[g_num_pmodules].size = g_module_length;
+    pmodules[g_num_pmodules].size = len;
 
     g_num_pmodules++;
+    return BF_IOCTL_SUCCESS;
+
+failed:
+
+    platform_free_rw(buf, len);
+    return BF_IOCTL_FAILURE;
+}
+
+static long
+ioctl_add_module(const char *file)
+{
+    if (private_add_module(file, g_module_length) != BF_IOCTL_SUCCESS) {
+        BFALERT("IOCTL_ADD_MODULE: failed\n");
+        return BF_IOCTL_FAILURE;
+    }
 
     BFDEBUG("IOCTL_ADD_MODULE: succeeded\n");
     return BF_IOCTL_SUCCESS;
+}
+
+static long
+ioctl_add_modules(struct add_modules_t *modules)
+{
+    uint64_t i;
+    int64_t ret;
+    uint64_t vec_size;
+
+    struct add_modules_t args;
+    struct module_vec_t *vec;
+
+    if (modules == 0) {
+        BFALERT("IOCTL_ADD_MODULES: failed with modules == NULL\n");
+        return BF_IOCTL_FAILURE;
+    }
+
+    ret = copy_from_user(&args, modules, sizeof(struct add_modules_t));
+    if (ret != 0) {
+        BFALERT("IOCTL_ADD_MODULES: failed to copy memory from userspace\n");
+        return BF_IOCTL_FAILURE;
+    }
+
+    if (args.num == 0 || args.num > MAX_NUM_MODULES - g_num_pmodules) {
+        BFALERT("IOCTL_ADD_MODULES: invalid number of modules: %llu\n", args.num);
+        return BF_IOCTL_FAILURE;
+    }
+
+    vec_size = args.num * sizeof(struct module_vec_t);
+
+    vec = platform_alloc_rw(vec_size);
+    if (vec == NULL) {
+        BFALERT("IOCTL_ADD_MODULES: failed to allocate memory for the module list\n");
+        return BF_IOCTL_FAILURE;
+    }
+
+    ret = copy_from_user(vec, (void *)args.vec, vec_size);
+    if (ret != 0) {
+        BFALERT("IOCTL_ADD_MODULES: failed to copy memory from userspace\n");
+        goto failed;
+    }
+
+    for (i = 0; i < args.num; i++) {
+        if (private_add_module((const char *)vec[i].addr, vec[i].size) != BF_IOCTL_SUCCESS) {
+            BFALERT("IOCTL_ADD_MODULES: failed to add module #%llu\n", i);
+            goto failed;
+        }
+    }
+
+    platform_free_rw(vec, vec_size);
+
+    BFDEBUG("IOCTL_ADD_MODULES: succeeded\n");
+    return BF_IOCTL_SUCCESS;
 
 failed:
 
-    platform_free_rw(buf, g_module_length);
+    platform_free_rw(vec, vec_size);
 
-    BFALERT("IOCTL_ADD_MODULE: failed\n");
+    BFALERT("IOCTL_ADD_MODULES: failed\n");
     return BF_IOCTL_FAILURE;
 }
 
@@ -137,6 +213,14 @@ ioctl_add_module_length(uint64_t *len)
     return BF_IOCTL_SUCCESS;
 }
 
+/*
+ * The ioctls that change which CPUs the VMM is running on hold the CPU
+ * hotplug lock, which prevents CPUs from coming online or going offline
+ * while the VMM is being loaded, started, stopped or unloaded. This also
+ * serializes these ioctls with the CPU hotplug callbacks below, which are
+ * called with the CPU hotplug lock held.
+ */
+
 static long
 ioctl_unload_vmm(void)
 {
@@ -144,7 +228,10 @@ ioctl_unload_vmm(void)
     int64_t ret;
     long status = BF_IOCTL_SUCCESS;
 
+    cpus_read_lock();
     ret = common_unload_vmm();
+    cpus_read_unlock();
+
     if (ret != BF_SUCCESS) {
         BFALERT("IOCTL_UNLOAD_VMM: common_unload_vmm failed: %p - %s\n", (void *)ret, ec_to_str(ret));
         status = BF_IOCTL_FAILURE;
@@ -169,7 +256,10 @@ ioctl_load_vmm(void)
 {
     int64_t ret;
 
+    cpus_read_lock();
     ret = common_load_vmm();
+    cpus_read_unlock();
+
     if (ret != BF_SUCCESS) {
         BFALERT("IOCTL_LOAD_VMM: common_load_vmm failed: %p - %s\n", (void *)ret, ec_to_str(ret));
         goto failure;
@@ -190,7 +280,9 @@ ioctl_stop_vmm(void)
     int64_t ret;
     long status = BF_IOCTL_SUCCESS;
 
+    cpus_read_lock();
     ret = common_stop_vmm();
+    cpus_read_unlock();
 
     if (ret != BF_SUCCESS) {
         BFALERT("IOCTL_STOP_VMM: common_stop_vmm failed: %p - %s\n", (void *)ret, ec_to_str(ret));
@@ -209,7 +301,10 @@ ioctl_start_vmm(void)
 {
     int64_t ret;
 
+    cpus_read_lock();
     ret = common_start_vmm();
+    cpus_read_unlock();
+
     if (ret != BF_SUCCESS) {
         BFALERT("IOCTL_START_VMM: common_start_vmm failed: %p - %s\n", (void *)ret, ec_to_str(ret));
         goto failure;
@@ -229,6 +324,23 @@ ioctl_dump_vmm(struct debug_ring_resources_t *user_drr)
 {
     int64_t ret;
     struct debug_ring_resources_t *drr = 0;
+    struct debug_ring_resources_t hdr;
+
+    if (user_drr == 0) {
+        BFALERT("IOCTL_DUMP_VMM: failed with drr == NULL\n");
+        return BF_IOCTL_FAILURE;
+    }
+
+    /*
+     * User space provides the size of the buffer that follows its header
+     * using len, which must be large enough to hold the debug ring.
+     */
+
+    ret = copy_from_user(&hdr, user_drr, sizeof(struct debug_ring_resources_t));
+    if (ret != 0) {
+        BFALERT("IOCTL_DUMP_VMM: failed to copy memory from userspace\n");
+        return BF_IOCTL_FAILURE;
+    }
 
     ret = common_dump_vmm(&drr, g_vcpuid);
     if (ret != BF_SUCCESS) {
@@ -236,7 +348,12 @@ ioctl_dump_vmm(struct debug_ring_resources_t *user_drr)
         return BF_IOCTL_FAILURE;
     }
 
-    ret = copy_to_user(user_drr, drr, sizeof(struct debug_ring_resources_t));
+    if (drr->len > hdr.len) {
+        BFALERT("IOCTL_DUMP_VMM: the provided buffer is too small\n");
+        return BF_IOCTL_FAILURE;
+    }
+
+    ret = copy_to_user(user_drr, drr, debug_ring_total_size(drr->len));
     if (ret != 0) {
         BFALERT("IOCTL_DUMP_VMM: failed to copy memory from userspace\n");
         return BF_IOCTL_FAILURE;
@@ -246,6 +363,28 @@ ioctl_dump_vmm(struct debug_ring_resources_t *user_drr)
     return BF_IOCTL_SUCCESS;
 }
 
+static long
+ioctl_dump_trace(struct trace_ring_resources_t *user_trr)
+{
+    int64_t ret;
+    struct trace_ring_resources_t *trr = 0;
+
+    ret = common_dump_trace(&trr, g_vcpuid);
+    if (ret != BF_SUCCESS) {
+        BFALERT("IOCTL_DUMP_TRACE: common_dump_trace failed: %p - %s\n", (void *)ret, ec_to_str(ret));
+        return BF_IOCTL_FAILURE;
+    }
+
+    ret = copy_to_user(user_trr, trr, sizeof(struct trace_ring_resources_t));
+    if (ret != 0) {
+        BFALERT("IOCTL_DUMP_TRACE: failed to copy memory from userspace\n");
+        return BF_IOCTL_FAILURE;
+    }
+
+    BFDEBUG("IOCTL_DUMP_TRACE: succeeded\n");
+    return BF_IOCTL_SUCCESS;
+}
+
 static long
 ioctl_vmm_status(int64_t *status)
 {
@@ -285,6 +424,204 @@ ioctl_set_vcpuid(uint64_t *vcpuid)
     return BF_IOCTL_SUCCESS;
 }
 
+static long
+ioctl_set_debug_level(struct debug_level_t *user_level)
+{
+    int64_t ret;
+    struct debug_level_t level;
+
+    if (user_level == 0) {
+        BFALERT("IOCTL_SET_DEBUG_LEVEL: failed with level == NULL\n");
+        return BF_IOCTL_FAILURE;
+    }
+
+    ret = copy_from_user(&level, user_level, sizeof(struct debug_level_t));
+    if (ret != 0) {
+        BFALERT("IOCTL_SET_DEBUG_LEVEL: failed to copy memory from userspace\n");
+        return BF_IOCTL_FAILURE;
+    }
+
+    ret = common_set_debug_level(level.subsystem, level.level);
+    if (ret != BF_SUCCESS) {
+        BFALERT("IOCTL_SET_DEBUG_LEVEL: common_set_debug_level failed: %p - %s\n", (void *)ret, ec_to_str(ret));
+        return BF_IOCTL_FAILURE;
+    }
+
+    BFDEBUG("IOCTL_SET_DEBUG_LEVEL: succeeded\n");
+    return BF_IOCTL_SUCCESS;
+}
+
+static long
+ioctl_set_debug_ring_size(uint64_t *user_size)
+{
+    int64_t ret;
+    uint64_t size;
+
+    if (user_size == 0) {
+        BFALERT("IOCTL_SET_DEBUG_RING_SIZE: failed with size == NULL\n");
+        return BF_IOCTL_FAILURE;
+    }
+
+    ret = copy_from_user(&size, user_size, sizeof(uint64_t));
+    if (ret != 0) {
+        BFALERT("IOCTL_SET_DEBUG_RING_SIZE: failed to copy memory from userspace\n");
+        return BF_IOCTL_FAILURE;
+    }
+
+    ret = common_set_debug_ring_size(size);
+    if (ret != BF_SUCCESS) {
+        BFALERT("IOCTL_SET_DEBUG_RING_SIZE: common_set_debug_ring_size failed: %p - %s\n", (void *)ret, ec_to_str(ret));
+        return BF_IOCTL_FAILURE;
+    }
+
+    BFDEBUG("IOCTL_SET_DEBUG_RING_SIZE: succeeded\n");
+    return BF_IOCTL_SUCCESS;
+}
+
+static long
+ioctl_get_tsc_info(struct tsc_info_t *user_info)
+{
+    int64_t ret;
+    struct tsc_info_t info;
+
+    ret = common_get_tsc_info(&info);
+    if (ret != BF_SUCCESS) {
+        BFALERT("IOCTL_GET_TSC_INFO: common_get_tsc_info failed: %p - %s\n", (void *)ret, ec_to_str(ret));
+        return BF_IOCTL_FAILURE;
+    }
+
+    ret = copy_to_user(user_info, &info, sizeof(struct tsc_info_t));
+    if (ret != 0) {
+        BFALERT("IOCTL_GET_TSC_INFO: failed to copy memory from userspace\n");
+        return BF_IOCTL_FAILURE;
+    }
+
+    BFDEBUG("IOCTL_GET_TSC_INFO: succeeded\n");
+    return BF_IOCTL_SUCCESS;
+}
+
+static struct page *
+private_virt_to_page(void *addr)
+{
+    if (is_vmalloc_addr(addr)) {
+        return vmalloc_to_page(addr);
+    }
+
+    return virt_addr_valid(addr) ? virt_to_page(addr) : 0;
+}
+
+static int
+private_mmap_status(struct vm_area_struct *vma)
+{
+    int64_t ret;
+    uint64_t offset;
+    struct page *page;
+    struct vmm_status_t *status = 0;
+
+    if (vma->vm_end - vma->vm_start != VMM_STATUS_SIZE) {
+        BFALERT("dev_mmap: invalid length\n");
+        return -EINVAL;
+    }
+
+    ret = common_get_status(&status);
+    if (ret != BF_SUCCESS) {
+        BFALERT("dev_mmap: common_get_status failed: %p - %s\n", (void *)ret, ec_to_str(ret));
+        return -EINVAL;
+    }
+
+    /*
+     * Like the debug ring, vm_insert_page() takes a reference to each of the
+     * status pages, so they remain valid until user space unmaps them, even
+     * if the driver is unloaded in the mean time.
+     */
+
+    for (offset = 0; offset < VMM_STATUS_SIZE; offset += PAGE_SIZE) {
+        page = private_virt_to_page((char *)status + offset);
+        if (page == 0 || vm_insert_page(vma, vma->vm_start + offset, page) != 0) {
+            BFALERT("dev_mmap: failed to map the status page\n");
+            return -EAGAIN;
+        }
+    }
+
+    BFDEBUG("dev_mmap: succeeded\n");
+    return 0;
+}
+
+static int
+dev_mmap(struct file *file, struct vm_area_struct *vma)
+{
+    int64_t ret;
+    unsigned long i;
+    unsigned long addr;
+    unsigned long end;
+    unsigned long size = vma->vm_end - vma->vm_start;
+    struct debug_ring_resources_t *drr = 0;
+
+    (void) file;
+
+    if ((vma->vm_flags & VM_WRITE) != 0) {
+        BFALERT("dev_mmap: the debug ring and status page can only be mapped read-only\n");
+        return -EPERM;
+    }
+
+#if LINUX_VERSION_CODE >= KERNEL_VERSION(6,3,0)
+    vm_flags_clear(vma, VM_MAYWRITE);
+#else
+    vma->vm_flags &= ~VM_MAYWRITE;
+#endif
+
+    if (vma->vm_pgoff == (VMM_STATUS_MMAP_OFFSET >> PAGE_SHIFT)) {
+        return private_mmap_status(vma);
+    }
+
+    if (vma->vm_pgoff != 0) {
+        BFALERT("dev_mmap: invalid offset\n");
+        return -EINVAL;
+    }
+
+    ret = common_dump_vmm(&drr, g_vcpuid);
+    if (ret != BF_SUCCESS) {
+        BFALERT("dev_mmap: common_dump_vmm failed: %p - %s\n", (void *)ret, ec_to_str(ret));
+        return -EINVAL;
+    }
+
+    /*
+     * The debug ring lives in the VMM's page pool, which was allocated using
+     * vmalloc. vm_insert_page() takes a reference to each page, so that the
+     * pages remain valid until user space unmaps them, even if the VMM is
+     * unloaded in the mean time.
+     *
+     * Only the pages that hold the debug ring are mapped. Anything else in
+     * the VMM's heap (e.g. a vCPU's save state) must never be visible to
+     * user space.
+     */
+
+    addr = (unsigned long)drr;
+    end = PAGE_ALIGN((unsigned long)debug_ring_buf(drr) + drr->len);
+
+    if ((addr & ~PAGE_MASK) != 0) {
+        BFALERT("dev_mmap: debug ring is not page aligned\n");
+        return -EINVAL;
+    }
+
+    if (size > end - addr) {
+        BFALERT("dev_mmap: invalid length\n");
+        return -EINVAL;
+    }
+
+    for (i = 0; i < size; i += PAGE_SIZE) {
+        struct page *page = private_virt_to_page((void *)(addr + i));
+
+        if (page == 0 || vm_insert_page(vma, vma->vm_start + i, page) != 0) {
+            BFALERT("dev_mmap: failed to map the debug ring\n");
+            return -EAGAIN;
+        }
+    }
+
+    BFDEBUG("dev_mmap: succeeded\n");
+    return 0;
+}
+
 static long
 dev_unlocked_ioctl(struct file *file,
                    unsigned int cmd,
@@ -299,6 +636,9 @@ dev_unlocked_ioctl(struct file *file,
         case IOCTL_ADD_MODULE_LENGTH:
             return ioctl_add_module_length((uint64_t *)arg);
 
+        case IOCTL_ADD_MODULES:
+            return ioctl_add_modules((struct add_modules_t *)arg);
+
         case IOCTL_LOAD_VMM:
             return ioctl_load_vmm();
 
@@ -320,6 +660,18 @@ dev_unlocked_ioctl(struct file *file,
         case IOCTL_SET_VCPUID:
             return ioctl_set_vcpuid((uint64_t *)arg);
 
+        case IOCTL_DUMP_TRACE:
+            return ioctl_dump_trace((struct trace_ring_resources_t *)arg);
+
+        case IOCTL_SET_DEBUG_LEVEL:
+            return ioctl_set_debug_level((struct debug_level_t *)arg);
+
+        case IOCTL_SET_DEBUG_RING_SIZE:
+            return ioctl_set_debug_ring_size((uint64_t *)arg);
+
+        case IOCTL_GET_TSC_INFO:
+            return ioctl_get_tsc_info((struct tsc_info_t *)arg);
+
         default:
             return -EINVAL;
     }
@@ -328,6 +680,7 @@ dev_unlocked_ioctl(struct file *file,
 static struct file_operations fops = {
     .open = dev_open,
     .release = dev_release,
+    .mmap = dev_mmap,
     .unlocked_ioctl = dev_unlocked_ioctl,
 };
 
@@ -337,6 +690,105 @@ static struct miscdevice bareflank_dev = {
     &fops
 };
 
+/* -------------------------------------------------------------------------- */
+/* CPU Hotplug                                                                */
+/* -------------------------------------------------------------------------- */
+
+/*
+ * These callbacks are executed on the CPU that is coming online, or going
+ * offline. If the VMM is running, it is started on a CPU once the CPU is
+ * online, and stopped on a CPU before the CPU goes offline. Failing to stop
+ * the VMM aborts the offline, as a CPU cannot be removed while it is still
+ * in the VMM. A CPU that is suspended (see dev_pm_notify()) keeps its vCPU
+ * while it is offline, and its vCPU is resumed once it is online again.
+ */
+
+static int
+dev_cpu_online(unsigned int cpu)
+{
+    int64_t ret = common_start_cpu((int64_t)cpu);
+
+    if (ret != BF_SUCCESS) {
+        BFALERT("dev_cpu_online: common_start_cpu failed on cpu %u: %p - %s\n", cpu, (void *)ret, ec_to_str(ret));
+        return -EIO;
+    }
+
+    return 0;
+}
+
+static int
+dev_cpu_offline(unsigned int cpu)
+{
+    int64_t ret = common_stop_cpu((int64_t)cpu);
+
+    if (ret != BF_SUCCESS) {
+        BFALERT("dev_cpu_offline: common_stop_cpu failed on cpu %u: %p - %s\n", cpu, (void *)ret, ec_to_str(ret));
+        return -EIO;
+    }
+
+    return 0;
+}
+
+/* -------------------------------------------------------------------------- */
+/* Suspend / Resume                                                           */
+/* -------------------------------------------------------------------------- */
+
+/*
+ * The VMM is suspended before the system is suspended (or hibernated), and
+ * resumed once the system has resumed. This only disables (and re-enables)
+ * VMX operation on each CPU, as the vCPUs, and the rest of the VMM's memory
+ * are kept. Note that the non-boot CPUs are taken offline by the kernel
+ * while the system is suspended. These CPUs are already suspended when they
+ * go offline, and are resumed by dev_cpu_online() when they come back
+ * online, which leaves only the boot CPU for PM_POST_SUSPEND.
+ */
+
+static int
+dev_pm_notify(struct notifier_block *nb,
+              unsigned long action, void *unused)
+{
+    int64_t ret;
+
+    (void) nb;
+    (void) unused;
+
+    switch (action) {
+        case PM_SUSPEND_PREPARE:
+        case PM_HIBERNATION_PREPARE:
+            cpus_read_lock();
+            ret = common_suspend_vmm();
+            cpus_read_unlock();
+
+            if (ret != BF_SUCCESS) {
+                BFALERT("dev_pm_notify: common_suspend_vmm failed: %p - %s\n", (void *)ret, ec_to_str(ret));
+                return notifier_from_errno(-EIO);
+            }
+
+            break;
+
+        case PM_POST_SUSPEND:
+        case PM_POST_HIBERNATION:
+            cpus_read_lock();
+            ret = common_resume_vmm();
+            cpus_read_unlock();
+
+            if (ret != BF_SUCCESS) {
+                BFALERT("dev_pm_notify: common_resume_vmm failed: %p - %s\n", (void *)ret, ec_to_str(ret));
+            }
+
+            break;
+
+        default:
+            break;
+    }
+
+    return NOTIFY_OK;
+}
+
+static struct notifier_block bareflank_pm_notifier_block = {
+    .notifier_call = dev_pm_notify
+};
+
 /* -------------------------------------------------------------------------- */
 /* Entry / Exit                                                               */
 /* -------------------------------------------------------------------------- */
@@ -349,7 +801,9 @@ dev_reboot(struct notifier_block *nb,
     (void) code;
     (void) unused;
 
+    cpus_read_lock();
     common_fini();
+    cpus_read_unlock();
 
     return NOTIFY_DONE;
 }
@@ -370,6 +824,35 @@ dev_init(void)
 
     common_init();
 
+    /*
+     * The callbacks are not executed for the CPUs that are already online,
+     * as the VMM cannot be running yet.
+     */
+
+    g_cpuhp_state = cpuhp_setup_state_nocalls(
+                        CPUHP_AP_ONLINE_DYN, "bareflank:online", dev_cpu_online, dev_cpu_offline);
+
+    if (g_cpuhp_state < 0) {
+        BFALERT("cpuhp_setup_state_nocalls failed\n");
+
+        common_fini();
+        misc_deregister(&bareflank_dev);
+        unregister_reboot_notifier(&bareflank_notifier_block);
+
+        return -EPERM;
+    }
+
+    if (register_pm_notifier(&bareflank_pm_notifier_block) != 0) {
+        BFALERT("register_pm_notifier failed\n");
+
+        cpuhp_remove_state_nocalls(g_cpuhp_state);
+        common_fini();
+        misc_deregister(&bareflank_dev);
+        unregister_reboot_notifier(&bareflank_notifier_block);
+
+        return -EPERM;
+    }
+
     BFDEBUG("dev_init succeeded\n");
     return 0;
 }
@@ -377,7 +860,12 @@ dev_init(void)
 void
 dev_exit(void)
 {
+    unregister_pm_notifier(&bareflank_pm_notifier_block);
+    cpuhp_remove_state_nocalls(g_cpuhp_state);
+
+    cpus_read_lock();
     common_fini();
+    cpus_read_unlock();
 
     misc_deregister(&bareflank_dev);
     unregister_reboot_notifier(&bareflank_notifier_block);
@@ -31,10 +31,14 @@
 #include <linux/version.h>
 #include <linux/cpumask.h>
 #include <linux/sched.h>
+#include <linux/smp.h>
 #include <linux/kallsyms.h>
 
 #if defined(BF_AARCH64)
 #   include <asm/io.h>
+#else
+#   include <asm/tsc.h>
+#   include <linux/ktime.h>
 #endif
 
 #include <asm/tlbflush.h>
@@ -156,7 +160,7 @@ platform_stop(void)
 int64_t
 platform_num_cpus(void)
 {
-    int64_t num_cpus = num_online_cpus();
+    int64_t num_cpus = nr_cpu_ids;
 
     if (num_cpus < 0) {
         return 0;
@@ -165,6 +169,16 @@ platform_num_cpus(void)
     return num_cpus;
 }
 
+int64_t
+platform_cpu_online(int64_t cpuid)
+{
+    if (cpuid < 0 || cpuid >= nr_cpu_ids) {
+        return 0;
+    }
+
+    return cpu_online(cpuid) ? 1 : 0;
+}
+
 int64_t
 platform_set_affinity(int64_t affinity)
 {
@@ -189,6 +203,13 @@ platform_restore_affinity(int64_t affinity)
     bfignored(affinity);
 }
 
+int64_t
+platform_call_on_each_cpu(platform_cpu_func_t func, void *arg)
+{
+    on_each_cpu(func, arg, 1);
+    return BF_SUCCESS;
+}
+
 int64_t
 platform_get_current_cpu_num(void)
 {
@@ -224,8 +245,22 @@ platform_unload_info(struct platform_info_t *info)
 int64_t
 platform_populate_info(struct platform_info_t *info)
 {
+    unsigned long flags;
+
     if (info) {
         platform_memset(info, 0, sizeof(struct platform_info_t));
+
+        /*
+         * The TSC and the wall-clock time are read with interrupts disabled
+         * so that they describe the same point in time.
+         */
+
+        local_irq_save(flags);
+        info->tsc_info.tsc = rdtsc();
+        info->tsc_info.wallclock = (uint64_t)ktime_get_real_ns();
+        local_irq_restore(flags);
+
+        info->tsc_info.freq = tsc_khz;
     }
 
     return BF_SUCCESS;
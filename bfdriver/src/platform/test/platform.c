@@ -26,12 +26,28 @@
 
 #ifdef WIN64
 #include <windows.h>
+#define THREAD_LOCAL __declspec(thread)
 #else
+#include <pthread.h>
 #include <sys/mman.h>
+#define THREAD_LOCAL __thread
 #endif
 
 int platform_info_should_fail = 0;
 
+/*
+ * The number of CPUs that are simulated, and the CPU that is currently
+ * executing. platform_call_on_each_cpu() executes func on each simulated CPU,
+ * one at a time, which is enough to exercise the driver's per-CPU logic
+ * (and measure its cost) without a kernel. If platform_concurrent_cpus is
+ * set, each simulated CPU is a thread instead, and func is executed on all
+ * of them at the same time, the same way on_each_cpu() does on Linux.
+ */
+
+int64_t platform_simulated_cpus = 1;
+int platform_concurrent_cpus = 0;
+THREAD_LOCAL int64_t platform_current_cpu = 0;
+
 #define PAGE_ROUND_UP(x) ( (((uintptr_t)(x)) + MAX_PAGE_SIZE-1)  & (~(MAX_PAGE_SIZE-1)) )
 
 void *
@@ -98,7 +114,11 @@ platform_stop(void)
 
 int64_t
 platform_num_cpus(void)
-{ return 1; }
+{ return platform_simulated_cpus; }
+
+int64_t
+platform_cpu_online(int64_t cpuid)
+{ return cpuid >= 0 && cpuid < platform_simulated_cpus ? 1 : 0; }
 
 int64_t
 platform_set_affinity(int64_t affinity)
@@ -111,9 +131,119 @@ void
 platform_restore_affinity(int64_t affinity)
 { bfignored(affinity); }
 
+struct platform_cpu_t {
+    platform_cpu_func_t func;
+    void *arg;
+    int64_t cpuid;
+};
+
+static void
+private_run_on_cpu(struct platform_cpu_t *cpu)
+{
+    platform_current_cpu = cpu->cpuid;
+    cpu->func(cpu->arg);
+}
+
+#ifdef WIN64
+
+static DWORD WINAPI
+private_cpu_thread(LPVOID arg)
+{
+    private_run_on_cpu((struct platform_cpu_t *)arg);
+    return 0;
+}
+
+#else
+
+static void *
+private_cpu_thread(void *arg)
+{
+    private_run_on_cpu((struct platform_cpu_t *)arg);
+    return 0;
+}
+
+#endif
+
+/*
+ * A CPU whose thread cannot be created is skipped, which the driver reports
+ * the same way as a CPU that func never ran on.
+ */
+
+static int64_t
+private_call_on_each_cpu_concurrently(platform_cpu_func_t func, void *arg)
+{
+    int64_t i;
+    int created = 0;
+    int64_t num_threads = 0;
+    int64_t ret = BF_SUCCESS;
+
+#ifdef WIN64
+    HANDLE *threads = calloc((size_t)platform_simulated_cpus, sizeof(HANDLE));
+#else
+    pthread_t *threads = calloc((size_t)platform_simulated_cpus, sizeof(pthread_t));
+#endif
+
+    struct platform_cpu_t *cpus = calloc((size_t)platform_simulated_cpus, sizeof(struct platform_cpu_t));
+
+    if (threads == 0 || cpus == 0) {
+        free(threads);
+        free(cpus);
+        return BF_ERROR_OUT_OF_MEMORY;
+    }
+
+    for (i = 0; i < platform_simulated_cpus; i++) {
+        cpus[i].func = func;
+        cpus[i].arg = arg;
+        cpus[i].cpuid = i;
+
+#ifdef WIN64
+        threads[i] = CreateThread(0, 0, private_cpu_thread, &cpus[i], 0, 0);
+        created = threads[i] != 0;
+#else
+        created = pthread_create(&threads[i], 0, private_cpu_thread, &cpus[i]) == 0;
+#endif
+
+        if (created == 0) {
+            ret = BF_ERROR_UNKNOWN;
+            break;
+        }
+
+        num_threads++;
+    }
+
+    for (i = 0; i < num_threads; i++) {
+#ifdef WIN64
+        WaitForSingleObject(threads[i], INFINITE);
+        CloseHandle(threads[i]);
+#else
+        pthread_join(threads[i], 0);
+#endif
+    }
+
+    free(threads);
+    free(cpus);
+
+    return ret;
+}
+
+int64_t
+platform_call_on_each_cpu(platform_cpu_func_t func, void *arg)
+{
+    if (platform_concurrent_cpus != 0) {
+        return private_call_on_each_cpu_concurrently(func, arg);
+    }
+
+    for (platform_current_cpu = 0; platform_current_cpu < platform_simulated_cpus; platform_current_cpu++) {
+        func(arg);
+    }
+
+    platform_current_cpu = 0;
+    return BF_SUCCESS;
+}
+
 int64_t
 platform_get_current_cpu_num(void)
-{ return 0; }
+{ return platform_current_cpu; }
 
 void
 platform_restore_preemption(void)
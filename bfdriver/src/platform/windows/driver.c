@@ -87,9 +87,16 @@ bareflankEvtDeviceD0Entry(
     _In_ WDF_POWER_DEVICE_STATE PreviousState
 )
 {
+    int64_t ret;
+
     UNREFERENCED_PARAMETER(Device);
     UNREFERENCED_PARAMETER(PreviousState);
 
+    ret = common_resume_vmm();
+    if (ret != BF_SUCCESS) {
+        BFALERT("bareflankEvtDeviceD0Entry: common_resume_vmm failed: %p - %s\n", (void *)ret, ec_to_str(ret));
+    }
+
     BFDEBUG("bareflankEvtDeviceD0Entry: success\n");
     return STATUS_SUCCESS;
 }
@@ -100,10 +107,25 @@ bareflankEvtDeviceD0Exit(
     _In_ WDF_POWER_DEVICE_STATE TargetState
 )
 {
+    int64_t ret;
+
     UNREFERENCED_PARAMETER(Device);
-    UNREFERENCED_PARAMETER(TargetState);
 
-    common_fini();
+    /*
+     * If the system is going to sleep (or hibernate), the VMM is only
+     * suspended, and is resumed by bareflankEvtDeviceD0Entry(). Otherwise
+     * the device is being removed, and the VMM is torn down.
+     */
+
+    if (TargetState == WdfPowerDeviceD3Final) {
+        common_fini();
+    }
+    else {
+        ret = common_suspend_vmm();
+        if (ret != BF_SUCCESS) {
+            BFALERT("bareflankEvtDeviceD0Exit: common_suspend_vmm failed: %p - %s\n", (void *)ret, ec_to_str(ret));
+        }
+    }
 
     BFDEBUG("bareflankEvtDeviceD0Entry: success\n");
     return STATUS_SUCCESS;
@@ -18,6 +18,7 @@
  */
 
 #include <ntddk.h>
+#include <intrin.h>
 
 #include <bfdebug.h>
 #include <bfplatform.h>
@@ -137,6 +138,12 @@ platform_num_cpus()
     return (int64_t)KeQueryActiveProcessorCount(&k_affin);
 }
 
+int64_t
+platform_cpu_online(int64_t cpuid)
+{
+    return cpuid >= 0 && cpuid < platform_num_cpus() ? 1 : 0;
+}
+
 int64_t
 platform_set_affinity(int64_t affinity)
 {
@@ -150,22 +157,157 @@ platform_restore_affinity(int64_t affinity)
     KeRevertToUserAffinityThreadEx((KAFFINITY)(affinity));
 }
 
+/*
+ * Each CPU is given a DPC that targets it, which executes the function on
+ * that CPU at DISPATCH_LEVEL. All of the DPCs are queued before waiting on
+ * any of them, so the CPUs execute the function at the same time.
+ */
+
+struct platform_cpu_call_t {
+    KDPC dpc;
+    KEVENT done;
+    platform_cpu_func_t func;
+    void *arg;
+};
+
+static VOID
+platform_cpu_call_dpc(PKDPC dpc, PVOID context, PVOID arg1, PVOID arg2)
+{
+    struct platform_cpu_call_t *call = (struct platform_cpu_call_t *)context;
+
+    UNREFERENCED_PARAMETER(dpc);
+    UNREFERENCED_PARAMETER(arg1);
+    UNREFERENCED_PARAMETER(arg2);
+
+    call->func(call->arg);
+    KeSetEvent(&call->done, IO_NO_INCREMENT, FALSE);
+}
+
+int64_t
+platform_call_on_each_cpu(platform_cpu_func_t func, void *arg)
+{
+    ULONG i;
+    ULONG queued;
+    NTSTATUS status;
+    PROCESSOR_NUMBER number;
+    struct platform_cpu_call_t *calls;
+
+    int64_t ret = BF_SUCCESS;
+    ULONG num_cpus = (ULONG)platform_num_cpus();
+
+    calls = (struct platform_cpu_call_t *)platform_alloc_rw(sizeof(struct platform_cpu_call_t) * num_cpus);
+    if (calls == nullptr) {
+        return BF_ERROR_OUT_OF_MEMORY;
+    }
+
+    for (queued = 0; queued < num_cpus; queued++) {
+
+        status = KeGetProcessorNumberFromIndex(queued, &number);
+        if (!NT_SUCCESS(status)) {
+            ret = BF_ERROR_UNKNOWN;
+            break;
+        }
+
+        calls[queued].func = func;
+        calls[queued].arg = arg;
+
+        KeInitializeEvent(&calls[queued].done, NotificationEvent, FALSE);
+        KeInitializeDpc(&calls[queued].dpc, platform_cpu_call_dpc, &calls[queued]);
+
+        status = KeSetTargetProcessorDpcEx(&calls[queued].dpc, &number);
+        if (!NT_SUCCESS(status)) {
+            ret = BF_ERROR_UNKNOWN;
+            break;
+        }
+
+        KeInsertQueueDpc(&calls[queued].dpc, nullptr, nullptr);
+    }
+
+    for (i = 0; i < queued; i++) {
+        KeWaitForSingleObject(&calls[i].done, Executive, KernelMode, FALSE, nullptr);
+    }
+
+    platform_free_rw(calls, sizeof(struct platform_cpu_call_t) * num_cpus);
+    return ret;
+}
+
+/*
+ * Windows does not disable preemption when the current CPU number is read,
+ * so the IRQL is raised to DISPATCH_LEVEL instead, which keeps the thread on
+ * the current CPU while it is using that CPU's VMM stack. The previous IRQL
+ * is stored per CPU, as the thread cannot move until it is restored.
+ */
+
+#define MAX_PLATFORM_CPUS 2048
+
+static KIRQL g_old_irql[MAX_PLATFORM_CPUS];
+
 int64_t
 platform_get_current_cpu_num(void)
 {
-    return KeGetCurrentProcessorNumberEx(nullptr);
+    KIRQL irql;
+    ULONG cpuid;
+
+    KeRaiseIrql(DISPATCH_LEVEL, &irql);
+    cpuid = KeGetCurrentProcessorNumberEx(nullptr);
+
+    if (cpuid < MAX_PLATFORM_CPUS) {
+        g_old_irql[cpuid] = irql;
+    }
+    else {
+        KeLowerIrql(irql);
+    }
+
+    return cpuid;
 }
 
 void
 platform_restore_preemption(void)
 {
+    ULONG cpuid = KeGetCurrentProcessorNumberEx(nullptr);
+
+    if (cpuid < MAX_PLATFORM_CPUS) {
+        KeLowerIrql(g_old_irql[cpuid]);
+    }
 }
 
+/*
+ * Windows does not provide the frequency of the TSC, so it is measured
+ * against the performance counter, whose frequency is known. The system
+ * time is in 100ns units since 1601, and is converted to the Unix epoch.
+ */
+
+#define TSC_CALIBRATION_US 10000
+#define FILETIME_UNIX_EPOCH 116444736000000000ULL
+
 int64_t
 platform_populate_info(struct platform_info_t *info)
 {
+    KIRQL irql;
+    uint64_t tsc1, tsc2;
+    LARGE_INTEGER qpc1, qpc2, freq, time;
+
     if (info) {
         platform_memset(info, 0, sizeof(struct platform_info_t));
+
+        qpc1 = KeQueryPerformanceCounter(&freq);
+        tsc1 = __rdtsc();
+        KeStallExecutionProcessor(TSC_CALIBRATION_US);
+        qpc2 = KeQueryPerformanceCounter(nullptr);
+        tsc2 = __rdtsc();
+
+        if (qpc2.QuadPart > qpc1.QuadPart) {
+            info->tsc_info.freq =
+                ((tsc2 - tsc1) * (uint64_t)freq.QuadPart) /
+                ((uint64_t)(qpc2.QuadPart - qpc1.QuadPart) * 1000);
+        }
+
+        KeRaiseIrql(HIGH_LEVEL, &irql);
+        info->tsc_info.tsc = __rdtsc();
+        KeQuerySystemTimePrecise(&time);
+        KeLowerIrql(irql);
+
+        info->tsc_info.wallclock = ((uint64_t)time.QuadPart - FILETIME_UNIX_EPOCH) * 100;
     }
 
     return BF_SUCCESS;
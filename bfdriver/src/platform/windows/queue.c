@@ -166,23 +166,51 @@ failure:
 }
 
 static long
-ioctl_dump_vmm(struct debug_ring_resources_t *user_drr)
+ioctl_dump_vmm(struct debug_ring_resources_t *user_drr, uint64_t size)
 {
     int64_t ret;
     struct debug_ring_resources_t *drr = 0;
 
+    if (user_drr == 0) {
+        BFALERT("IOCTL_DUMP_VMM: failed with drr == NULL\n");
+        return BF_IOCTL_FAILURE;
+    }
+
     ret = common_dump_vmm(&drr, g_vcpuid);
     if (ret != BF_SUCCESS) {
         BFALERT("IOCTL_DUMP_VMM: common_dump_vmm failed: %p - %s\n", (void *)ret, ec_to_str(ret));
         return BF_IOCTL_FAILURE;
     }
 
-    platform_memcpy(user_drr, drr, sizeof(struct debug_ring_resources_t));
+    if (debug_ring_total_size(drr->len) > size) {
+        BFALERT("IOCTL_DUMP_VMM: the provided buffer is too small\n");
+        return BF_IOCTL_FAILURE;
+    }
+
+    platform_memcpy(user_drr, drr, debug_ring_total_size(drr->len));
 
     BFDEBUG("IOCTL_DUMP_VMM: succeeded\n");
     return BF_IOCTL_SUCCESS;
 }
 
+static long
+ioctl_dump_trace(struct trace_ring_resources_t *user_trr)
+{
+    int64_t ret;
+    struct trace_ring_resources_t *trr = 0;
+
+    ret = common_dump_trace(&trr, g_vcpuid);
+    if (ret != BF_SUCCESS) {
+        BFALERT("IOCTL_DUMP_TRACE: common_dump_trace failed: %p - %s\n", (void *)ret, ec_to_str(ret));
+        return BF_IOCTL_FAILURE;
+    }
+
+    platform_memcpy(user_trr, trr, sizeof(struct trace_ring_resources_t));
+
+    BFDEBUG("IOCTL_DUMP_TRACE: succeeded\n");
+    return BF_IOCTL_SUCCESS;
+}
+
 static long
 ioctl_vmm_status(int64_t *status)
 {
@@ -209,6 +237,66 @@ ioctl_set_vcpuid(uint64_t *vcpuid)
     return BF_IOCTL_SUCCESS;
 }
 
+static long
+ioctl_set_debug_level(struct debug_level_t *level)
+{
+    int64_t ret;
+
+    if (level == 0) {
+        BFALERT("IOCTL_SET_DEBUG_LEVEL: failed with level == NULL\n");
+        return BF_IOCTL_FAILURE;
+    }
+
+    ret = common_set_debug_level(level->subsystem, level->level);
+    if (ret != BF_SUCCESS) {
+        BFALERT("IOCTL_SET_DEBUG_LEVEL: common_set_debug_level failed: %p - %s\n", (void *)ret, ec_to_str(ret));
+        return BF_IOCTL_FAILURE;
+    }
+
+    BFDEBUG("IOCTL_SET_DEBUG_LEVEL: succeeded\n");
+    return BF_IOCTL_SUCCESS;
+}
+
+static long
+ioctl_set_debug_ring_size(uint64_t *size)
+{
+    int64_t ret;
+
+    if (size == 0) {
+        BFALERT("IOCTL_SET_DEBUG_RING_SIZE: failed with size == NULL\n");
+        return BF_IOCTL_FAILURE;
+    }
+
+    ret = common_set_debug_ring_size(*size);
+    if (ret != BF_SUCCESS) {
+        BFALERT("IOCTL_SET_DEBUG_RING_SIZE: common_set_debug_ring_size failed: %p - %s\n", (void *)ret, ec_to_str(ret));
+        return BF_IOCTL_FAILURE;
+    }
+
+    BFDEBUG("IOCTL_SET_DEBUG_RING_SIZE: succeeded\n");
+    return BF_IOCTL_SUCCESS;
+}
+
+static long
+ioctl_get_tsc_info(struct tsc_info_t *info)
+{
+    int64_t ret;
+
+    if (info == 0) {
+        BFALERT("IOCTL_GET_TSC_INFO: failed with info == NULL\n");
+        return BF_IOCTL_FAILURE;
+    }
+
+    ret = common_get_tsc_info(info);
+    if (ret != BF_SUCCESS) {
+        BFALERT("IOCTL_GET_TSC_INFO: common_get_tsc_info failed: %p - %s\n", (void *)ret, ec_to_str(ret));
+        return BF_IOCTL_FAILURE;
+    }
+
+    BFDEBUG("IOCTL_GET_TSC_INFO: succeeded\n");
+    return BF_IOCTL_SUCCESS;
+}
+
 NTSTATUS
 bareflankQueueInitialize(
     _In_ WDFDEVICE Device
@@ -294,7 +382,7 @@ bareflankEvtIoDeviceControl(
             break;
 
         case IOCTL_DUMP_VMM:
-            ret = ioctl_dump_vmm((struct debug_ring_resources_t *)out);
+            ret = ioctl_dump_vmm((struct debug_ring_resources_t *)out, (uint64_t)out_size);
             break;
 
         case IOCTL_VMM_STATUS:
@@ -305,6 +393,22 @@ bareflankEvtIoDeviceControl(
             ret = ioctl_set_vcpuid((uint64_t *)in);
             break;
 
+        case IOCTL_DUMP_TRACE:
+            ret = ioctl_dump_trace((struct trace_ring_resources_t *)out);
+            break;
+
+        case IOCTL_SET_DEBUG_LEVEL:
+            ret = ioctl_set_debug_level((struct debug_level_t *)in);
+            break;
+
+        case IOCTL_SET_DEBUG_RING_SIZE:
+            ret = ioctl_set_debug_ring_size((uint64_t *)in);
+            break;
+
+        case IOCTL_GET_TSC_INFO:
+            ret = ioctl_get_tsc_info((struct tsc_info_t *)out);
+            break;
+
         default:
             goto FAILURE;
     }
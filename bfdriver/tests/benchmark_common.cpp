@@ -0,0 +1,269 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include <catch/catch.hpp>
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+#include <numeric>
+#include <iomanip>
+#include <bfbenchmark.h>
+#include <bfdriverinterface.h>
+
+#include <common.h>
+#include <test_support.h>
+
+extern "C" int64_t platform_simulated_cpus;
+extern "C" int platform_concurrent_cpus;
+extern "C" struct bfelf_loader_t g_loader;
+extern "C" _start_t _start_func;
+
+// The dummy VMM counts the number of times that it is called with each
+// request (see g_num_requests in dummy_main.cpp). The counts can only be
+// read while the VMM is loaded as separate modules, as a bundle has no
+// loader to resolve the symbol with. The counts are deterministic, even
+// when the test platform runs the CPUs concurrently.
+//
+
+using requests_t = std::array<uint64_t, BF_REQUEST_VMM_SUSPEND + 1>;
+
+static requests_t
+num_requests()
+{
+    requests_t requests{};
+    std::atomic<uint64_t> *counts = nullptr;
+
+    if (common_vmm_status() == VMM_UNLOADED) {
+        return requests;
+    }
+
+    auto ret = bfelf_loader_resolve_symbol(
+                   &g_loader, "g_num_requests", reinterpret_cast<void **>(&counts));
+
+    if (ret == BFELF_SUCCESS) {
+        std::copy(counts, counts + requests.size(), requests.begin());
+    }
+
+    return requests;
+}
+
+static uint64_t
+total(const requests_t &requests)
+{ return std::accumulate(requests.begin(), requests.end(), 0ULL); }
+
+template<typename F>
+static requests_t
+measure(const char *name, F func)
+{
+    int64_t ret = BF_ERROR_UNKNOWN;
+    auto before = num_requests();
+
+    auto ns = benchmark([&] {
+        ret = func();
+    });
+
+    auto after = num_requests();
+    CHECK(ret == BF_SUCCESS);
+
+    requests_t calls{};
+    for (auto i = 0U; i < calls.size(); i++) {
+        calls.at(i) = after.at(i) - std::min(before.at(i), after.at(i));
+    }
+
+    std::cout << std::setw(10) << name << ": "
+              << std::setw(12) << ns << " ns, "
+              << std::setw(6) << total(calls) << " vmm calls\n";
+
+    return calls;
+}
+
+// Runs each operation once, and checks that it entered the VMM the expected
+// number of times. The per-CPU operations must enter the VMM exactly once on
+// each CPU. Returns the number of calls made by the load that are not per
+// CPU, which must not depend on the number of CPUs either.
+//
+
+static uint64_t
+benchmark_vmm(const char *name, int64_t cpus)
+{
+    std::cout << name << " (" << cpus << " cpus):\n";
+    auto ncpus = static_cast<uint64_t>(cpus);
+
+    auto load = measure("load", common_load_vmm);
+    auto start = measure("start", common_start_vmm);
+    auto suspend = measure("suspend", common_suspend_vmm);
+    auto resume = measure("resume", common_resume_vmm);
+    auto stop = measure("stop", common_stop_vmm);
+    measure("unload", common_unload_vmm);
+
+    CHECK(common_fini() == BF_SUCCESS);
+
+    if (total(load) == 0) {
+        return 0;
+    }
+
+    CHECK(load.at(BF_REQUEST_INIT) == 1);
+    CHECK(load.at(BF_REQUEST_ADD_MDL) != 0);
+    CHECK(load.at(BF_REQUEST_VMM_PREPARE) == ncpus);
+    CHECK(total(load) == 1 + load.at(BF_REQUEST_ADD_MDL) + ncpus);
+
+    CHECK(start.at(BF_REQUEST_VMM_INIT) == ncpus);
+    CHECK(total(start) == ncpus);
+
+    CHECK(suspend.at(BF_REQUEST_VMM_SUSPEND) == ncpus);
+    CHECK(total(suspend) == ncpus);
+
+    CHECK(resume.at(BF_REQUEST_VMM_INIT) == ncpus);
+    CHECK(total(resume) == ncpus);
+
+    CHECK(stop.at(BF_REQUEST_VMM_FINI) == ncpus);
+    CHECK(total(stop) == ncpus);
+
+    return total(load) - ncpus;
+}
+
+static uint64_t
+benchmark_modules(const std::vector<std::string> &filenames, int64_t cpus, int concurrent = 0)
+{
+    platform_simulated_cpus = cpus;
+    platform_concurrent_cpus = concurrent;
+    common_init();
+
+    binaries_info info{&g_file, filenames, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    auto calls = benchmark_vmm(concurrent != 0 ? "concurrent" : filenames.back().c_str(), cpus);
+    platform_simulated_cpus = 1;
+    platform_concurrent_cpus = 0;
+
+    CHECK(calls != 0);
+    return calls;
+}
+
+static void
+benchmark_bundle(const std::vector<std::string> &filenames, int64_t cpus)
+{
+    platform_simulated_cpus = cpus;
+    common_init();
+
+    binaries_info info{&g_file, filenames, false};
+    auto bundle = bfelf_bundle_create(info);
+
+    REQUIRE(common_add_module(bundle.data(), bundle.size()) == BF_SUCCESS);
+
+    benchmark_vmm("bundle", cpus);
+    platform_simulated_cpus = 1;
+}
+
+// The dummy VMM returns right away, but starting or stopping the VMM on a
+// real CPU takes a while (VMXON, VMLAUNCH, ...). Adding a fixed cost to each
+// CPU shows whether the CPUs are started one at a time or concurrently.
+//
+
+static _start_t g_start_func = nullptr;
+
+static int64_t
+slow_start_func(char *stack, const struct crt_info_t *info)
+{
+    if (info->request == BF_REQUEST_VMM_INIT || info->request == BF_REQUEST_VMM_FINI) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    return g_start_func(stack, info);
+}
+
+// The time it takes to start and stop the CPUs depends on how the host
+// schedules the threads of the test platform, so it is only reported. The
+// number of times each CPU entered the VMM is checked instead.
+//
+
+static void
+benchmark_start(int64_t cpus, int concurrent)
+{
+    platform_simulated_cpus = cpus;
+    platform_concurrent_cpus = concurrent;
+    common_init();
+
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    REQUIRE(common_load_vmm() == BF_SUCCESS);
+
+    g_start_func = _start_func;
+    _start_func = slow_start_func;
+
+    std::cout << (concurrent != 0 ? "concurrent" : "sequential")
+              << " (" << cpus << " cpus, 1 ms per cpu):\n";
+
+    auto start = measure("start", common_start_vmm);
+    auto stop = measure("stop", common_stop_vmm);
+
+    _start_func = g_start_func;
+    CHECK(common_fini() == BF_SUCCESS);
+
+    platform_simulated_cpus = 1;
+    platform_concurrent_cpus = 0;
+
+    auto ncpus = static_cast<uint64_t>(cpus);
+
+    CHECK(start.at(BF_REQUEST_VMM_INIT) == ncpus);
+    CHECK(total(start) == ncpus);
+
+    CHECK(stop.at(BF_REQUEST_VMM_FINI) == ncpus);
+    CHECK(total(stop) == ncpus);
+}
+
+TEST_CASE("common benchmark: cpus")
+{
+    auto calls = benchmark_modules(g_filenames_success, 1);
+
+    CHECK(benchmark_modules(g_filenames_success, 8) == calls);
+    CHECK(benchmark_modules(g_filenames_success, 64) == calls);
+}
+
+TEST_CASE("common benchmark: concurrent cpus")
+{
+    auto calls = benchmark_modules(g_filenames_success, 1);
+
+    CHECK(benchmark_modules(g_filenames_success, 8, 1) == calls);
+    CHECK(benchmark_modules(g_filenames_success, 64, 1) == calls);
+}
+
+TEST_CASE("common benchmark: concurrent start")
+{
+    benchmark_start(64, 0);
+    benchmark_start(64, 1);
+}
+
+TEST_CASE("common benchmark: large module")
+{
+    benchmark_modules(g_filenames_large, 8);
+}
+
+TEST_CASE("common benchmark: large bundle")
+{
+    benchmark_bundle(g_filenames_large, 8);
+}
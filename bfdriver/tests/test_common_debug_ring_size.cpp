@@ -0,0 +1,77 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include <catch/catch.hpp>
+
+#include <bfsupport.h>
+#include <bfdriverinterface.h>
+#include <bfdebugringinterface.h>
+
+#include <common.h>
+#include <test_support.h>
+
+extern "C" struct crt_info_t g_info;
+
+TEST_CASE("common_set_debug_ring_size: invalid size")
+{
+    CHECK(common_set_debug_ring_size(0) == BF_ERROR_INVALID_ARG);
+    CHECK(common_set_debug_ring_size(DEBUG_RING_MIN_SIZE + 1) == BF_ERROR_INVALID_ARG);
+    CHECK(common_set_debug_ring_size(DEBUG_RING_MIN_SIZE >> 1) == BF_ERROR_INVALID_ARG);
+    CHECK(common_set_debug_ring_size(DEBUG_RING_MAX_SIZE << 1) == BF_ERROR_INVALID_ARG);
+}
+
+TEST_CASE("common_set_debug_ring_size: loaded")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_set_debug_ring_size(DEBUG_RING_MIN_SIZE) == BF_ERROR_VMM_INVALID_STATE);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_set_debug_ring_size: success")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_set_debug_ring_size(DEBUG_RING_MAX_SIZE) == BF_SUCCESS);
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(g_info.platform_info.debug_ring_size == DEBUG_RING_MAX_SIZE);
+    CHECK(common_unload_vmm() == BF_SUCCESS);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_set_debug_ring_size: reset on unload")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(g_info.platform_info.debug_ring_size == DEBUG_RING_SIZE);
+    CHECK(common_fini() == BF_SUCCESS);
+}
@@ -25,6 +25,7 @@
 #include <test_support.h>
 
 debug_ring_resources_t *g_drr;
+trace_ring_resources_t *g_trr;
 
 TEST_CASE("common_add_module: invalid drr")
 {
@@ -61,3 +62,68 @@ TEST_CASE("common_add_module: success")
     CHECK(common_dump_vmm(&g_drr, 0) == BF_SUCCESS);
     CHECK(common_fini() == BF_SUCCESS);
 }
+
+TEST_CASE("common_dump_trace: invalid trr")
+{
+    CHECK(common_dump_trace(nullptr, 0) == BF_ERROR_INVALID_ARG);
+}
+
+TEST_CASE("common_dump_trace: unloaded")
+{
+    CHECK(common_dump_trace(&g_trr, 0) == BF_ERROR_VMM_INVALID_STATE);
+}
+
+TEST_CASE("common_dump_trace: get trr fails")
+{
+    binaries_info info{&g_file, g_filenames_get_drr_fails, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_dump_trace(&g_trr, 0) == ENTRY_ERROR_UNKNOWN);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_dump_trace: success")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_dump_trace(&g_trr, 0) == BF_SUCCESS);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_get_tsc_info: invalid info")
+{
+    CHECK(common_get_tsc_info(nullptr) == BF_ERROR_INVALID_ARG);
+}
+
+TEST_CASE("common_get_tsc_info: unloaded")
+{
+    tsc_info_t info{};
+    CHECK(common_get_tsc_info(&info) == BF_ERROR_VMM_INVALID_STATE);
+}
+
+TEST_CASE("common_get_tsc_info: success")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    tsc_info_t tsc_info{1, 2, 3};
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_get_tsc_info(&tsc_info) == BF_SUCCESS);
+    CHECK(tsc_info.freq == 0);
+    CHECK(tsc_info.tsc == 0);
+    CHECK(tsc_info.wallclock == 0);
+    CHECK(common_fini() == BF_SUCCESS);
+}
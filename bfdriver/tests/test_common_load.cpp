@@ -19,6 +19,9 @@
 #include <catch/catch.hpp>
 #include <hippomocks.h>
 
+#include <vector>
+
+#include <bfmemory.h>
 #include <bfdriverinterface.h>
 
 #include <common.h>
@@ -174,8 +177,39 @@ TEST_CASE("common_load_vmm: add tss mdl fails")
     CHECK(common_fini() == BF_SUCCESS);
 }
 
+TEST_CASE("common_load_vmm: prepare fails")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    MockRepository mocks;
+    mocks.OnCallFunc(platform_call_on_each_cpu).Return(BF_ERROR_UNKNOWN);
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_vmm_status() == VMM_LOADED);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
 extern int platform_info_should_fail;
 
+TEST_CASE("common_load_vmm: unknown cpu")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    MockRepository mocks;
+    mocks.OnCallFunc(platform_get_current_cpu_num).Return(platform_num_cpus());
+
+    CHECK(common_load_vmm() == BF_ERROR_UNKNOWN);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
 TEST_CASE("common_load_vmm: populate_platform_info fails")
 {
     auto ___ = gsl::finally([&] {
@@ -194,4 +228,168 @@ TEST_CASE("common_load_vmm: populate_platform_info fails")
     CHECK(common_fini() == BF_SUCCESS);
 }
 
+TEST_CASE("common_load_vmm: bundle")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+    auto bundle = bfelf_bundle_create(info);
+
+    REQUIRE(common_add_module(bundle.data(), bundle.size()) == BF_SUCCESS);
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_start_vmm() == BF_SUCCESS);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_load_vmm: bundle add modules mdl fails")
+{
+    binaries_info info{&g_file, g_filenames_add_mdl_fails, false};
+    auto bundle = bfelf_bundle_create(info);
+
+    REQUIRE(common_add_module(bundle.data(), bundle.size()) == BF_SUCCESS);
+
+    CHECK(common_load_vmm() == ENTRY_ERROR_UNKNOWN);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_load_vmm: invalid bundle")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+    auto bundle = bfelf_bundle_create(info);
+
+    reinterpret_cast<bfelf_bundle_header *>(bundle.data())->version = 0;
+
+    REQUIRE(common_add_module(bundle.data(), bundle.size()) == BF_SUCCESS);
+
+    CHECK(common_load_vmm() == BFELF_ERROR_UNSUPPORTED_FILE);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_load_vmm: bundle alloc exec fails")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+    auto bundle = bfelf_bundle_create(info);
+
+    REQUIRE(common_add_module(bundle.data(), bundle.size()) == BF_SUCCESS);
+
+    MockRepository mocks;
+    mocks.ExpectCallFunc(platform_alloc_rwe).Return(nullptr);
+
+    CHECK(common_load_vmm() == BF_ERROR_OUT_OF_MEMORY);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+extern "C" int64_t private_add_raw_md_to_memory_manager(uint64_t virt, uint64_t size, uint64_t type);
+extern "C" int64_t private_add_extent_md_to_memory_manager(struct memory_descriptor *md, uint64_t size);
+
+// The test platform's platform_virt_to_phys() returns its input, which
+// makes every range a single extent. This stub skips a physical page after
+// every 4 virtual pages (i.e. 16k), so a range is split into an extent for
+// each 16k of virtual memory that it touches.
+//
+
+struct extent_t {
+    uint64_t virt;
+    uint64_t phys;
+    uint64_t size;
+};
+
+std::vector<extent_t> g_extents;
+
+static void *
+non_contiguous_virt_to_phys(void *virt)
+{
+    auto addr = reinterpret_cast<uintptr_t>(virt);
+    return reinterpret_cast<void *>(addr + ((addr >> 14) << 12));
+}
+
+static int64_t
+add_extent(struct memory_descriptor *md, uint64_t size)
+{
+    g_extents.push_back({md->virt, md->phys, size});
+    return BF_SUCCESS;
+}
+
+static int64_t
+add_extent_fails(struct memory_descriptor *md, uint64_t size)
+{
+    add_extent(md, size);
+    return g_extents.size() > 1 ? MEMORY_MANAGER_FAILURE : BF_SUCCESS;
+}
+
+TEST_CASE("private_add_raw_md_to_memory_manager: empty")
+{
+    g_extents.clear();
+
+    MockRepository mocks;
+    mocks.OnCallFunc(private_add_extent_md_to_memory_manager).Do(add_extent);
+
+    CHECK(private_add_raw_md_to_memory_manager(0x10000, 0, MEMORY_TYPE_R) == BF_SUCCESS);
+    CHECK(g_extents.empty());
+}
+
+TEST_CASE("private_add_raw_md_to_memory_manager: contiguous")
+{
+    g_extents.clear();
+
+    MockRepository mocks;
+    mocks.OnCallFunc(private_add_extent_md_to_memory_manager).Do(add_extent);
+
+    CHECK(private_add_raw_md_to_memory_manager(0x10000, 0x10000, MEMORY_TYPE_R) == BF_SUCCESS);
+
+    REQUIRE(g_extents.size() == 1);
+    CHECK(g_extents[0].virt == 0x10000);
+    CHECK(g_extents[0].phys == 0x10000);
+    CHECK(g_extents[0].size == 0x10000);
+}
+
+TEST_CASE("private_add_raw_md_to_memory_manager: non-contiguous")
+{
+    g_extents.clear();
+
+    MockRepository mocks;
+    mocks.OnCallFunc(platform_virt_to_phys).Do(non_contiguous_virt_to_phys);
+    mocks.OnCallFunc(private_add_extent_md_to_memory_manager).Do(add_extent);
+
+    CHECK(private_add_raw_md_to_memory_manager(0x10000, 0x8000, MEMORY_TYPE_R) == BF_SUCCESS);
+
+    REQUIRE(g_extents.size() == 2);
+    CHECK(g_extents[0].virt == 0x10000);
+    CHECK(g_extents[0].phys == 0x14000);
+    CHECK(g_extents[0].size == 0x4000);
+    CHECK(g_extents[1].virt == 0x14000);
+    CHECK(g_extents[1].phys == 0x19000);
+    CHECK(g_extents[1].size == 0x4000);
+}
+
+TEST_CASE("private_add_raw_md_to_memory_manager: non-contiguous unaligned")
+{
+    g_extents.clear();
+
+    MockRepository mocks;
+    mocks.OnCallFunc(platform_virt_to_phys).Do(non_contiguous_virt_to_phys);
+    mocks.OnCallFunc(private_add_extent_md_to_memory_manager).Do(add_extent);
+
+    CHECK(private_add_raw_md_to_memory_manager(0x12000, 0x5000, MEMORY_TYPE_R) == BF_SUCCESS);
+
+    REQUIRE(g_extents.size() == 2);
+    CHECK(g_extents[0].virt == 0x12000);
+    CHECK(g_extents[0].phys == 0x16000);
+    CHECK(g_extents[0].size == 0x2000);
+    CHECK(g_extents[1].virt == 0x14000);
+    CHECK(g_extents[1].phys == 0x19000);
+    CHECK(g_extents[1].size == 0x3000);
+}
+
+TEST_CASE("private_add_raw_md_to_memory_manager: add fails")
+{
+    g_extents.clear();
+
+    MockRepository mocks;
+    mocks.OnCallFunc(platform_virt_to_phys).Do(non_contiguous_virt_to_phys);
+    mocks.OnCallFunc(private_add_extent_md_to_memory_manager).Do(add_extent_fails);
+
+    CHECK(private_add_raw_md_to_memory_manager(0x10000, 0x10000, MEMORY_TYPE_R) == MEMORY_MANAGER_FAILURE);
+    CHECK(g_extents.size() == 2);
+}
+
 #endif
@@ -94,7 +94,7 @@ TEST_CASE("common_start_vmm: start fails")
     CHECK(common_fini() == BF_SUCCESS);
 }
 
-TEST_CASE("common_start_vmm: set affinity fails")
+TEST_CASE("common_start_vmm: call on each cpu fails")
 {
     binaries_info info{&g_file, g_filenames_success, false};
 
@@ -103,11 +103,126 @@ TEST_CASE("common_start_vmm: set affinity fails")
     }
 
     MockRepository mocks;
-    mocks.OnCallFunc(platform_set_affinity).Return(BF_ERROR_UNKNOWN);
+    mocks.OnCallFunc(platform_call_on_each_cpu).Return(BF_ERROR_UNKNOWN);
 
     CHECK(common_load_vmm() == BF_SUCCESS);
     CHECK(common_start_vmm() == BF_ERROR_UNKNOWN);
     CHECK(common_fini() == BF_SUCCESS);
 }
 
+TEST_CASE("common_start_vmm: cpu not called")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    MockRepository mocks;
+    mocks.OnCallFunc(platform_call_on_each_cpu).Return(BF_SUCCESS);
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_start_vmm() == BF_ERROR_UNKNOWN);
+    CHECK(common_vmm_status() == VMM_LOADED);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_start_cpu: not running")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_start_cpu(0) == BF_SUCCESS);
+    CHECK(common_vmm_status() == VMM_LOADED);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_start_cpu: invalid cpu")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_start_vmm() == BF_SUCCESS);
+    CHECK(common_start_cpu(-1) == BF_ERROR_INVALID_ARG);
+    CHECK(common_start_cpu(platform_num_cpus()) == BF_ERROR_INVALID_ARG);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_start_cpu: not the current cpu")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_start_vmm() == BF_SUCCESS);
+
+    {
+        MockRepository mocks;
+        mocks.OnCallFunc(platform_get_current_cpu_num).Return(platform_num_cpus());
+
+        CHECK(common_start_cpu(0) == BF_ERROR_INVALID_ARG);
+    }
+
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_start_cpu: already started")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_start_vmm() == BF_SUCCESS);
+    CHECK(common_start_cpu(0) == BF_SUCCESS);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_start_cpu: success")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_start_vmm() == BF_SUCCESS);
+    CHECK(common_stop_cpu(0) == BF_SUCCESS);
+    CHECK(common_start_cpu(0) == BF_SUCCESS);
+    CHECK(common_vmm_status() == VMM_RUNNING);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_start_vmm: no cpus started")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    MockRepository mocks;
+    mocks.OnCallFunc(platform_cpu_online).Return(0);
+    mocks.OnCallFunc(platform_call_on_each_cpu).Return(BF_SUCCESS);
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_start_vmm() == BF_ERROR_UNKNOWN);
+    CHECK(common_vmm_status() == VMM_LOADED);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
 #endif
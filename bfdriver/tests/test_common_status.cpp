@@ -0,0 +1,101 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include <catch/catch.hpp>
+
+#include <bfsupport.h>
+#include <bfdriverinterface.h>
+#include <bfstatusinterface.h>
+
+#include <common.h>
+#include <test_support.h>
+
+extern "C" struct crt_info_t g_info;
+
+static vmm_status_t
+read_status()
+{
+    vmm_status_t *status = nullptr;
+    vmm_status_t copy = {};
+
+    REQUIRE(common_get_status(&status) == BF_SUCCESS);
+    REQUIRE(vmm_status_read(status, &copy) == 1);
+
+    return copy;
+}
+
+TEST_CASE("common_get_status: invalid arg")
+{
+    CHECK(common_get_status(nullptr) == BF_ERROR_INVALID_ARG);
+}
+
+TEST_CASE("common_get_status: not initialized")
+{
+    vmm_status_t *status = nullptr;
+    CHECK(common_get_status(&status) == BF_ERROR_OUT_OF_MEMORY);
+}
+
+TEST_CASE("common_get_status: unloaded")
+{
+    common_init();
+
+    auto status = read_status();
+    CHECK(status.state == VMM_UNLOADED);
+    CHECK(status.num_cpus_started == 0);
+    CHECK(status.memory == 0);
+
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_get_status: follows the vmm")
+{
+    common_init();
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(read_status().state == VMM_LOADED);
+    CHECK(read_status().memory != 0);
+    CHECK(g_info.platform_info.status != 0);
+
+    CHECK(common_start_vmm() == BF_SUCCESS);
+    CHECK(read_status().state == VMM_RUNNING);
+    CHECK(read_status().num_cpus_started == read_status().num_cpus);
+
+    CHECK(common_stop_vmm() == BF_SUCCESS);
+    CHECK(read_status().state == VMM_LOADED);
+    CHECK(read_status().num_cpus_started == 0);
+
+    CHECK(common_unload_vmm() == BF_SUCCESS);
+    CHECK(read_status().state == VMM_UNLOADED);
+    CHECK(read_status().memory == 0);
+
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_get_status: freed by fini")
+{
+    vmm_status_t *status = nullptr;
+
+    common_init();
+    CHECK(common_fini() == BF_SUCCESS);
+    CHECK(common_get_status(&status) == BF_ERROR_OUT_OF_MEMORY);
+}
@@ -112,7 +112,7 @@ TEST_CASE("common_start_vmm: stop fails")
     common_reset();
 }
 
-TEST_CASE("common_stop_vmm: set affinity fails")
+TEST_CASE("common_stop_vmm: call on each cpu fails")
 {
     binaries_info info{&g_file, g_filenames_success, false};
 
@@ -124,7 +124,7 @@ TEST_CASE("common_stop_vmm: set affinity fails")
     CHECK(common_start_vmm() == BF_SUCCESS);
 
     MockRepository mocks;
-    mocks.OnCallFunc(platform_set_affinity).Return(BF_ERROR_UNKNOWN);
+    mocks.OnCallFunc(platform_call_on_each_cpu).Return(BF_ERROR_UNKNOWN);
 
     CHECK(common_stop_vmm() == BF_ERROR_UNKNOWN);
     CHECK(common_fini() == BF_ERROR_VMM_CORRUPTED);
@@ -132,4 +132,66 @@ TEST_CASE("common_stop_vmm: set affinity fails")
     common_reset();
 }
 
+TEST_CASE("common_stop_cpu: not running")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_stop_cpu(0) == BF_SUCCESS);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_stop_cpu: invalid cpu")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_start_vmm() == BF_SUCCESS);
+    CHECK(common_stop_cpu(-1) == BF_ERROR_INVALID_ARG);
+    CHECK(common_stop_cpu(platform_num_cpus()) == BF_ERROR_INVALID_ARG);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_stop_cpu: success")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_start_vmm() == BF_SUCCESS);
+    CHECK(common_stop_cpu(0) == BF_SUCCESS);
+    CHECK(common_stop_cpu(0) == BF_SUCCESS);
+    CHECK(common_stop_vmm() == BF_SUCCESS);
+    CHECK(common_vmm_status() == VMM_LOADED);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_stop_cpu: stop fails")
+{
+    binaries_info info{&g_file, g_filenames_vmm_fini_fails, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_start_vmm() == BF_SUCCESS);
+    CHECK(common_stop_cpu(0) == ENTRY_ERROR_UNKNOWN);
+    CHECK(common_vmm_status() == VMM_CORRUPT);
+    CHECK(common_fini() == BF_ERROR_VMM_CORRUPTED);
+
+    common_reset();
+}
+
 #endif
@@ -0,0 +1,215 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include <catch/catch.hpp>
+#include <hippomocks.h>
+
+#include <bfdriverinterface.h>
+#include <bfstatusinterface.h>
+
+#include <common.h>
+#include <test_support.h>
+
+#ifdef _HIPPOMOCKS__ENABLE_CFUNC_MOCKING_SUPPORT
+
+static uint64_t
+num_cpus_started()
+{
+    vmm_status_t *status = nullptr;
+    vmm_status_t copy = {};
+
+    REQUIRE(common_get_status(&status) == BF_SUCCESS);
+    REQUIRE(vmm_status_read(status, &copy) == 1);
+
+    return copy.num_cpus_started;
+}
+
+TEST_CASE("common_suspend_vmm: success")
+{
+    common_init();
+
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_start_vmm() == BF_SUCCESS);
+    CHECK(common_suspend_vmm() == BF_SUCCESS);
+    CHECK(common_vmm_status() == VMM_RUNNING);
+    CHECK(num_cpus_started() == 0);
+    CHECK(common_resume_vmm() == BF_SUCCESS);
+    CHECK(common_vmm_status() == VMM_RUNNING);
+    CHECK(num_cpus_started() == 1);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_suspend_vmm: not running")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_suspend_vmm() == BF_SUCCESS);
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_suspend_vmm() == BF_SUCCESS);
+    CHECK(common_resume_vmm() == BF_SUCCESS);
+    CHECK(common_vmm_status() == VMM_LOADED);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_suspend_vmm: suspend twice")
+{
+    common_init();
+
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_start_vmm() == BF_SUCCESS);
+    CHECK(common_suspend_vmm() == BF_SUCCESS);
+    CHECK(common_suspend_vmm() == BF_SUCCESS);
+    CHECK(common_resume_vmm() == BF_SUCCESS);
+    CHECK(common_resume_vmm() == BF_SUCCESS);
+    CHECK(num_cpus_started() == 1);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_suspend_vmm: suspend fails")
+{
+    binaries_info info{&g_file, g_filenames_vmm_suspend_fails, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_start_vmm() == BF_SUCCESS);
+    CHECK(common_suspend_vmm() == ENTRY_ERROR_UNKNOWN);
+    CHECK(common_vmm_status() == VMM_CORRUPT);
+    CHECK(common_resume_vmm() == BF_ERROR_VMM_CORRUPTED);
+    CHECK(common_suspend_vmm() == BF_ERROR_VMM_CORRUPTED);
+    CHECK(common_fini() == BF_ERROR_VMM_CORRUPTED);
+
+    common_reset();
+}
+
+TEST_CASE("common_suspend_vmm: call on each cpu fails")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_start_vmm() == BF_SUCCESS);
+
+    {
+        MockRepository mocks;
+        mocks.OnCallFunc(platform_call_on_each_cpu).Return(BF_ERROR_UNKNOWN);
+
+        CHECK(common_suspend_vmm() == BF_ERROR_UNKNOWN);
+        CHECK(common_vmm_status() == VMM_CORRUPT);
+    }
+
+    CHECK(common_fini() == BF_ERROR_VMM_CORRUPTED);
+    common_reset();
+}
+
+TEST_CASE("common_resume_vmm: resume fails")
+{
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_start_vmm() == BF_SUCCESS);
+    CHECK(common_suspend_vmm() == BF_SUCCESS);
+
+    {
+        MockRepository mocks;
+        mocks.OnCallFunc(platform_call_on_each_cpu).Return(BF_SUCCESS);
+
+        CHECK(common_resume_vmm() == BF_ERROR_UNKNOWN);
+    }
+
+    CHECK(common_vmm_status() == VMM_LOADED);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_resume_vmm: offline cpus stay suspended")
+{
+    common_init();
+
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_start_vmm() == BF_SUCCESS);
+    CHECK(common_suspend_vmm() == BF_SUCCESS);
+
+    {
+        MockRepository mocks;
+        mocks.OnCallFunc(platform_cpu_online).Return(0);
+        mocks.OnCallFunc(platform_call_on_each_cpu).Return(BF_SUCCESS);
+
+        CHECK(common_resume_vmm() == BF_SUCCESS);
+    }
+
+    CHECK(num_cpus_started() == 0);
+    CHECK(common_start_cpu(0) == BF_SUCCESS);
+    CHECK(num_cpus_started() == 1);
+    CHECK(common_resume_vmm() == BF_SUCCESS);
+    CHECK(num_cpus_started() == 1);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+TEST_CASE("common_resume_vmm: stop while suspended")
+{
+    common_init();
+
+    binaries_info info{&g_file, g_filenames_success, false};
+
+    for (const auto &binary : info.binaries()) {
+        REQUIRE(common_add_module(binary.file, binary.file_size) == BF_SUCCESS);
+    }
+
+    CHECK(common_load_vmm() == BF_SUCCESS);
+    CHECK(common_start_vmm() == BF_SUCCESS);
+    CHECK(common_suspend_vmm() == BF_SUCCESS);
+    CHECK(common_stop_vmm() == BF_SUCCESS);
+    CHECK(common_resume_vmm() == BF_SUCCESS);
+    CHECK(common_vmm_status() == VMM_LOADED);
+    CHECK(common_start_vmm() == BF_SUCCESS);
+    CHECK(num_cpus_started() == 1);
+    CHECK(common_fini() == BF_SUCCESS);
+}
+
+#endif
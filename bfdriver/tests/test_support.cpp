@@ -107,3 +107,27 @@ std::vector<std::string> g_filenames_vmm_fini_fails = {
     VMM_PREFIX_PATH + "/lib/libbfunwind_shared.so"_s,
     VMM_PREFIX_PATH + "/bin/dummy_main_vmm_fini_fails_shared"_s,
 };
+
+std::vector<std::string> g_filenames_vmm_suspend_fails = {
+    VMM_PREFIX_PATH + "/lib/libdummy_lib1_shared.so"_s,
+    VMM_PREFIX_PATH + "/lib/libdummy_lib2_shared.so"_s,
+    VMM_PREFIX_PATH + "/lib/libc.so"_s,
+    VMM_PREFIX_PATH + "/lib/libc++.so.1.0"_s,
+    VMM_PREFIX_PATH + "/lib/libc++abi.so"_s,
+    VMM_PREFIX_PATH + "/lib/libbfpthread_shared.so"_s,
+    VMM_PREFIX_PATH + "/lib/libbfsyscall_shared.so"_s,
+    VMM_PREFIX_PATH + "/lib/libbfunwind_shared.so"_s,
+    VMM_PREFIX_PATH + "/bin/dummy_main_vmm_suspend_fails_shared"_s,
+};
+
+std::vector<std::string> g_filenames_large = {
+    VMM_PREFIX_PATH + "/lib/libdummy_lib1_shared.so"_s,
+    VMM_PREFIX_PATH + "/lib/libdummy_lib2_shared.so"_s,
+    VMM_PREFIX_PATH + "/lib/libc.so"_s,
+    VMM_PREFIX_PATH + "/lib/libc++.so.1.0"_s,
+    VMM_PREFIX_PATH + "/lib/libc++abi.so"_s,
+    VMM_PREFIX_PATH + "/lib/libbfpthread_shared.so"_s,
+    VMM_PREFIX_PATH + "/lib/libbfsyscall_shared.so"_s,
+    VMM_PREFIX_PATH + "/lib/libbfunwind_shared.so"_s,
+    VMM_PREFIX_PATH + "/bin/dummy_main_large_shared"_s,
+};
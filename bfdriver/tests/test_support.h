@@ -27,5 +27,7 @@ extern std::vector<std::string> g_filenames_add_mdl_fails;
 extern std::vector<std::string> g_filenames_get_drr_fails;
 extern std::vector<std::string> g_filenames_vmm_init_fails;
 extern std::vector<std::string> g_filenames_vmm_fini_fails;
+extern std::vector<std::string> g_filenames_vmm_suspend_fails;
+extern std::vector<std::string> g_filenames_large;
 
 #endif
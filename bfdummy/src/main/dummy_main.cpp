@@ -52,11 +52,22 @@
 #define REQUEST_VMM_FINI_RETURN ENTRY_ERROR_UNKNOWN
 #endif
 
+#ifndef REQUEST_VMM_SUSPEND_FAILS
+#define REQUEST_VMM_SUSPEND_RETURN ENTRY_SUCCESS
+#else
+#define REQUEST_VMM_SUSPEND_RETURN ENTRY_ERROR_UNKNOWN
+#endif
+
+#ifdef LARGE_MODULE
+#define LARGE_MODULE_SIZE (16 * 1024 * 1024)
+#endif
+
 #include <bfgsl.h>
 #include <bftypes.h>
 #include <bfexports.h>
 #include <bfsupport.h>
 
+#include <atomic>
 #include <cstring>
 #include <stdexcept>
 
@@ -67,6 +78,18 @@ derived2 g_derived2;
 
 EXPORT_SYM int global_var = 0;
 
+/*
+ * The number of times that bfmain() has been called with each request. The
+ * driver's tests resolve this symbol to check how many times the VMM is
+ * entered by each operation. The CPUs can enter the VMM at the same time,
+ * so the counts are atomic.
+ */
+EXPORT_SYM std::atomic<uint64_t> g_num_requests[BF_REQUEST_VMM_SUSPEND + 1] = {};
+
+#ifdef LARGE_MODULE
+EXPORT_SYM char g_large_module[LARGE_MODULE_SIZE] = {};
+#endif
+
 int
 main(int argc, char *argv[])
 {
@@ -91,6 +114,10 @@ bfmain(uintptr_t request, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3)
     bfignored(arg2);
     bfignored(arg3);
 
+    if (request <= BF_REQUEST_VMM_SUSPEND) {
+        gsl::at(g_num_requests, static_cast<std::ptrdiff_t>(request))++;
+    }
+
     switch (request) {
         case BF_REQUEST_INIT:
             return REQUEST_INIT_RETURN;
@@ -102,14 +129,24 @@ bfmain(uintptr_t request, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3)
             return REQUEST_ADD_MDL_RETURN;
 
         case BF_REQUEST_GET_DRR:
+        case BF_REQUEST_GET_TRR:
             return REQUEST_GET_DRR_RETURN;
 
+        case BF_REQUEST_SET_DEBUG_LEVEL:
+            return ENTRY_SUCCESS;
+
         case BF_REQUEST_VMM_INIT:
             return REQUEST_VMM_INIT_RETURN;
 
         case BF_REQUEST_VMM_FINI:
             return REQUEST_VMM_FINI_RETURN;
 
+        case BF_REQUEST_VMM_PREPARE:
+            return ENTRY_SUCCESS;
+
+        case BF_REQUEST_VMM_SUSPEND:
+            return REQUEST_VMM_SUSPEND_RETURN;
+
         default:
             break;
     }
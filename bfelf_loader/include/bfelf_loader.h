@@ -2169,6 +2169,308 @@ bfelf_set_integer_args(
     return BF_SUCCESS;
 }
 
+/* ---------------------------------------------------------------------------------------------- */
+/* ELF Bundles                                                                                    */
+/* ---------------------------------------------------------------------------------------------- */
+
+/*
+ * ELF Bundle
+ *
+ * A bundle is a set of ELF binaries that have already been loaded into a
+ * single image, and relocated against BFELF_BUNDLE_BASE (see
+ * bfelf_bundle_create()). Every address that was written by the relocator
+ * is recorded as a fixup, so that loading a bundle is a single copy of the
+ * image, followed by adding the difference between the image's actual
+ * address and BFELF_BUNDLE_BASE to each fixup. No symbols are resolved.
+ *
+ * The bundle is laid out as follows, with all offsets relative to the start
+ * of the bundle:
+ *
+ *  bfelf_bundle_header | segments[num_segments] | fixups[num_fixups] | image
+ *
+ * Each fixup is the offset (in the image) of a 64bit address. Each segment
+ * describes a loadable segment of one of the ELF binaries in the image.
+ */
+
+/* @cond */
+
+#define BFELF_BUNDLE_MAGIC 0x454C444E55424642ULL
+#define BFELF_BUNDLE_VERSION 1ULL
+#define BFELF_BUNDLE_BASE 0x0000100000000000ULL
+
+/* @endcond */
+
+/**
+ * @struct bfelf_bundle_segment
+ *
+ * ELF Bundle Segment
+ *
+ * @var bfelf_bundle_segment::offset
+ *      the offset of the segment in the image
+ * @var bfelf_bundle_segment::size
+ *      the size of the segment in memory
+ * @var bfelf_bundle_segment::perm
+ *      the segment's permissions (i.e. bfpf_x, bfpf_w, bfpf_r)
+ */
+struct bfelf_bundle_segment {
+    uint64_t offset;
+    uint64_t size;
+    uint64_t perm;
+};
+
+/**
+ * @struct bfelf_bundle_header
+ *
+ * ELF Bundle Header
+ *
+ * @var bfelf_bundle_header::magic
+ *      BFELF_BUNDLE_MAGIC
+ * @var bfelf_bundle_header::version
+ *      BFELF_BUNDLE_VERSION
+ * @var bfelf_bundle_header::base
+ *      the address the image was relocated against
+ * @var bfelf_bundle_header::entry
+ *      the entry point (relative to base)
+ * @var bfelf_bundle_header::image_offset
+ *      the offset of the image in the bundle
+ * @var bfelf_bundle_header::image_size
+ *      the size of the image (i.e. the amount of executable memory needed)
+ * @var bfelf_bundle_header::segments_offset
+ *      the offset of the segments in the bundle
+ * @var bfelf_bundle_header::num_segments
+ *      the number of segments
+ * @var bfelf_bundle_header::fixups_offset
+ *      the offset of the fixups in the bundle
+ * @var bfelf_bundle_header::num_fixups
+ *      the number of fixups
+ * @var bfelf_bundle_header::num_sections
+ *      the number of section infos (i.e. the number of ELF binaries)
+ * @var bfelf_bundle_header::sections
+ *      the section info of each ELF binary (relative to base)
+ */
+struct bfelf_bundle_header {
+    uint64_t magic;
+    uint64_t version;
+
+    uint64_t base;
+    uint64_t entry;
+
+    uint64_t image_offset;
+    uint64_t image_size;
+
+    uint64_t segments_offset;
+    uint64_t num_segments;
+
+    uint64_t fixups_offset;
+    uint64_t num_fixups;
+
+    uint64_t num_sections;
+    struct section_info_t sections[MAX_NUM_MODULES];
+};
+
+/* @cond */
+
+static inline int64_t
+private_bundle_range_valid(uint64_t offset, uint64_t size, uint64_t total)
+{ return offset <= total && size <= total - offset ? 1 : 0; }
+
+static inline void *
+private_bundle_rebase(void *addr, uint64_t delta)
+{ return addr != nullptr ? bfrcast(void *, bfrcast(uint64_t, addr) + delta) : nullptr; }
+
+/* @endcond */
+
+/**
+ * Is Bundle
+ *
+ * @expects none
+ * @ensures none
+ *
+ * @param file a character buffer containing the contents of the file
+ * @param filesz the size of the file in bytes
+ * @return 1 if the file starts with BFELF_BUNDLE_MAGIC, 0 otherwise
+ */
+static inline int64_t
+bfelf_is_bundle(const char *file, uint64_t filesz)
+{
+    if (file == nullptr || filesz < sizeof(struct bfelf_bundle_header)) {
+        return 0;
+    }
+
+    return bfrcast(const struct bfelf_bundle_header *, file)->magic == BFELF_BUNDLE_MAGIC ? 1 : 0;
+}
+
+/**
+ * Initialize Bundle
+ *
+ * Validates a bundle. Once a bundle is validated, its header can be used to
+ * allocate the image, and to load the bundle using bfelf_bundle_load().
+ *
+ * @expects file != nullptr
+ * @expects hdr != nullptr
+ * @ensures returns BFELF_SUCCESS if params == valid
+ *
+ * @param file a character buffer containing the contents of the bundle
+ * @param filesz the size of the bundle in bytes
+ * @param hdr the resulting bundle header
+ * @return BFELF_SUCCESS on success, negative on error
+ */
+static inline int64_t
+bfelf_bundle_init(const char *file, uint64_t filesz, const struct bfelf_bundle_header **hdr)
+{
+    uint64_t i = 0;
+    const uint64_t *fixups = nullptr;
+    const struct bfelf_bundle_segment *segments = nullptr;
+    const struct bfelf_bundle_header *bundle = nullptr;
+
+    if (file == nullptr) {
+        return bfinvalid_argument("file == nullptr");
+    }
+
+    if (hdr == nullptr) {
+        return bfinvalid_argument("hdr == nullptr");
+    }
+
+    if (bfelf_is_bundle(file, filesz) == 0) {
+        return bfinvalid_signature("file is not a bundle");
+    }
+
+    bundle = bfrcast(const struct bfelf_bundle_header *, file);
+
+    if (bundle->version != BFELF_BUNDLE_VERSION) {
+        return bfunsupported_file("unsupported bundle version");
+    }
+
+    if (bundle->image_size == 0 ||
+        !private_bundle_range_valid(bundle->image_offset, bundle->image_size, filesz)) {
+        return bfinvalid_file("invalid bundle image");
+    }
+
+    if (bundle->num_segments > filesz / sizeof(struct bfelf_bundle_segment) ||
+        !private_bundle_range_valid(
+            bundle->segments_offset, bundle->num_segments * sizeof(struct bfelf_bundle_segment), filesz)) {
+        return bfinvalid_file("invalid bundle segments");
+    }
+
+    if (bundle->num_fixups > filesz / sizeof(uint64_t) ||
+        !private_bundle_range_valid(bundle->fixups_offset, bundle->num_fixups * sizeof(uint64_t), filesz)) {
+        return bfinvalid_file("invalid bundle fixups");
+    }
+
+    if (bundle->num_sections == 0 || bundle->num_sections > MAX_NUM_MODULES) {
+        return bfinvalid_file("invalid bundle sections");
+    }
+
+    if (bundle->entry < bundle->base || bundle->entry - bundle->base >= bundle->image_size) {
+        return bfinvalid_file("invalid bundle entry");
+    }
+
+    segments = bfcadd(const struct bfelf_bundle_segment *, file, bundle->segments_offset);
+    for (i = 0; i < bundle->num_segments; i++) {
+        if (!private_bundle_range_valid(segments[i].offset, segments[i].size, bundle->image_size)) {
+            return bfinvalid_file("bundle segment out of range");
+        }
+    }
+
+    fixups = bfcadd(const uint64_t *, file, bundle->fixups_offset);
+    for (i = 0; i < bundle->num_fixups; i++) {
+        if (!private_bundle_range_valid(fixups[i], sizeof(uint64_t), bundle->image_size)) {
+            return bfinvalid_file("bundle fixup out of range");
+        }
+    }
+
+    *hdr = bundle;
+    return BFELF_SUCCESS;
+}
+
+/**
+ * Get Bundle Segment
+ *
+ * @expects hdr != nullptr
+ * @expects index < hdr->num_segments
+ * @ensures none
+ *
+ * @param hdr the bundle header returned by bfelf_bundle_init()
+ * @param index the segment to get
+ * @return the requested segment
+ */
+static inline const struct bfelf_bundle_segment *
+bfelf_bundle_get_segment(const struct bfelf_bundle_header *hdr, uint64_t index)
+{ return bfcadd(const struct bfelf_bundle_segment *, hdr, hdr->segments_offset) + index; }
+
+/**
+ * Load Bundle
+ *
+ * Copies the bundle's image into exec, and fixes up the image so that it
+ * can be executed at exec. The resulting entry point and CRT info are the
+ * same as those provided by bfelf_load() for the ELF binaries that the
+ * bundle was created from.
+ *
+ * @expects hdr != nullptr (validated by bfelf_bundle_init())
+ * @expects exec != nullptr (at least hdr->image_size bytes)
+ * @expects entry != nullptr
+ * @expects crt_info != nullptr
+ * @ensures none
+ *
+ * @param hdr the bundle header returned by bfelf_bundle_init()
+ * @param exec the memory to load the image into
+ * @param entry the resulting entry point
+ * @param crt_info the resulting CRT info
+ * @return BFELF_SUCCESS on success, negative on error
+ */
+static inline int64_t
+bfelf_bundle_load(
+    const struct bfelf_bundle_header *hdr, char *exec, void **entry, struct crt_info_t *crt_info)
+{
+    uint64_t i = 0;
+    uint64_t delta = 0;
+    const uint64_t *fixups = nullptr;
+
+    if (hdr == nullptr) {
+        return bfinvalid_argument("hdr == nullptr");
+    }
+
+    if (exec == nullptr) {
+        return bfinvalid_argument("exec == nullptr");
+    }
+
+    if (entry == nullptr) {
+        return bfinvalid_argument("entry == nullptr");
+    }
+
+    if (crt_info == nullptr) {
+        return bfinvalid_argument("crt_info == nullptr");
+    }
+
+    delta = bfrcast(uint64_t, exec) - hdr->base;
+    fixups = bfcadd(const uint64_t *, hdr, hdr->fixups_offset);
+
+    platform_memcpy(exec, bfcadd(const char *, hdr, hdr->image_offset), hdr->image_size);
+
+    for (i = 0; i < hdr->num_fixups; i++) {
+        *bfrcast(uint64_t *, exec + fixups[i]) += delta;
+    }
+
+    for (i = 0; i < hdr->num_sections; i++) {
+        struct section_info_t *info = &crt_info->info[crt_info->info_num++];
+        *info = hdr->sections[i];
+
+        info->init_addr = private_bundle_rebase(info->init_addr, delta);
+        info->fini_addr = private_bundle_rebase(info->fini_addr, delta);
+        info->init_array_addr = private_bundle_rebase(info->init_array_addr, delta);
+        info->fini_array_addr = private_bundle_rebase(info->fini_array_addr, delta);
+        info->eh_frame_addr = private_bundle_rebase(info->eh_frame_addr, delta);
+        info->debug_info_addr = private_bundle_rebase(info->debug_info_addr, delta);
+        info->debug_abbrev_addr = private_bundle_rebase(info->debug_abbrev_addr, delta);
+        info->debug_line_addr = private_bundle_rebase(info->debug_line_addr, delta);
+        info->debug_str_addr = private_bundle_rebase(info->debug_str_addr, delta);
+        info->debug_ranges_addr = private_bundle_rebase(info->debug_ranges_addr, delta);
+    }
+
+    *entry = bfrcast(void *, hdr->entry + delta);
+    return BFELF_SUCCESS;
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -2182,6 +2484,7 @@ bfelf_set_integer_args(
 #include <string>
 #include <vector>
 #include <memory>
+#include <algorithm>
 #include <exception>
 
 /* @cond */
@@ -2525,6 +2828,159 @@ public:
     /** @endcond */
 };
 
+/* @cond */
+
+inline void
+private_bundle_add_fixups(
+    const bfelf_file_t &ef, uint64_t offset, const bfelf_rela *relatab, bfelf64_xword relanum,
+    std::vector<uint64_t> &fixups)
+{
+    for (auto i = 0ULL; i < relanum; i++) {
+
+#if defined(BF_AARCH64)
+        auto type = BFELF_REL_TYPE(relatab[i].r_info);
+        if (type == BFR_AARCH64_ABS32 || type == BFR_AARCH64_ABS16) {
+            throw std::runtime_error("bundles only support 64bit relocations");
+        }
+#endif
+
+        fixups.push_back(offset + relatab[i].r_offset - ef.start_addr);
+    }
+}
+
+/* @endcond */
+
+/**
+ * Create Bundle
+ *
+ * Loads the provided ELF binaries into a single image, relocates the image
+ * against BFELF_BUNDLE_BASE and returns the resulting bundle (see
+ * bfelf_bundle_init()). Every relocation that is supported by the ELF
+ * loader writes a 64bit address that is relative to the address the image
+ * is executed at, which is why the relocations can be replaced with a list
+ * of fixups that are applied by bfelf_bundle_load().
+ *
+ * @note the binaries must not have been loaded (i.e. binaries_info must be
+ *     constructed with load == false), and once a bundle has been created,
+ *     the binaries cannot be loaded.
+ *
+ * @expects !binaries.binaries().empty()
+ * @ensures none
+ *
+ * @param binaries the ELF binaries to create the bundle from. Like
+ *     bfelf_load(), the main executable must be last.
+ * @return the bundle, or throws
+ */
+inline bfn::buffer
+bfelf_bundle_create(binaries_info &binaries)
+{
+    auto &bins = binaries.binaries();
+
+    expects(!bins.empty());
+    expects(bins.size() < MAX_NUM_MODULES);
+
+    uint64_t image_size = 0;
+    std::vector<uint64_t> offsets;
+
+    for (auto &bin : bins) {
+        if (bin.ef.file == nullptr) {
+            auto ret = bfelf_file_init(bin.file, bin.file_size, &bin.ef);
+            if (ret != BFELF_SUCCESS) {
+                throw std::runtime_error("bfelf_file_init failed: " + bfn::to_string(ret, 16));
+            }
+        }
+
+        if (bin.ef.added != 0) {
+            throw std::runtime_error("bundles cannot be created from loaded binaries");
+        }
+
+        if (bfelf_file_get_pic_pie(&bin.ef) != 1) {
+            throw std::runtime_error("bundles can only be created from PIC/PIE binaries");
+        }
+
+        offsets.push_back(image_size);
+
+        auto size = static_cast<uint64_t>(bfelf_file_get_total_size(&bin.ef));
+        image_size += (size + MAX_PAGE_SIZE - 1) & ~(MAX_PAGE_SIZE - 1);
+    }
+
+    bfn::buffer image(image_size);
+    bfelf_loader_t loader{};
+
+    std::vector<uint64_t> fixups;
+    std::vector<bfelf_bundle_segment> segments;
+
+    for (auto i = 0ULL; i < bins.size(); i++) {
+        auto &ef = bins.at(i).ef;
+        auto offset = offsets.at(i);
+
+        for (auto j = 0LL; j < bfelf_file_get_num_load_instrs(&ef); j++) {
+            const bfelf_load_instr *instr = nullptr;
+
+            auto ret = bfelf_file_get_load_instr(&ef, static_cast<uint64_t>(j), &instr);
+            bfignored(ret);
+
+            std::copy_n(
+                bins.at(i).file + instr->file_offset, instr->filesz, image.data() + offset + instr->mem_offset);
+
+            segments.push_back({offset + instr->mem_offset, instr->memsz, instr->perm});
+        }
+
+        auto ret = bfelf_loader_add(
+                       &loader, &ef, image.data() + offset, reinterpret_cast<char *>(BFELF_BUNDLE_BASE + offset));
+        if (ret != BFELF_SUCCESS) {
+            throw std::runtime_error("bfelf_loader_add failed: " + bfn::to_string(ret, 16));
+        }
+    }
+
+    auto ret = bfelf_loader_relocate(&loader);
+    if (ret != BFELF_SUCCESS) {
+        throw std::runtime_error("bfelf_loader_relocate failed: " + bfn::to_string(ret, 16));
+    }
+
+    bfelf_bundle_header hdr{};
+
+    hdr.magic = BFELF_BUNDLE_MAGIC;
+    hdr.version = BFELF_BUNDLE_VERSION;
+    hdr.base = BFELF_BUNDLE_BASE;
+
+    for (auto i = 0ULL; i < bins.size(); i++) {
+        const auto &ef = bins.at(i).ef;
+
+        private_bundle_add_fixups(ef, offsets.at(i), ef.relatab_dyn, ef.relanum_dyn, fixups);
+        private_bundle_add_fixups(ef, offsets.at(i), ef.relatab_plt, ef.relanum_plt, fixups);
+
+        ret = bfelf_file_get_section_info(&ef, &hdr.sections[hdr.num_sections++]);
+        bfignored(ret);
+    }
+
+    void *entry = nullptr;
+    ret = bfelf_file_get_entry(&bins.back().ef, &entry);
+    bfignored(ret);
+
+    hdr.entry = reinterpret_cast<uint64_t>(entry);
+
+    hdr.segments_offset = sizeof(hdr);
+    hdr.num_segments = segments.size();
+    hdr.fixups_offset = hdr.segments_offset + (segments.size() * sizeof(bfelf_bundle_segment));
+    hdr.num_fixups = fixups.size();
+    hdr.image_offset = hdr.fixups_offset + (fixups.size() * sizeof(uint64_t));
+    hdr.image_size = image_size;
+
+    bfn::buffer bundle(hdr.image_offset + hdr.image_size);
+
+    std::copy_n(reinterpret_cast<const char *>(&hdr), sizeof(hdr), bundle.data());
+    std::copy_n(
+        reinterpret_cast<const char *>(segments.data()), segments.size() * sizeof(bfelf_bundle_segment),
+        bundle.data() + hdr.segments_offset);
+    std::copy_n(
+        reinterpret_cast<const char *>(fixups.data()), fixups.size() * sizeof(uint64_t),
+        bundle.data() + hdr.fixups_offset);
+    std::copy_n(image.data(), image.size(), bundle.data() + hdr.image_offset);
+
+    return bundle;
+}
+
 #endif
 
 #pragma pack(pop)
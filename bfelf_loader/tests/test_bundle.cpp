@@ -0,0 +1,217 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include <catch/catch.hpp>
+
+#include <bfgsl.h>
+#include <bfplatform.h>
+
+#include <test_real_elf.h>
+
+std::vector<char>fake_stack(0x8000);
+
+static auto
+create_bundle()
+{
+    binaries_info binaries{&g_file, g_filenames, false};
+    return bfelf_bundle_create(binaries);
+}
+
+static auto
+bundle_header(bfn::buffer &bundle)
+{ return reinterpret_cast<bfelf_bundle_header *>(bundle.data()); }
+
+TEST_CASE("bfelf_bundle: real test")
+{
+    auto bundle = create_bundle();
+    const bfelf_bundle_header *hdr = nullptr;
+
+    auto ret = bfelf_bundle_init(bundle.data(), bundle.size(), &hdr);
+    REQUIRE(ret == BFELF_SUCCESS);
+
+    void *entry = nullptr;
+    crt_info_t info = {};
+
+    auto exec = static_cast<char *>(platform_alloc_rwe(hdr->image_size));
+    auto ___ = gsl::finally([&] {
+        platform_free_rwe(exec, hdr->image_size);
+    });
+
+    ret = bfelf_bundle_load(hdr, exec, &entry, &info);
+    REQUIRE(ret == BFELF_SUCCESS);
+
+    CHECK(info.info_num == static_cast<int>(g_filenames.size()));
+
+    std::array<const char *, 2> argv{{"1000", "2000"}};
+    bfelf_set_args(&info, gsl::narrow_cast<int>(argv.size()), argv.data());
+
+    auto func = reinterpret_cast<_start_t>(entry);
+    CHECK(func(&fake_stack.at(0x7999), &info) == 6000);
+}
+
+TEST_CASE("bfelf_bundle: create from loaded binaries")
+{
+    binaries_info binaries{&g_file, g_filenames};
+    CHECK_THROWS(bfelf_bundle_create(binaries));
+}
+
+TEST_CASE("bfelf_bundle: is bundle")
+{
+    auto bundle = create_bundle();
+    auto file = g_file.read_binary(g_filenames.back());
+
+    CHECK(bfelf_is_bundle(bundle.data(), bundle.size()) == 1);
+    CHECK(bfelf_is_bundle(file.data(), file.size()) == 0);
+    CHECK(bfelf_is_bundle(bundle.data(), 8) == 0);
+    CHECK(bfelf_is_bundle(nullptr, bundle.size()) == 0);
+}
+
+TEST_CASE("bfelf_bundle_init: invalid file")
+{
+    const bfelf_bundle_header *hdr = nullptr;
+
+    auto ret = bfelf_bundle_init(nullptr, 0x1000, &hdr);
+    CHECK(ret == BFELF_ERROR_INVALID_ARG);
+}
+
+TEST_CASE("bfelf_bundle_init: invalid hdr")
+{
+    auto bundle = create_bundle();
+
+    auto ret = bfelf_bundle_init(bundle.data(), bundle.size(), nullptr);
+    CHECK(ret == BFELF_ERROR_INVALID_ARG);
+}
+
+TEST_CASE("bfelf_bundle_init: not a bundle")
+{
+    const bfelf_bundle_header *hdr = nullptr;
+    auto file = g_file.read_binary(g_filenames.back());
+
+    auto ret = bfelf_bundle_init(file.data(), file.size(), &hdr);
+    CHECK(ret == BFELF_ERROR_INVALID_SIGNATURE);
+}
+
+TEST_CASE("bfelf_bundle_init: invalid version")
+{
+    auto bundle = create_bundle();
+    const bfelf_bundle_header *hdr = nullptr;
+
+    bundle_header(bundle)->version = BFELF_BUNDLE_VERSION + 1;
+
+    auto ret = bfelf_bundle_init(bundle.data(), bundle.size(), &hdr);
+    CHECK(ret == BFELF_ERROR_UNSUPPORTED_FILE);
+}
+
+TEST_CASE("bfelf_bundle_init: truncated image")
+{
+    auto bundle = create_bundle();
+    const bfelf_bundle_header *hdr = nullptr;
+
+    auto ret = bfelf_bundle_init(bundle.data(), bundle.size() - 1, &hdr);
+    CHECK(ret == BFELF_ERROR_INVALID_FILE);
+}
+
+TEST_CASE("bfelf_bundle_init: invalid segments")
+{
+    auto bundle = create_bundle();
+    const bfelf_bundle_header *hdr = nullptr;
+
+    bundle_header(bundle)->num_segments = 0xFFFFFFFFFFFFFFFF;
+
+    auto ret = bfelf_bundle_init(bundle.data(), bundle.size(), &hdr);
+    CHECK(ret == BFELF_ERROR_INVALID_FILE);
+}
+
+TEST_CASE("bfelf_bundle_init: invalid fixups")
+{
+    auto bundle = create_bundle();
+    const bfelf_bundle_header *hdr = nullptr;
+
+    bundle_header(bundle)->num_fixups = 0x1FFFFFFFFFFFFFFF;
+
+    auto ret = bfelf_bundle_init(bundle.data(), bundle.size(), &hdr);
+    CHECK(ret == BFELF_ERROR_INVALID_FILE);
+}
+
+TEST_CASE("bfelf_bundle_init: invalid sections")
+{
+    auto bundle = create_bundle();
+    const bfelf_bundle_header *hdr = nullptr;
+
+    bundle_header(bundle)->num_sections = MAX_NUM_MODULES + 1;
+
+    auto ret = bfelf_bundle_init(bundle.data(), bundle.size(), &hdr);
+    CHECK(ret == BFELF_ERROR_INVALID_FILE);
+}
+
+TEST_CASE("bfelf_bundle_init: invalid entry")
+{
+    auto bundle = create_bundle();
+    const bfelf_bundle_header *hdr = nullptr;
+
+    bundle_header(bundle)->entry = BFELF_BUNDLE_BASE + bundle_header(bundle)->image_size;
+
+    auto ret = bfelf_bundle_init(bundle.data(), bundle.size(), &hdr);
+    CHECK(ret == BFELF_ERROR_INVALID_FILE);
+}
+
+TEST_CASE("bfelf_bundle_init: segment out of range")
+{
+    auto bundle = create_bundle();
+    const bfelf_bundle_header *hdr = nullptr;
+
+    auto segments = reinterpret_cast<bfelf_bundle_segment *>(
+                        bundle.data() + bundle_header(bundle)->segments_offset);
+
+    segments[0].size = bundle_header(bundle)->image_size + 1;
+
+    auto ret = bfelf_bundle_init(bundle.data(), bundle.size(), &hdr);
+    CHECK(ret == BFELF_ERROR_INVALID_FILE);
+}
+
+TEST_CASE("bfelf_bundle_init: fixup out of range")
+{
+    auto bundle = create_bundle();
+    const bfelf_bundle_header *hdr = nullptr;
+
+    auto fixups = reinterpret_cast<uint64_t *>(
+                      bundle.data() + bundle_header(bundle)->fixups_offset);
+
+    fixups[0] = bundle_header(bundle)->image_size - 4;
+
+    auto ret = bfelf_bundle_init(bundle.data(), bundle.size(), &hdr);
+    CHECK(ret == BFELF_ERROR_INVALID_FILE);
+}
+
+TEST_CASE("bfelf_bundle_load: invalid args")
+{
+    auto bundle = create_bundle();
+    const bfelf_bundle_header *hdr = nullptr;
+
+    auto ret = bfelf_bundle_init(bundle.data(), bundle.size(), &hdr);
+    REQUIRE(ret == BFELF_SUCCESS);
+
+    void *entry = nullptr;
+    crt_info_t info = {};
+    std::vector<char> exec(hdr->image_size);
+
+    CHECK(bfelf_bundle_load(nullptr, exec.data(), &entry, &info) == BFELF_ERROR_INVALID_ARG);
+    CHECK(bfelf_bundle_load(hdr, nullptr, &entry, &info) == BFELF_ERROR_INVALID_ARG);
+    CHECK(bfelf_bundle_load(hdr, exec.data(), nullptr, &info) == BFELF_ERROR_INVALID_ARG);
+    CHECK(bfelf_bundle_load(hdr, exec.data(), &entry, nullptr) == BFELF_ERROR_INVALID_ARG);
+}
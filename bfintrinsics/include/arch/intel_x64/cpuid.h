@@ -60,7 +60,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -82,7 +82,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -104,7 +104,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -126,7 +126,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -148,7 +148,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -170,7 +170,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -192,7 +192,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -214,7 +214,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -236,7 +236,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -258,7 +258,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -280,7 +280,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -302,7 +302,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -324,7 +324,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -346,7 +346,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -368,7 +368,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -390,7 +390,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -412,7 +412,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -434,7 +434,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -456,7 +456,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -478,7 +478,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -500,7 +500,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -522,7 +522,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -544,7 +544,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -566,7 +566,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -588,7 +588,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -610,7 +610,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -632,7 +632,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -654,7 +654,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -676,7 +676,7 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -698,11 +698,11 @@ namespace feature_information
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             sse3::dump(level, msg);
@@ -738,7 +738,7 @@ namespace feature_information
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         ecx::dump(level, msg);
     }
@@ -771,11 +771,11 @@ namespace extended_feature_flags
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 max_input::dump(level, msg);
@@ -807,7 +807,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -829,7 +829,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -851,7 +851,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -873,7 +873,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -895,7 +895,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -917,7 +917,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -939,7 +939,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -961,7 +961,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -983,7 +983,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -1005,7 +1005,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -1027,7 +1027,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -1049,7 +1049,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -1071,7 +1071,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -1093,7 +1093,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -1115,7 +1115,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -1137,7 +1137,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -1159,7 +1159,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -1181,7 +1181,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -1203,7 +1203,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -1225,7 +1225,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -1247,7 +1247,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -1269,7 +1269,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -1291,11 +1291,11 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 fsgsbase::dump(level, msg);
@@ -1349,7 +1349,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -1371,7 +1371,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -1393,7 +1393,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -1415,7 +1415,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -1431,7 +1431,7 @@ namespace extended_feature_flags
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
@@ -1453,7 +1453,7 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -1475,11 +1475,11 @@ namespace extended_feature_flags
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 prefetchwt1::dump(level, msg);
@@ -1492,7 +1492,7 @@ namespace extended_feature_flags
             }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             eax::dump(level, msg);
             ebx::dump(level, msg);
@@ -1500,7 +1500,7 @@ namespace extended_feature_flags
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         subleaf0::dump(level, msg);
     }
@@ -1529,7 +1529,7 @@ namespace arch_perf_monitoring
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
@@ -1545,7 +1545,7 @@ namespace arch_perf_monitoring
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
@@ -1561,7 +1561,7 @@ namespace arch_perf_monitoring
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
@@ -1577,11 +1577,11 @@ namespace arch_perf_monitoring
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             version_id::dump(level, msg);
@@ -1616,7 +1616,7 @@ namespace arch_perf_monitoring
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -1638,7 +1638,7 @@ namespace arch_perf_monitoring
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -1660,7 +1660,7 @@ namespace arch_perf_monitoring
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -1682,7 +1682,7 @@ namespace arch_perf_monitoring
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -1704,7 +1704,7 @@ namespace arch_perf_monitoring
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -1726,7 +1726,7 @@ namespace arch_perf_monitoring
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -1748,11 +1748,11 @@ namespace arch_perf_monitoring
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             core_cycle_event::dump(level, msg);
@@ -1784,7 +1784,7 @@ namespace arch_perf_monitoring
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
@@ -1800,11 +1800,11 @@ namespace arch_perf_monitoring
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             ffpmc_count::dump(level, msg);
@@ -1812,7 +1812,7 @@ namespace arch_perf_monitoring
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         eax::dump(level, msg);
         ebx::dump(level, msg);
@@ -1831,7 +1831,7 @@ namespace cache_tlb_info
         inline auto get() noexcept
         { return _cpuid_eax(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
@@ -1842,7 +1842,7 @@ namespace cache_tlb_info
         inline auto get() noexcept
         { return _cpuid_ebx(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
@@ -1853,7 +1853,7 @@ namespace cache_tlb_info
         inline auto get() noexcept
         { return _cpuid_ecx(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
@@ -1864,11 +1864,11 @@ namespace cache_tlb_info
         inline auto get() noexcept
         { return _cpuid_edx(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         eax::dump(level, msg);
         ebx::dump(level, msg);
@@ -1888,7 +1888,7 @@ namespace serial_num
         inline auto get() noexcept
         { return _cpuid_ecx(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
@@ -1899,11 +1899,11 @@ namespace serial_num
         inline auto get() noexcept
         { return _cpuid_edx(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         ecx::dump(level, msg);
         edx::dump(level, msg);
@@ -1933,7 +1933,7 @@ namespace cache_parameters
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
@@ -1949,7 +1949,7 @@ namespace cache_parameters
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
@@ -1971,7 +1971,7 @@ namespace cache_parameters
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -1993,7 +1993,7 @@ namespace cache_parameters
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -2009,7 +2009,7 @@ namespace cache_parameters
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
@@ -2025,11 +2025,11 @@ namespace cache_parameters
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             cache_type::dump(level, msg);
@@ -2060,7 +2060,7 @@ namespace cache_parameters
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
@@ -2076,7 +2076,7 @@ namespace cache_parameters
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
@@ -2092,11 +2092,11 @@ namespace cache_parameters
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             l::dump(level, msg);
@@ -2124,11 +2124,11 @@ namespace cache_parameters
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             num_sets::dump(level, msg);
@@ -2160,7 +2160,7 @@ namespace cache_parameters
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -2182,7 +2182,7 @@ namespace cache_parameters
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -2204,11 +2204,11 @@ namespace cache_parameters
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             wbinvd_invd::dump(level, msg);
@@ -2217,7 +2217,7 @@ namespace cache_parameters
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         eax::dump(level, msg);
         ebx::dump(level, msg);
@@ -2249,11 +2249,11 @@ namespace monitor_mwait
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             min_line_size::dump(level, msg);
@@ -2279,11 +2279,11 @@ namespace monitor_mwait
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             max_line_size::dump(level, msg);
@@ -2315,7 +2315,7 @@ namespace monitor_mwait
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -2337,11 +2337,11 @@ namespace monitor_mwait
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             enum_mwait_extensions::dump(level, msg);
@@ -2368,7 +2368,7 @@ namespace monitor_mwait
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
@@ -2384,7 +2384,7 @@ namespace monitor_mwait
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
@@ -2400,7 +2400,7 @@ namespace monitor_mwait
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
@@ -2416,7 +2416,7 @@ namespace monitor_mwait
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
@@ -2432,7 +2432,7 @@ namespace monitor_mwait
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
@@ -2448,7 +2448,7 @@ namespace monitor_mwait
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
@@ -2464,7 +2464,7 @@ namespace monitor_mwait
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
@@ -2480,11 +2480,11 @@ namespace monitor_mwait
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             num_c0::dump(level, msg);
@@ -2498,7 +2498,7 @@ namespace monitor_mwait
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         eax::dump(level, msg);
         ebx::dump(level, msg);
@@ -2536,7 +2536,7 @@ namespace therm_power_management
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -2558,7 +2558,7 @@ namespace therm_power_management
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -2580,7 +2580,7 @@ namespace therm_power_management
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -2602,7 +2602,7 @@ namespace therm_power_management
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -2624,7 +2624,7 @@ namespace therm_power_management
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -2646,7 +2646,7 @@ namespace therm_power_management
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -2668,7 +2668,7 @@ namespace therm_power_management
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -2690,7 +2690,7 @@ namespace therm_power_management
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -2712,7 +2712,7 @@ namespace therm_power_management
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -2734,7 +2734,7 @@ namespace therm_power_management
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -2756,7 +2756,7 @@ namespace therm_power_management
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -2778,11 +2778,11 @@ namespace therm_power_management
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             temp_sensor::dump(level, msg);
@@ -2819,11 +2819,11 @@ namespace therm_power_management
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             num_interrupts::dump(level, msg);
@@ -2855,7 +2855,7 @@ namespace therm_power_management
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -2877,11 +2877,11 @@ namespace therm_power_management
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             hardware_feedback::dump(level, msg);
@@ -2889,7 +2889,7 @@ namespace therm_power_management
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         eax::dump(level, msg);
         ebx::dump(level, msg);
@@ -2908,11 +2908,11 @@ namespace access_cache
         inline auto get() noexcept
         { return _cpuid_eax(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         eax::dump(level, msg);
     }
@@ -2941,11 +2941,11 @@ namespace topology_enumeration
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             x2apic_shift::dump(level, msg);
@@ -2971,11 +2971,11 @@ namespace topology_enumeration
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             num_processors::dump(level, msg);
@@ -3001,7 +3001,7 @@ namespace topology_enumeration
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
@@ -3017,11 +3017,11 @@ namespace topology_enumeration
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             level_number::dump(level, msg);
@@ -3048,18 +3048,18 @@ namespace topology_enumeration
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             x2apic_id::dump(level, msg);
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         eax::dump(level, msg);
         ebx::dump(level, msg);
@@ -3083,7 +3083,7 @@ namespace extended_state_enum
             inline auto get() noexcept
             { return _cpuid_subeax(addr, leaf); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_nhex(level, name, get(), msg); }
         }
 
@@ -3094,7 +3094,7 @@ namespace extended_state_enum
             inline auto get() noexcept
             { return _cpuid_subebx(addr, leaf); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_nhex(level, name, get(), msg); }
         }
 
@@ -3105,7 +3105,7 @@ namespace extended_state_enum
             inline auto get() noexcept
             { return _cpuid_subecx(addr, leaf); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_nhex(level, name, get(), msg); }
         }
 
@@ -3116,11 +3116,11 @@ namespace extended_state_enum
             inline auto get() noexcept
             { return _cpuid_subedx(addr, leaf); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_nhex(level, name, get(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             eax::dump(level, msg);
             ebx::dump(level, msg);
@@ -3158,7 +3158,7 @@ namespace extended_state_enum
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -3180,7 +3180,7 @@ namespace extended_state_enum
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -3202,7 +3202,7 @@ namespace extended_state_enum
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -3224,11 +3224,11 @@ namespace extended_state_enum
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 xsaveopt::dump(level, msg);
@@ -3257,11 +3257,11 @@ namespace extended_state_enum
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 xsave_size::dump(level, msg);
@@ -3287,11 +3287,11 @@ namespace extended_state_enum
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 supported_bits::dump(level, msg);
@@ -3317,18 +3317,18 @@ namespace extended_state_enum
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 supported_bits::dump(level, msg);
             }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             eax::dump(level, msg);
             ebx::dump(level, msg);
@@ -3337,7 +3337,7 @@ namespace extended_state_enum
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         mainleaf::dump(level, msg);
         subleaf1::dump(level, msg);
@@ -3371,11 +3371,11 @@ namespace intel_rdt
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 rmid_max_range::dump(level, msg);
@@ -3407,18 +3407,18 @@ namespace intel_rdt
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 l3_rdt::dump(level, msg);
             }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             ebx::dump(level, msg);
             edx::dump(level, msg);
@@ -3448,11 +3448,11 @@ namespace intel_rdt
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 conversion_factor::dump(level, msg);
@@ -3478,11 +3478,11 @@ namespace intel_rdt
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 rmid_max_range::dump(level, msg);
@@ -3514,7 +3514,7 @@ namespace intel_rdt
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -3536,7 +3536,7 @@ namespace intel_rdt
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -3558,11 +3558,11 @@ namespace intel_rdt
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 l3_occupancy::dump(level, msg);
@@ -3571,7 +3571,7 @@ namespace intel_rdt
             }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             ebx::dump(level, msg);
             ecx::dump(level, msg);
@@ -3579,7 +3579,7 @@ namespace intel_rdt
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         subleaf0::dump(level, msg);
         subleaf1::dump(level, msg);
@@ -3619,7 +3619,7 @@ namespace allocation_enumeration
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -3641,7 +3641,7 @@ namespace allocation_enumeration
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -3663,11 +3663,11 @@ namespace allocation_enumeration
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 l3_cache::dump(level, msg);
@@ -3676,7 +3676,7 @@ namespace allocation_enumeration
             }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             ebx::dump(level, msg);
         }
@@ -3705,11 +3705,11 @@ namespace allocation_enumeration
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 mask_length::dump(level, msg);
@@ -3735,11 +3735,11 @@ namespace allocation_enumeration
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 map::dump(level, msg);
@@ -3771,11 +3771,11 @@ namespace allocation_enumeration
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 data_prio::dump(level, msg);
@@ -3801,18 +3801,18 @@ namespace allocation_enumeration
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 max_cos::dump(level, msg);
             }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             eax::dump(level, msg);
             ebx::dump(level, msg);
@@ -3844,11 +3844,11 @@ namespace allocation_enumeration
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 mask_length::dump(level, msg);
@@ -3874,11 +3874,11 @@ namespace allocation_enumeration
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 map::dump(level, msg);
@@ -3904,18 +3904,18 @@ namespace allocation_enumeration
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 max_cos::dump(level, msg);
             }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             eax::dump(level, msg);
             ebx::dump(level, msg);
@@ -3946,11 +3946,11 @@ namespace allocation_enumeration
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 max_throttle::dump(level, msg);
@@ -3982,11 +3982,11 @@ namespace allocation_enumeration
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 linear::dump(level, msg);
@@ -4012,18 +4012,18 @@ namespace allocation_enumeration
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 max_cos::dump(level, msg);
             }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             eax::dump(level, msg);
             ecx::dump(level, msg);
@@ -4031,7 +4031,7 @@ namespace allocation_enumeration
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         subleaf0::dump(level, msg);
         subleaf1::dump(level, msg);
@@ -4073,7 +4073,7 @@ namespace intel_sgx
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -4095,11 +4095,11 @@ namespace intel_sgx
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 sgx1::dump(level, msg);
@@ -4126,11 +4126,11 @@ namespace intel_sgx
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 miscselect::dump(level, msg);
@@ -4156,7 +4156,7 @@ namespace intel_sgx
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
@@ -4172,11 +4172,11 @@ namespace intel_sgx
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 mes_not64::dump(level, msg);
@@ -4184,7 +4184,7 @@ namespace intel_sgx
             }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             eax::dump(level, msg);
             ebx::dump(level, msg);
@@ -4203,7 +4203,7 @@ namespace intel_sgx
             inline auto get() noexcept
             { return _cpuid_subeax(addr, leaf); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_nhex(level, name, get(), msg); }
         }
 
@@ -4214,7 +4214,7 @@ namespace intel_sgx
             inline auto get() noexcept
             { return _cpuid_subebx(addr, leaf); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_nhex(level, name, get(), msg); }
         }
 
@@ -4225,7 +4225,7 @@ namespace intel_sgx
             inline auto get() noexcept
             { return _cpuid_subecx(addr, leaf); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_nhex(level, name, get(), msg); }
         }
 
@@ -4236,11 +4236,11 @@ namespace intel_sgx
             inline auto get() noexcept
             { return _cpuid_subedx(addr, leaf); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_nhex(level, name, get(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             eax::dump(level, msg);
             ebx::dump(level, msg);
@@ -4272,7 +4272,7 @@ namespace intel_sgx
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
@@ -4288,11 +4288,11 @@ namespace intel_sgx
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 subleaf_type::dump(level, msg);
@@ -4319,11 +4319,11 @@ namespace intel_sgx
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 address::dump(level, msg);
@@ -4349,7 +4349,7 @@ namespace intel_sgx
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
@@ -4365,11 +4365,11 @@ namespace intel_sgx
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 epc_property::dump(level, msg);
@@ -4396,18 +4396,18 @@ namespace intel_sgx
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 epc_size::dump(level, msg);
             }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             eax::dump(level, msg);
             ebx::dump(level, msg);
@@ -4416,7 +4416,7 @@ namespace intel_sgx
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         subleaf0::dump(level, msg);
         subleaf1::dump(level, msg);
@@ -4451,11 +4451,11 @@ namespace trace_enumeration
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 max_subleaf::dump(level, msg);
@@ -4487,7 +4487,7 @@ namespace trace_enumeration
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -4509,7 +4509,7 @@ namespace trace_enumeration
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -4531,7 +4531,7 @@ namespace trace_enumeration
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -4553,7 +4553,7 @@ namespace trace_enumeration
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -4575,7 +4575,7 @@ namespace trace_enumeration
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -4597,11 +4597,11 @@ namespace trace_enumeration
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 ia32_rtit_ctlcr3filter::dump(level, msg);
@@ -4638,7 +4638,7 @@ namespace trace_enumeration
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -4660,7 +4660,7 @@ namespace trace_enumeration
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -4682,7 +4682,7 @@ namespace trace_enumeration
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -4704,7 +4704,7 @@ namespace trace_enumeration
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
@@ -4726,11 +4726,11 @@ namespace trace_enumeration
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 trading_enabled::dump(level, msg);
@@ -4741,7 +4741,7 @@ namespace trace_enumeration
             }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             eax::dump(level, msg);
             ebx::dump(level, msg);
@@ -4772,7 +4772,7 @@ namespace trace_enumeration
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
@@ -4788,11 +4788,11 @@ namespace trace_enumeration
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 num_address_ranges::dump(level, msg);
@@ -4819,7 +4819,7 @@ namespace trace_enumeration
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
@@ -4835,11 +4835,11 @@ namespace trace_enumeration
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 bitmap_cycle_threshold::dump(level, msg);
@@ -4847,14 +4847,14 @@ namespace trace_enumeration
             }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             eax::dump(level, msg);
             ebx::dump(level, msg);
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         mainleaf::dump(level, msg);
         subleaf1::dump(level, msg);
@@ -4872,7 +4872,7 @@ namespace time_stamp_count
         inline auto get() noexcept
         { return _cpuid_eax(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
@@ -4883,7 +4883,7 @@ namespace time_stamp_count
         inline auto get() noexcept
         { return _cpuid_ebx(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
@@ -4894,11 +4894,11 @@ namespace time_stamp_count
         inline auto get() noexcept
         { return _cpuid_ecx(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         eax::dump(level, msg);
         ebx::dump(level, msg);
@@ -4917,7 +4917,7 @@ namespace processor_freq
         inline auto get() noexcept
         { return _cpuid_eax(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
@@ -4928,7 +4928,7 @@ namespace processor_freq
         inline auto get() noexcept
         { return _cpuid_ebx(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
@@ -4939,11 +4939,11 @@ namespace processor_freq
         inline auto get() noexcept
         { return _cpuid_ecx(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         eax::dump(level, msg);
         ebx::dump(level, msg);
@@ -4978,11 +4978,11 @@ namespace vendor_attribute
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 max_socid::dump(level, msg);
@@ -5008,7 +5008,7 @@ namespace vendor_attribute
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
@@ -5030,11 +5030,11 @@ namespace vendor_attribute
                 inline auto is_disabled(value_type msr)
                 { return is_bit_cleared(msr, from); }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subbool(level, name, is_enabled(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 soc_vendor::dump(level, msg);
@@ -5061,11 +5061,11 @@ namespace vendor_attribute
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 project_id::dump(level, msg);
@@ -5091,18 +5091,18 @@ namespace vendor_attribute
                 inline auto get(value_type msr) noexcept
                 { return get_bits(msr, mask) >> from; }
 
-                inline void dump(int level, std::string *msg = nullptr)
+                inline void dump(int level, bfdebug_msg_t *msg = nullptr)
                 { bfdebug_subnhex(level, name, get(), msg); }
             }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             {
                 bfdebug_nhex(level, name, get(), msg);
                 stepping_id::dump(level, msg);
             }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             eax::dump(level, msg);
             ebx::dump(level, msg);
@@ -5122,7 +5122,7 @@ namespace vendor_attribute
             inline auto get() noexcept
             { return _cpuid_subeax(addr, leaf); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_nhex(level, name, get(), msg); }
         }
 
@@ -5133,7 +5133,7 @@ namespace vendor_attribute
             inline auto get() noexcept
             { return _cpuid_subebx(addr, leaf); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_nhex(level, name, get(), msg); }
         }
 
@@ -5144,7 +5144,7 @@ namespace vendor_attribute
             inline auto get() noexcept
             { return _cpuid_subecx(addr, leaf); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_nhex(level, name, get(), msg); }
         }
 
@@ -5155,11 +5155,11 @@ namespace vendor_attribute
             inline auto get() noexcept
             { return _cpuid_subedx(addr, leaf); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_nhex(level, name, get(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             eax::dump(level, msg);
             ebx::dump(level, msg);
@@ -5168,7 +5168,7 @@ namespace vendor_attribute
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         mainleaf::dump(level, msg);
         subleaf1::dump(level, msg);
@@ -5204,7 +5204,7 @@ namespace ext_feature_info
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -5226,7 +5226,7 @@ namespace ext_feature_info
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -5248,11 +5248,11 @@ namespace ext_feature_info
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             lahf_sahf::dump(level, msg);
@@ -5286,7 +5286,7 @@ namespace ext_feature_info
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -5308,7 +5308,7 @@ namespace ext_feature_info
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -5330,7 +5330,7 @@ namespace ext_feature_info
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -5352,7 +5352,7 @@ namespace ext_feature_info
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
@@ -5374,11 +5374,11 @@ namespace ext_feature_info
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             syscall_sysret::dump(level, msg);
@@ -5389,7 +5389,7 @@ namespace ext_feature_info
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         ecx::dump(level, msg);
         edx::dump(level, msg);
@@ -5419,7 +5419,7 @@ namespace l2_info
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
@@ -5435,7 +5435,7 @@ namespace l2_info
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
@@ -5451,11 +5451,11 @@ namespace l2_info
             inline auto get(value_type msr) noexcept
             { return get_bits(msr, mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subnhex(level, name, get(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             line_size::dump(level, msg);
@@ -5464,7 +5464,7 @@ namespace l2_info
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         ecx::dump(level, msg);
     }
@@ -5499,18 +5499,18 @@ namespace invariant_tsc
             inline auto is_disabled(value_type msr)
             { return is_bit_cleared(msr, from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { bfdebug_subbool(level, name, is_enabled(), msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             bfdebug_nhex(level, name, get(), msg);
             available::dump(level, msg);
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         edx::dump(level, msg);
     }
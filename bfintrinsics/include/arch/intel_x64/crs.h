@@ -103,7 +103,7 @@ namespace cr0
         inline auto disable(value_type cr)
         { _write_cr0(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
 
     }
@@ -138,7 +138,7 @@ namespace cr0
         inline auto disable(value_type cr)
         { _write_cr0(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -172,7 +172,7 @@ namespace cr0
         inline auto disable(value_type cr)
         { _write_cr0(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -206,7 +206,7 @@ namespace cr0
         inline auto disable(value_type cr)
         { _write_cr0(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -240,7 +240,7 @@ namespace cr0
         inline auto disable(value_type cr)
         { _write_cr0(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -274,7 +274,7 @@ namespace cr0
         inline auto disable(value_type cr)
         { _write_cr0(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -308,7 +308,7 @@ namespace cr0
         inline auto disable(value_type cr)
         { _write_cr0(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -342,7 +342,7 @@ namespace cr0
         inline auto disable(value_type cr)
         { _write_cr0(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -376,7 +376,7 @@ namespace cr0
         inline auto disable(value_type cr)
         { _write_cr0(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -410,7 +410,7 @@ namespace cr0
         inline auto disable(value_type cr)
         { _write_cr0(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -444,11 +444,11 @@ namespace cr0
         inline auto disable(value_type cr)
         { _write_cr0(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         protection_enable::dump(level, msg);
@@ -477,7 +477,7 @@ namespace cr2
     inline void set(value_type val) noexcept
     { _write_cr2(val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -493,7 +493,7 @@ namespace cr3
     inline void set(value_type val) noexcept
     { _write_cr3(val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -539,7 +539,7 @@ namespace cr4
         inline auto disable(value_type cr)
         { _write_cr4(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -573,7 +573,7 @@ namespace cr4
         inline auto disable(value_type cr)
         { _write_cr4(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -607,7 +607,7 @@ namespace cr4
         inline auto disable(value_type cr)
         { _write_cr4(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -641,7 +641,7 @@ namespace cr4
         inline auto disable(value_type cr)
         { _write_cr4(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -675,7 +675,7 @@ namespace cr4
         inline auto disable(value_type cr)
         { _write_cr4(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -709,7 +709,7 @@ namespace cr4
         inline auto disable(value_type cr)
         { _write_cr4(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -743,7 +743,7 @@ namespace cr4
         inline auto disable(value_type cr)
         { _write_cr4(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -777,7 +777,7 @@ namespace cr4
         inline auto disable(value_type cr)
         { _write_cr4(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -811,7 +811,7 @@ namespace cr4
         inline auto disable(value_type cr)
         { _write_cr4(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -845,7 +845,7 @@ namespace cr4
         inline auto disable(value_type cr)
         { _write_cr4(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -879,7 +879,7 @@ namespace cr4
         inline auto disable(value_type cr)
         { _write_cr4(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -913,7 +913,7 @@ namespace cr4
         inline auto disable(value_type cr)
         { _write_cr4(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -947,7 +947,7 @@ namespace cr4
         inline auto disable(value_type cr)
         { _write_cr4(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -981,7 +981,7 @@ namespace cr4
         inline auto disable(value_type cr)
         { _write_cr4(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1015,7 +1015,7 @@ namespace cr4
         inline auto disable(value_type cr)
         { _write_cr4(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1049,7 +1049,7 @@ namespace cr4
         inline auto disable(value_type cr)
         { _write_cr4(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1083,7 +1083,7 @@ namespace cr4
         inline auto disable(value_type cr)
         { _write_cr4(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1117,7 +1117,7 @@ namespace cr4
         inline auto disable(value_type cr)
         { _write_cr4(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1151,11 +1151,11 @@ namespace cr4
         inline auto disable(value_type cr)
         { _write_cr4(clear_bit(cr, from)); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         v8086_mode_extensions::dump(level, msg);
@@ -1192,7 +1192,7 @@ namespace cr8
     inline void set(value_type val) noexcept
     { _write_cr8(val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -48,7 +48,7 @@ namespace ia32_monitor_filter_size
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -72,11 +72,11 @@ namespace ia32_platform_id
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         platform_id::dump(level, msg);
@@ -124,7 +124,7 @@ namespace ia32_feature_control
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -158,7 +158,7 @@ namespace ia32_feature_control
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -192,7 +192,7 @@ namespace ia32_feature_control
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -214,7 +214,7 @@ namespace ia32_feature_control
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -248,7 +248,7 @@ namespace ia32_feature_control
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -282,7 +282,7 @@ namespace ia32_feature_control
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -316,7 +316,7 @@ namespace ia32_feature_control
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -350,11 +350,11 @@ namespace ia32_feature_control
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         lock_bit::dump(level, msg);
@@ -397,11 +397,11 @@ namespace ia32_tsc_adjust
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         thread_adjust::dump(level, msg);
@@ -443,11 +443,11 @@ namespace ia32_bios_sign_id
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         bios_sign_id::dump(level, msg);
@@ -465,7 +465,7 @@ namespace ia32_sgxlepubkeyhash0
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -480,7 +480,7 @@ namespace ia32_sgxlepubkeyhash1
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -495,7 +495,7 @@ namespace ia32_sgxlepubkeyhash2
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -510,7 +510,7 @@ namespace ia32_sgxlepubkeyhash3
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -555,7 +555,7 @@ namespace ia32_smm_monitor_ctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -589,7 +589,7 @@ namespace ia32_smm_monitor_ctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -611,11 +611,11 @@ namespace ia32_smm_monitor_ctl
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         valid::dump(level, msg);
@@ -632,7 +632,7 @@ namespace ia32_smbase
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -647,7 +647,7 @@ namespace ia32_pmc0
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -662,7 +662,7 @@ namespace ia32_pmc1
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -677,7 +677,7 @@ namespace ia32_pmc2
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -692,7 +692,7 @@ namespace ia32_pmc3
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -707,7 +707,7 @@ namespace ia32_pmc4
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -722,7 +722,7 @@ namespace ia32_pmc5
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -737,7 +737,7 @@ namespace ia32_pmc6
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -752,7 +752,7 @@ namespace ia32_pmc7
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -767,7 +767,7 @@ namespace ia32_sysenter_cs
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -782,7 +782,7 @@ namespace ia32_sysenter_esp
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -797,7 +797,7 @@ namespace ia32_sysenter_eip
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -830,7 +830,7 @@ namespace ia32_perfevtsel0
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -852,7 +852,7 @@ namespace ia32_perfevtsel0
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -886,7 +886,7 @@ namespace ia32_perfevtsel0
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -920,7 +920,7 @@ namespace ia32_perfevtsel0
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -954,7 +954,7 @@ namespace ia32_perfevtsel0
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -988,7 +988,7 @@ namespace ia32_perfevtsel0
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1022,7 +1022,7 @@ namespace ia32_perfevtsel0
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1056,7 +1056,7 @@ namespace ia32_perfevtsel0
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1090,7 +1090,7 @@ namespace ia32_perfevtsel0
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1124,7 +1124,7 @@ namespace ia32_perfevtsel0
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1146,11 +1146,11 @@ namespace ia32_perfevtsel0
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         event_select::dump(level, msg);
@@ -1178,7 +1178,7 @@ namespace ia32_perfevtsel1
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1193,7 +1193,7 @@ namespace ia32_perfevtsel2
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1208,7 +1208,7 @@ namespace ia32_perfevtsel3
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1232,11 +1232,11 @@ namespace ia32_perf_status
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         state_value::dump(level, msg);
@@ -1272,7 +1272,7 @@ namespace ia32_perf_ctl
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -1306,11 +1306,11 @@ namespace ia32_perf_ctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         state_value::dump(level, msg);
@@ -1359,7 +1359,7 @@ namespace ia32_clock_modulation
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1381,7 +1381,7 @@ namespace ia32_clock_modulation
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -1415,11 +1415,11 @@ namespace ia32_clock_modulation
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         ext_duty_cycle::dump(level, msg);
@@ -1469,7 +1469,7 @@ namespace ia32_therm_interrupt
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1503,7 +1503,7 @@ namespace ia32_therm_interrupt
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1537,7 +1537,7 @@ namespace ia32_therm_interrupt
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1571,7 +1571,7 @@ namespace ia32_therm_interrupt
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1605,7 +1605,7 @@ namespace ia32_therm_interrupt
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1627,7 +1627,7 @@ namespace ia32_therm_interrupt
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -1661,7 +1661,7 @@ namespace ia32_therm_interrupt
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1683,7 +1683,7 @@ namespace ia32_therm_interrupt
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -1717,7 +1717,7 @@ namespace ia32_therm_interrupt
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1751,11 +1751,11 @@ namespace ia32_therm_interrupt
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         high_temp::dump(level, msg);
@@ -1797,7 +1797,7 @@ namespace ia32_therm_status
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1831,7 +1831,7 @@ namespace ia32_therm_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1853,7 +1853,7 @@ namespace ia32_therm_status
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1887,7 +1887,7 @@ namespace ia32_therm_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1909,7 +1909,7 @@ namespace ia32_therm_status
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1943,7 +1943,7 @@ namespace ia32_therm_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1965,7 +1965,7 @@ namespace ia32_therm_status
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -1999,7 +1999,7 @@ namespace ia32_therm_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2021,7 +2021,7 @@ namespace ia32_therm_status
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2055,7 +2055,7 @@ namespace ia32_therm_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2077,7 +2077,7 @@ namespace ia32_therm_status
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2111,7 +2111,7 @@ namespace ia32_therm_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2133,7 +2133,7 @@ namespace ia32_therm_status
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2167,7 +2167,7 @@ namespace ia32_therm_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2189,7 +2189,7 @@ namespace ia32_therm_status
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2223,7 +2223,7 @@ namespace ia32_therm_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2239,7 +2239,7 @@ namespace ia32_therm_status
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -2255,7 +2255,7 @@ namespace ia32_therm_status
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -2277,11 +2277,11 @@ namespace ia32_therm_status
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         therm_status::dump(level, msg);
@@ -2347,7 +2347,7 @@ namespace ia32_misc_enable
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2381,7 +2381,7 @@ namespace ia32_misc_enable
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2403,7 +2403,7 @@ namespace ia32_misc_enable
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2425,7 +2425,7 @@ namespace ia32_misc_enable
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2447,7 +2447,7 @@ namespace ia32_misc_enable
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2481,7 +2481,7 @@ namespace ia32_misc_enable
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2515,7 +2515,7 @@ namespace ia32_misc_enable
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2549,7 +2549,7 @@ namespace ia32_misc_enable
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2583,7 +2583,7 @@ namespace ia32_misc_enable
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2617,11 +2617,11 @@ namespace ia32_misc_enable
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         fast_strings::dump(level, msg);
@@ -2666,11 +2666,11 @@ namespace ia32_energy_perf_bias
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         power_policy::dump(level, msg);
@@ -2703,7 +2703,7 @@ namespace ia32_package_therm_status
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2737,7 +2737,7 @@ namespace ia32_package_therm_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2759,7 +2759,7 @@ namespace ia32_package_therm_status
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2793,7 +2793,7 @@ namespace ia32_package_therm_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2815,7 +2815,7 @@ namespace ia32_package_therm_status
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2849,7 +2849,7 @@ namespace ia32_package_therm_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2871,7 +2871,7 @@ namespace ia32_package_therm_status
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2905,7 +2905,7 @@ namespace ia32_package_therm_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2927,7 +2927,7 @@ namespace ia32_package_therm_status
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2961,7 +2961,7 @@ namespace ia32_package_therm_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -2983,7 +2983,7 @@ namespace ia32_package_therm_status
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -3017,7 +3017,7 @@ namespace ia32_package_therm_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -3033,11 +3033,11 @@ namespace ia32_package_therm_status
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         pkg_therm_status::dump(level, msg);
@@ -3097,7 +3097,7 @@ namespace ia32_package_therm_interrupt
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -3131,7 +3131,7 @@ namespace ia32_package_therm_interrupt
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -3165,7 +3165,7 @@ namespace ia32_package_therm_interrupt
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -3199,7 +3199,7 @@ namespace ia32_package_therm_interrupt
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -3221,7 +3221,7 @@ namespace ia32_package_therm_interrupt
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -3255,7 +3255,7 @@ namespace ia32_package_therm_interrupt
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -3277,7 +3277,7 @@ namespace ia32_package_therm_interrupt
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -3311,7 +3311,7 @@ namespace ia32_package_therm_interrupt
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -3345,11 +3345,11 @@ namespace ia32_package_therm_interrupt
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         pkg_high_temp::dump(level, msg);
@@ -3405,7 +3405,7 @@ namespace ia32_debugctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -3439,7 +3439,7 @@ namespace ia32_debugctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -3473,7 +3473,7 @@ namespace ia32_debugctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -3507,7 +3507,7 @@ namespace ia32_debugctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -3541,7 +3541,7 @@ namespace ia32_debugctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -3575,7 +3575,7 @@ namespace ia32_debugctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -3609,7 +3609,7 @@ namespace ia32_debugctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -3643,7 +3643,7 @@ namespace ia32_debugctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -3677,7 +3677,7 @@ namespace ia32_debugctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -3711,7 +3711,7 @@ namespace ia32_debugctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -3745,7 +3745,7 @@ namespace ia32_debugctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -3779,11 +3779,11 @@ namespace ia32_debugctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         lbr::dump(level, msg);
@@ -3830,7 +3830,7 @@ namespace ia32_smrr_physbase
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -3852,11 +3852,11 @@ namespace ia32_smrr_physbase
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         type::dump(level, msg);
@@ -3905,7 +3905,7 @@ namespace ia32_smrr_physmask
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -3927,11 +3927,11 @@ namespace ia32_smrr_physmask
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         valid::dump(level, msg);
@@ -3947,7 +3947,7 @@ namespace ia32_platform_dca_cap
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -3962,7 +3962,7 @@ namespace ia32_cpu_dca_cap
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4007,7 +4007,7 @@ namespace ia32_dca_0_cap
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -4029,7 +4029,7 @@ namespace ia32_dca_0_cap
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -4051,7 +4051,7 @@ namespace ia32_dca_0_cap
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -4073,7 +4073,7 @@ namespace ia32_dca_0_cap
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -4095,7 +4095,7 @@ namespace ia32_dca_0_cap
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -4129,7 +4129,7 @@ namespace ia32_dca_0_cap
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -4163,11 +4163,11 @@ namespace ia32_dca_0_cap
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         dca_active::dump(level, msg);
@@ -4188,7 +4188,7 @@ namespace ia32_mtrr_physbase0
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4200,7 +4200,7 @@ namespace ia32_mtrr_physmask0
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4212,7 +4212,7 @@ namespace ia32_mtrr_physbase1
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4224,7 +4224,7 @@ namespace ia32_mtrr_physmask1
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4236,7 +4236,7 @@ namespace ia32_mtrr_physbase2
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4248,7 +4248,7 @@ namespace ia32_mtrr_physmask2
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4260,7 +4260,7 @@ namespace ia32_mtrr_physbase3
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4272,7 +4272,7 @@ namespace ia32_mtrr_physmask3
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4284,7 +4284,7 @@ namespace ia32_mtrr_physbase4
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4296,7 +4296,7 @@ namespace ia32_mtrr_physmask4
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4308,7 +4308,7 @@ namespace ia32_mtrr_physbase5
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4320,7 +4320,7 @@ namespace ia32_mtrr_physmask5
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4332,7 +4332,7 @@ namespace ia32_mtrr_physbase6
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4344,7 +4344,7 @@ namespace ia32_mtrr_physmask6
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4356,7 +4356,7 @@ namespace ia32_mtrr_physbase7
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4368,7 +4368,7 @@ namespace ia32_mtrr_physmask7
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4380,7 +4380,7 @@ namespace ia32_mtrr_physbase8
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4392,7 +4392,7 @@ namespace ia32_mtrr_physmask8
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4404,7 +4404,7 @@ namespace ia32_mtrr_physbase9
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4416,7 +4416,7 @@ namespace ia32_mtrr_physmask9
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4428,7 +4428,7 @@ namespace ia32_mtrr_fix64k_00000
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4440,7 +4440,7 @@ namespace ia32_mtrr_fix16k_80000
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4452,7 +4452,7 @@ namespace ia32_mtrr_fix16k_A0000
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4464,7 +4464,7 @@ namespace ia32_mtrr_fix4k_C0000
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4476,7 +4476,7 @@ namespace ia32_mtrr_fix4k_C8000
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4488,7 +4488,7 @@ namespace ia32_mtrr_fix4k_D0000
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4500,7 +4500,7 @@ namespace ia32_mtrr_fix4k_D8000
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4512,7 +4512,7 @@ namespace ia32_mtrr_fix4k_E0000
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4524,7 +4524,7 @@ namespace ia32_mtrr_fix4k_E8000
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4536,7 +4536,7 @@ namespace ia32_mtrr_fix4k_F0000
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4548,7 +4548,7 @@ namespace ia32_mtrr_fix4k_F8000
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -4581,7 +4581,7 @@ namespace ia32_mc0_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -4615,11 +4615,11 @@ namespace ia32_mc0_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -4656,7 +4656,7 @@ namespace ia32_mc1_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -4690,11 +4690,11 @@ namespace ia32_mc1_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -4731,7 +4731,7 @@ namespace ia32_mc2_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -4765,11 +4765,11 @@ namespace ia32_mc2_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -4806,7 +4806,7 @@ namespace ia32_mc3_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -4840,11 +4840,11 @@ namespace ia32_mc3_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -4881,7 +4881,7 @@ namespace ia32_mc4_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -4915,11 +4915,11 @@ namespace ia32_mc4_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -4956,7 +4956,7 @@ namespace ia32_mc5_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -4990,11 +4990,11 @@ namespace ia32_mc5_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -5031,7 +5031,7 @@ namespace ia32_mc6_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -5065,11 +5065,11 @@ namespace ia32_mc6_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -5106,7 +5106,7 @@ namespace ia32_mc7_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -5140,11 +5140,11 @@ namespace ia32_mc7_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -5181,7 +5181,7 @@ namespace ia32_mc8_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -5215,11 +5215,11 @@ namespace ia32_mc8_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -5256,7 +5256,7 @@ namespace ia32_mc9_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -5290,11 +5290,11 @@ namespace ia32_mc9_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -5331,7 +5331,7 @@ namespace ia32_mc10_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -5365,11 +5365,11 @@ namespace ia32_mc10_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -5406,7 +5406,7 @@ namespace ia32_mc11_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -5440,11 +5440,11 @@ namespace ia32_mc11_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -5481,7 +5481,7 @@ namespace ia32_mc12_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -5515,11 +5515,11 @@ namespace ia32_mc12_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -5556,7 +5556,7 @@ namespace ia32_mc13_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -5590,11 +5590,11 @@ namespace ia32_mc13_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -5631,7 +5631,7 @@ namespace ia32_mc14_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -5665,11 +5665,11 @@ namespace ia32_mc14_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -5706,7 +5706,7 @@ namespace ia32_mc15_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -5740,11 +5740,11 @@ namespace ia32_mc15_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -5781,7 +5781,7 @@ namespace ia32_mc16_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -5815,11 +5815,11 @@ namespace ia32_mc16_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -5856,7 +5856,7 @@ namespace ia32_mc17_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -5890,11 +5890,11 @@ namespace ia32_mc17_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -5931,7 +5931,7 @@ namespace ia32_mc18_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -5965,11 +5965,11 @@ namespace ia32_mc18_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -6006,7 +6006,7 @@ namespace ia32_mc19_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -6040,11 +6040,11 @@ namespace ia32_mc19_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -6081,7 +6081,7 @@ namespace ia32_mc20_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -6115,11 +6115,11 @@ namespace ia32_mc20_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -6156,7 +6156,7 @@ namespace ia32_mc21_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -6190,11 +6190,11 @@ namespace ia32_mc21_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -6231,7 +6231,7 @@ namespace ia32_mc22_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -6265,11 +6265,11 @@ namespace ia32_mc22_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -6306,7 +6306,7 @@ namespace ia32_mc23_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -6340,11 +6340,11 @@ namespace ia32_mc23_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -6381,7 +6381,7 @@ namespace ia32_mc24_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -6415,11 +6415,11 @@ namespace ia32_mc24_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -6456,7 +6456,7 @@ namespace ia32_mc25_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -6490,11 +6490,11 @@ namespace ia32_mc25_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -6531,7 +6531,7 @@ namespace ia32_mc26_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -6565,11 +6565,11 @@ namespace ia32_mc26_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -6606,7 +6606,7 @@ namespace ia32_mc27_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -6640,11 +6640,11 @@ namespace ia32_mc27_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -6681,7 +6681,7 @@ namespace ia32_mc28_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -6715,11 +6715,11 @@ namespace ia32_mc28_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -6756,7 +6756,7 @@ namespace ia32_mc29_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -6790,11 +6790,11 @@ namespace ia32_mc29_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -6831,7 +6831,7 @@ namespace ia32_mc30_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -6865,11 +6865,11 @@ namespace ia32_mc30_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -6906,7 +6906,7 @@ namespace ia32_mc31_ctl2
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -6940,11 +6940,11 @@ namespace ia32_mc31_ctl2
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         error_threshold::dump(level, msg);
@@ -6981,7 +6981,7 @@ namespace ia32_mtrr_def_type
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -7015,7 +7015,7 @@ namespace ia32_mtrr_def_type
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7049,11 +7049,11 @@ namespace ia32_mtrr_def_type
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         def_mem_type::dump(level, msg);
@@ -7073,7 +7073,7 @@ namespace ia32_fixed_ctr0
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -7088,7 +7088,7 @@ namespace ia32_fixed_ctr1
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -7103,7 +7103,7 @@ namespace ia32_fixed_ctr2
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -7127,7 +7127,7 @@ namespace ia32_perf_capabilities
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -7149,7 +7149,7 @@ namespace ia32_perf_capabilities
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7171,7 +7171,7 @@ namespace ia32_perf_capabilities
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7187,7 +7187,7 @@ namespace ia32_perf_capabilities
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -7209,7 +7209,7 @@ namespace ia32_perf_capabilities
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7231,11 +7231,11 @@ namespace ia32_perf_capabilities
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         lbo_format::dump(level, msg);
@@ -7288,7 +7288,7 @@ namespace ia32_fixed_ctr_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7322,7 +7322,7 @@ namespace ia32_fixed_ctr_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7356,7 +7356,7 @@ namespace ia32_fixed_ctr_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7390,7 +7390,7 @@ namespace ia32_fixed_ctr_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7424,7 +7424,7 @@ namespace ia32_fixed_ctr_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7458,7 +7458,7 @@ namespace ia32_fixed_ctr_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7492,7 +7492,7 @@ namespace ia32_fixed_ctr_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7526,7 +7526,7 @@ namespace ia32_fixed_ctr_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7560,7 +7560,7 @@ namespace ia32_fixed_ctr_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7594,7 +7594,7 @@ namespace ia32_fixed_ctr_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7628,7 +7628,7 @@ namespace ia32_fixed_ctr_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7662,11 +7662,11 @@ namespace ia32_fixed_ctr_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         en0_os::dump(level, msg);
@@ -7722,7 +7722,7 @@ namespace ia32_perf_global_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7756,7 +7756,7 @@ namespace ia32_perf_global_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7790,7 +7790,7 @@ namespace ia32_perf_global_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7824,7 +7824,7 @@ namespace ia32_perf_global_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7858,7 +7858,7 @@ namespace ia32_perf_global_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7892,7 +7892,7 @@ namespace ia32_perf_global_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7926,7 +7926,7 @@ namespace ia32_perf_global_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7960,7 +7960,7 @@ namespace ia32_perf_global_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -7994,7 +7994,7 @@ namespace ia32_perf_global_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8028,7 +8028,7 @@ namespace ia32_perf_global_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8062,7 +8062,7 @@ namespace ia32_perf_global_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8096,7 +8096,7 @@ namespace ia32_perf_global_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8130,7 +8130,7 @@ namespace ia32_perf_global_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8164,11 +8164,11 @@ namespace ia32_perf_global_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         ovf_pmc0::dump(level, msg);
@@ -8229,7 +8229,7 @@ namespace ia32_perf_global_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8263,7 +8263,7 @@ namespace ia32_perf_global_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8297,7 +8297,7 @@ namespace ia32_perf_global_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8331,7 +8331,7 @@ namespace ia32_perf_global_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8365,7 +8365,7 @@ namespace ia32_perf_global_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8399,7 +8399,7 @@ namespace ia32_perf_global_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8433,7 +8433,7 @@ namespace ia32_perf_global_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8467,7 +8467,7 @@ namespace ia32_perf_global_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8501,7 +8501,7 @@ namespace ia32_perf_global_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8535,7 +8535,7 @@ namespace ia32_perf_global_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8569,11 +8569,11 @@ namespace ia32_perf_global_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         pmc0::dump(level, msg);
@@ -8631,7 +8631,7 @@ namespace ia32_perf_global_ovf_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8665,7 +8665,7 @@ namespace ia32_perf_global_ovf_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8699,7 +8699,7 @@ namespace ia32_perf_global_ovf_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8733,7 +8733,7 @@ namespace ia32_perf_global_ovf_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8767,7 +8767,7 @@ namespace ia32_perf_global_ovf_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8801,7 +8801,7 @@ namespace ia32_perf_global_ovf_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8835,7 +8835,7 @@ namespace ia32_perf_global_ovf_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8869,7 +8869,7 @@ namespace ia32_perf_global_ovf_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8903,7 +8903,7 @@ namespace ia32_perf_global_ovf_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8937,7 +8937,7 @@ namespace ia32_perf_global_ovf_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -8971,7 +8971,7 @@ namespace ia32_perf_global_ovf_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -9005,11 +9005,11 @@ namespace ia32_perf_global_ovf_ctrl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         clear_ovf_pmc0::dump(level, msg);
@@ -9068,7 +9068,7 @@ namespace ia32_perf_global_status_set
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -9102,7 +9102,7 @@ namespace ia32_perf_global_status_set
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -9136,7 +9136,7 @@ namespace ia32_perf_global_status_set
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -9170,7 +9170,7 @@ namespace ia32_perf_global_status_set
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -9204,7 +9204,7 @@ namespace ia32_perf_global_status_set
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -9238,7 +9238,7 @@ namespace ia32_perf_global_status_set
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -9272,7 +9272,7 @@ namespace ia32_perf_global_status_set
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -9306,7 +9306,7 @@ namespace ia32_perf_global_status_set
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -9340,7 +9340,7 @@ namespace ia32_perf_global_status_set
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -9374,7 +9374,7 @@ namespace ia32_perf_global_status_set
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -9408,11 +9408,11 @@ namespace ia32_perf_global_status_set
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         ovf_pmc0::dump(level, msg);
@@ -9455,7 +9455,7 @@ namespace ia32_perf_global_inuse
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -9477,7 +9477,7 @@ namespace ia32_perf_global_inuse
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -9499,7 +9499,7 @@ namespace ia32_perf_global_inuse
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -9521,7 +9521,7 @@ namespace ia32_perf_global_inuse
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -9543,7 +9543,7 @@ namespace ia32_perf_global_inuse
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -9565,7 +9565,7 @@ namespace ia32_perf_global_inuse
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -9587,11 +9587,11 @@ namespace ia32_perf_global_inuse
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         perfevtsel0::dump(level, msg);
@@ -9645,11 +9645,11 @@ namespace ia32_pebs_enable
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         pebs::dump(level, msg);
@@ -9664,7 +9664,7 @@ namespace ia32_mc6_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9676,7 +9676,7 @@ namespace ia32_mc6_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9688,7 +9688,7 @@ namespace ia32_mc6_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9700,7 +9700,7 @@ namespace ia32_mc6_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9712,7 +9712,7 @@ namespace ia32_mc7_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9724,7 +9724,7 @@ namespace ia32_mc7_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9736,7 +9736,7 @@ namespace ia32_mc7_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9748,7 +9748,7 @@ namespace ia32_mc7_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9760,7 +9760,7 @@ namespace ia32_mc8_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9772,7 +9772,7 @@ namespace ia32_mc8_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9784,7 +9784,7 @@ namespace ia32_mc8_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9796,7 +9796,7 @@ namespace ia32_mc8_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9808,7 +9808,7 @@ namespace ia32_mc9_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9820,7 +9820,7 @@ namespace ia32_mc9_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9832,7 +9832,7 @@ namespace ia32_mc9_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9844,7 +9844,7 @@ namespace ia32_mc9_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9856,7 +9856,7 @@ namespace ia32_mc10_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9868,7 +9868,7 @@ namespace ia32_mc10_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9880,7 +9880,7 @@ namespace ia32_mc10_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9892,7 +9892,7 @@ namespace ia32_mc10_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9904,7 +9904,7 @@ namespace ia32_mc11_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9916,7 +9916,7 @@ namespace ia32_mc11_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9928,7 +9928,7 @@ namespace ia32_mc11_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9940,7 +9940,7 @@ namespace ia32_mc11_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9952,7 +9952,7 @@ namespace ia32_mc12_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9964,7 +9964,7 @@ namespace ia32_mc12_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9976,7 +9976,7 @@ namespace ia32_mc12_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -9988,7 +9988,7 @@ namespace ia32_mc12_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10000,7 +10000,7 @@ namespace ia32_mc13_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10012,7 +10012,7 @@ namespace ia32_mc13_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10024,7 +10024,7 @@ namespace ia32_mc13_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10036,7 +10036,7 @@ namespace ia32_mc13_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10048,7 +10048,7 @@ namespace ia32_mc14_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10060,7 +10060,7 @@ namespace ia32_mc14_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10072,7 +10072,7 @@ namespace ia32_mc14_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10084,7 +10084,7 @@ namespace ia32_mc14_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10096,7 +10096,7 @@ namespace ia32_mc15_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10108,7 +10108,7 @@ namespace ia32_mc15_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10120,7 +10120,7 @@ namespace ia32_mc15_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10132,7 +10132,7 @@ namespace ia32_mc15_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10144,7 +10144,7 @@ namespace ia32_mc16_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10156,7 +10156,7 @@ namespace ia32_mc16_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10168,7 +10168,7 @@ namespace ia32_mc16_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10180,7 +10180,7 @@ namespace ia32_mc16_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10192,7 +10192,7 @@ namespace ia32_mc17_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10204,7 +10204,7 @@ namespace ia32_mc17_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10216,7 +10216,7 @@ namespace ia32_mc17_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10228,7 +10228,7 @@ namespace ia32_mc17_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10240,7 +10240,7 @@ namespace ia32_mc18_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10252,7 +10252,7 @@ namespace ia32_mc18_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10264,7 +10264,7 @@ namespace ia32_mc18_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10276,7 +10276,7 @@ namespace ia32_mc18_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10288,7 +10288,7 @@ namespace ia32_mc19_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10300,7 +10300,7 @@ namespace ia32_mc19_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10312,7 +10312,7 @@ namespace ia32_mc19_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10324,7 +10324,7 @@ namespace ia32_mc19_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10336,7 +10336,7 @@ namespace ia32_mc20_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10348,7 +10348,7 @@ namespace ia32_mc20_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10360,7 +10360,7 @@ namespace ia32_mc20_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10372,7 +10372,7 @@ namespace ia32_mc20_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10384,7 +10384,7 @@ namespace ia32_mc21_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10396,7 +10396,7 @@ namespace ia32_mc21_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10408,7 +10408,7 @@ namespace ia32_mc21_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10420,7 +10420,7 @@ namespace ia32_mc21_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10432,7 +10432,7 @@ namespace ia32_mc22_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10444,7 +10444,7 @@ namespace ia32_mc22_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10456,7 +10456,7 @@ namespace ia32_mc22_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10468,7 +10468,7 @@ namespace ia32_mc22_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10480,7 +10480,7 @@ namespace ia32_mc23_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10492,7 +10492,7 @@ namespace ia32_mc23_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10504,7 +10504,7 @@ namespace ia32_mc23_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10516,7 +10516,7 @@ namespace ia32_mc23_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10528,7 +10528,7 @@ namespace ia32_mc24_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10540,7 +10540,7 @@ namespace ia32_mc24_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10552,7 +10552,7 @@ namespace ia32_mc24_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10564,7 +10564,7 @@ namespace ia32_mc24_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10576,7 +10576,7 @@ namespace ia32_mc25_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10588,7 +10588,7 @@ namespace ia32_mc25_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10600,7 +10600,7 @@ namespace ia32_mc25_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10612,7 +10612,7 @@ namespace ia32_mc25_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10624,7 +10624,7 @@ namespace ia32_mc26_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10636,7 +10636,7 @@ namespace ia32_mc26_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10648,7 +10648,7 @@ namespace ia32_mc26_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10660,7 +10660,7 @@ namespace ia32_mc26_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10672,7 +10672,7 @@ namespace ia32_mc27_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10684,7 +10684,7 @@ namespace ia32_mc27_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10696,7 +10696,7 @@ namespace ia32_mc27_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10708,7 +10708,7 @@ namespace ia32_mc27_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10720,7 +10720,7 @@ namespace ia32_mc28_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10732,7 +10732,7 @@ namespace ia32_mc28_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10744,7 +10744,7 @@ namespace ia32_mc28_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10756,7 +10756,7 @@ namespace ia32_mc28_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -10780,7 +10780,7 @@ namespace ia32_vmx_basic
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -10796,7 +10796,7 @@ namespace ia32_vmx_basic
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -10818,7 +10818,7 @@ namespace ia32_vmx_basic
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -10840,7 +10840,7 @@ namespace ia32_vmx_basic
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -10856,7 +10856,7 @@ namespace ia32_vmx_basic
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -10878,7 +10878,7 @@ namespace ia32_vmx_basic
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -10900,11 +10900,11 @@ namespace ia32_vmx_basic
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         revision_id::dump(level, msg);
@@ -10937,7 +10937,7 @@ namespace ia32_vmx_pinbased_ctls
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -10953,11 +10953,11 @@ namespace ia32_vmx_pinbased_ctls
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         allowed_0_settings::dump(level, msg);
@@ -10985,7 +10985,7 @@ namespace ia32_vmx_procbased_ctls
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -11001,11 +11001,11 @@ namespace ia32_vmx_procbased_ctls
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         allowed_0_settings::dump(level, msg);
@@ -11033,7 +11033,7 @@ namespace ia32_vmx_exit_ctls
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -11049,11 +11049,11 @@ namespace ia32_vmx_exit_ctls
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         allowed_0_settings::dump(level, msg);
@@ -11081,7 +11081,7 @@ namespace ia32_vmx_entry_ctls
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -11097,11 +11097,11 @@ namespace ia32_vmx_entry_ctls
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         allowed_0_settings::dump(level, msg);
@@ -11129,7 +11129,7 @@ namespace ia32_vmx_misc
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -11151,7 +11151,7 @@ namespace ia32_vmx_misc
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -11173,7 +11173,7 @@ namespace ia32_vmx_misc
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -11195,7 +11195,7 @@ namespace ia32_vmx_misc
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -11217,7 +11217,7 @@ namespace ia32_vmx_misc
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -11239,7 +11239,7 @@ namespace ia32_vmx_misc
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -11261,7 +11261,7 @@ namespace ia32_vmx_misc
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -11277,7 +11277,7 @@ namespace ia32_vmx_misc
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -11293,7 +11293,7 @@ namespace ia32_vmx_misc
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -11315,7 +11315,7 @@ namespace ia32_vmx_misc
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -11337,7 +11337,7 @@ namespace ia32_vmx_misc
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -11359,11 +11359,11 @@ namespace ia32_vmx_misc
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         preemption_timer_decrement::dump(level, msg);
@@ -11389,7 +11389,7 @@ namespace ia32_vmx_cr0_fixed0
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -11401,7 +11401,7 @@ namespace ia32_vmx_cr0_fixed1
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -11413,7 +11413,7 @@ namespace ia32_vmx_cr4_fixed0
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -11425,7 +11425,7 @@ namespace ia32_vmx_cr4_fixed1
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -11449,11 +11449,11 @@ namespace ia32_vmx_vmcs_enum
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         highest_index::dump(level, msg);
@@ -11498,7 +11498,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -11526,7 +11526,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -11554,7 +11554,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -11582,7 +11582,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -11610,7 +11610,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -11638,7 +11638,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -11666,7 +11666,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -11694,7 +11694,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -11722,7 +11722,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -11750,7 +11750,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -11778,7 +11778,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -11806,7 +11806,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -11834,7 +11834,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -11862,7 +11862,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -11890,7 +11890,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -11918,7 +11918,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -11946,7 +11946,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -11974,7 +11974,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -12002,7 +12002,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -12030,7 +12030,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -12058,7 +12058,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -12086,7 +12086,7 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -12114,11 +12114,11 @@ namespace ia32_vmx_procbased_ctls2
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         virtualize_apic_accesses::dump(level, msg);
@@ -12173,7 +12173,7 @@ namespace ia32_vmx_ept_vpid_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -12195,7 +12195,7 @@ namespace ia32_vmx_ept_vpid_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -12217,7 +12217,7 @@ namespace ia32_vmx_ept_vpid_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -12239,7 +12239,7 @@ namespace ia32_vmx_ept_vpid_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -12261,7 +12261,7 @@ namespace ia32_vmx_ept_vpid_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -12283,7 +12283,7 @@ namespace ia32_vmx_ept_vpid_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -12305,7 +12305,7 @@ namespace ia32_vmx_ept_vpid_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -12327,7 +12327,7 @@ namespace ia32_vmx_ept_vpid_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -12349,7 +12349,7 @@ namespace ia32_vmx_ept_vpid_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -12371,7 +12371,7 @@ namespace ia32_vmx_ept_vpid_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -12393,7 +12393,7 @@ namespace ia32_vmx_ept_vpid_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -12415,7 +12415,7 @@ namespace ia32_vmx_ept_vpid_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -12437,7 +12437,7 @@ namespace ia32_vmx_ept_vpid_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -12459,7 +12459,7 @@ namespace ia32_vmx_ept_vpid_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -12481,11 +12481,11 @@ namespace ia32_vmx_ept_vpid_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         execute_only_translation::dump(level, msg);
@@ -12544,7 +12544,7 @@ namespace ia32_vmx_true_pinbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -12572,7 +12572,7 @@ namespace ia32_vmx_true_pinbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -12600,7 +12600,7 @@ namespace ia32_vmx_true_pinbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -12628,7 +12628,7 @@ namespace ia32_vmx_true_pinbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -12656,11 +12656,11 @@ namespace ia32_vmx_true_pinbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         external_interrupt_exiting::dump(level, msg);
@@ -12709,7 +12709,7 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -12737,7 +12737,7 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -12765,7 +12765,7 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -12793,7 +12793,7 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -12821,7 +12821,7 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -12849,7 +12849,7 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -12877,7 +12877,7 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -12905,7 +12905,7 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -12933,7 +12933,7 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -12961,7 +12961,7 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -12989,7 +12989,7 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13017,7 +13017,7 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13045,7 +13045,7 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13073,7 +13073,7 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13101,7 +13101,7 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13129,7 +13129,7 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13157,7 +13157,7 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13185,7 +13185,7 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13213,7 +13213,7 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13241,7 +13241,7 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13269,11 +13269,11 @@ namespace ia32_vmx_true_procbased_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         interrupt_window_exiting::dump(level, msg);
@@ -13338,7 +13338,7 @@ namespace ia32_vmx_true_exit_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13366,7 +13366,7 @@ namespace ia32_vmx_true_exit_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13394,7 +13394,7 @@ namespace ia32_vmx_true_exit_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13422,7 +13422,7 @@ namespace ia32_vmx_true_exit_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13450,7 +13450,7 @@ namespace ia32_vmx_true_exit_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13478,7 +13478,7 @@ namespace ia32_vmx_true_exit_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13506,7 +13506,7 @@ namespace ia32_vmx_true_exit_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13534,7 +13534,7 @@ namespace ia32_vmx_true_exit_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13562,7 +13562,7 @@ namespace ia32_vmx_true_exit_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13590,11 +13590,11 @@ namespace ia32_vmx_true_exit_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         save_debug_controls::dump(level, msg);
@@ -13648,7 +13648,7 @@ namespace ia32_vmx_true_entry_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13676,7 +13676,7 @@ namespace ia32_vmx_true_entry_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13704,7 +13704,7 @@ namespace ia32_vmx_true_entry_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13732,7 +13732,7 @@ namespace ia32_vmx_true_entry_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13760,7 +13760,7 @@ namespace ia32_vmx_true_entry_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13788,7 +13788,7 @@ namespace ia32_vmx_true_entry_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13816,7 +13816,7 @@ namespace ia32_vmx_true_entry_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
@@ -13844,11 +13844,11 @@ namespace ia32_vmx_true_entry_ctls
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_allowed1(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         load_debug_controls::dump(level, msg);
@@ -13885,11 +13885,11 @@ namespace ia32_vmx_vmfunc
         inline auto is_allowed1() noexcept
         { return (_read_msr(addr) & (mask << 32)) != 0; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         eptp_switching::dump(level, msg);
@@ -13907,7 +13907,7 @@ namespace ia32_a_pmc0
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -13922,7 +13922,7 @@ namespace ia32_a_pmc1
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -13937,7 +13937,7 @@ namespace ia32_a_pmc2
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -13952,7 +13952,7 @@ namespace ia32_a_pmc3
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -13967,7 +13967,7 @@ namespace ia32_a_pmc4
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -13982,7 +13982,7 @@ namespace ia32_a_pmc5
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -13997,7 +13997,7 @@ namespace ia32_a_pmc6
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -14012,7 +14012,7 @@ namespace ia32_a_pmc7
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -14057,11 +14057,11 @@ namespace ia32_mcg_ext_ctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         lmce_en::dump(level, msg);
@@ -14094,7 +14094,7 @@ namespace ia32_sgx_svn_sinit
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -14110,11 +14110,11 @@ namespace ia32_sgx_svn_sinit
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         lock::dump(level, msg);
@@ -14151,11 +14151,11 @@ namespace ia32_rtit_output_base
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         base_phys_address::dump(level, msg);
@@ -14191,7 +14191,7 @@ namespace ia32_rtit_output_mask_ptrs
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -14213,11 +14213,11 @@ namespace ia32_rtit_output_mask_ptrs
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         mask_table_offset::dump(level, msg);
@@ -14266,7 +14266,7 @@ namespace ia32_rtit_ctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -14300,7 +14300,7 @@ namespace ia32_rtit_ctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -14334,7 +14334,7 @@ namespace ia32_rtit_ctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -14368,7 +14368,7 @@ namespace ia32_rtit_ctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -14402,7 +14402,7 @@ namespace ia32_rtit_ctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -14436,7 +14436,7 @@ namespace ia32_rtit_ctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -14470,7 +14470,7 @@ namespace ia32_rtit_ctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -14504,7 +14504,7 @@ namespace ia32_rtit_ctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -14538,7 +14538,7 @@ namespace ia32_rtit_ctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -14572,7 +14572,7 @@ namespace ia32_rtit_ctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -14606,7 +14606,7 @@ namespace ia32_rtit_ctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -14628,7 +14628,7 @@ namespace ia32_rtit_ctl
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -14650,7 +14650,7 @@ namespace ia32_rtit_ctl
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -14672,7 +14672,7 @@ namespace ia32_rtit_ctl
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -14694,7 +14694,7 @@ namespace ia32_rtit_ctl
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -14716,7 +14716,7 @@ namespace ia32_rtit_ctl
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -14738,7 +14738,7 @@ namespace ia32_rtit_ctl
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -14760,11 +14760,11 @@ namespace ia32_rtit_ctl
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         traceen::dump(level, msg);
@@ -14817,7 +14817,7 @@ namespace ia32_rtit_status
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -14839,7 +14839,7 @@ namespace ia32_rtit_status
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -14861,7 +14861,7 @@ namespace ia32_rtit_status
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -14895,7 +14895,7 @@ namespace ia32_rtit_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -14929,7 +14929,7 @@ namespace ia32_rtit_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -14951,11 +14951,11 @@ namespace ia32_rtit_status
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         filteren::dump(level, msg);
@@ -14996,11 +14996,11 @@ namespace ia32_rtit_cr3_match
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         cr3::dump(level, msg);
@@ -15036,7 +15036,7 @@ namespace ia32_rtit_addr0_a
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -15058,11 +15058,11 @@ namespace ia32_rtit_addr0_a
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         virtual_address::dump(level, msg);
@@ -15099,7 +15099,7 @@ namespace ia32_rtit_addr0_b
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -15121,11 +15121,11 @@ namespace ia32_rtit_addr0_b
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         virtual_address::dump(level, msg);
@@ -15162,7 +15162,7 @@ namespace ia32_rtit_addr1_a
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -15184,11 +15184,11 @@ namespace ia32_rtit_addr1_a
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         virtual_address::dump(level, msg);
@@ -15225,7 +15225,7 @@ namespace ia32_rtit_addr1_b
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -15247,11 +15247,11 @@ namespace ia32_rtit_addr1_b
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         virtual_address::dump(level, msg);
@@ -15288,7 +15288,7 @@ namespace ia32_rtit_addr2_a
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -15310,11 +15310,11 @@ namespace ia32_rtit_addr2_a
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         virtual_address::dump(level, msg);
@@ -15351,7 +15351,7 @@ namespace ia32_rtit_addr2_b
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -15373,11 +15373,11 @@ namespace ia32_rtit_addr2_b
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         virtual_address::dump(level, msg);
@@ -15414,7 +15414,7 @@ namespace ia32_rtit_addr3_a
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -15436,11 +15436,11 @@ namespace ia32_rtit_addr3_a
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         virtual_address::dump(level, msg);
@@ -15477,7 +15477,7 @@ namespace ia32_rtit_addr3_b
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -15499,11 +15499,11 @@ namespace ia32_rtit_addr3_b
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         virtual_address::dump(level, msg);
@@ -15522,7 +15522,7 @@ namespace ia32_ds_area
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -15537,7 +15537,7 @@ namespace ia32_tsc_deadline
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -15582,11 +15582,11 @@ namespace ia32_pm_enable
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         hwp::dump(level, msg);
@@ -15613,7 +15613,7 @@ namespace ia32_hwp_capabilities
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -15629,7 +15629,7 @@ namespace ia32_hwp_capabilities
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -15645,7 +15645,7 @@ namespace ia32_hwp_capabilities
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -15661,11 +15661,11 @@ namespace ia32_hwp_capabilities
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         highest_perf::dump(level, msg);
@@ -15704,7 +15704,7 @@ namespace ia32_hwp_request_pkg
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -15726,7 +15726,7 @@ namespace ia32_hwp_request_pkg
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -15748,7 +15748,7 @@ namespace ia32_hwp_request_pkg
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -15770,7 +15770,7 @@ namespace ia32_hwp_request_pkg
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -15792,11 +15792,11 @@ namespace ia32_hwp_request_pkg
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         min_perf::dump(level, msg);
@@ -15848,7 +15848,7 @@ namespace ia32_hwp_interrupt
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -15882,11 +15882,11 @@ namespace ia32_hwp_interrupt
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         perf_change::dump(level, msg);
@@ -15923,7 +15923,7 @@ namespace ia32_hwp_request
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -15945,7 +15945,7 @@ namespace ia32_hwp_request
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -15967,7 +15967,7 @@ namespace ia32_hwp_request
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -15989,7 +15989,7 @@ namespace ia32_hwp_request
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -16011,7 +16011,7 @@ namespace ia32_hwp_request
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -16045,11 +16045,11 @@ namespace ia32_hwp_request
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         min_perf::dump(level, msg);
@@ -16102,7 +16102,7 @@ namespace ia32_hwp_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -16136,11 +16136,11 @@ namespace ia32_hwp_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         perf_change::dump(level, msg);
@@ -16156,7 +16156,7 @@ namespace ia32_x2apic_apicid
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16168,7 +16168,7 @@ namespace ia32_x2apic_version
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16183,7 +16183,7 @@ namespace ia32_x2apic_tpr
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16195,7 +16195,7 @@ namespace ia32_x2apic_ppr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16228,7 +16228,7 @@ namespace ia32_x2apic_ldr
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -16244,11 +16244,11 @@ namespace ia32_x2apic_ldr
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         logical_id::dump(level, msg);
@@ -16285,7 +16285,7 @@ namespace ia32_x2apic_sivr
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -16319,7 +16319,7 @@ namespace ia32_x2apic_sivr
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -16353,7 +16353,7 @@ namespace ia32_x2apic_sivr
         inline auto enable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -16387,11 +16387,11 @@ namespace ia32_x2apic_sivr
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         vector::dump(level, msg);
@@ -16409,7 +16409,7 @@ namespace ia32_x2apic_isr0
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16421,7 +16421,7 @@ namespace ia32_x2apic_isr1
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16433,7 +16433,7 @@ namespace ia32_x2apic_isr2
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16445,7 +16445,7 @@ namespace ia32_x2apic_isr3
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16457,7 +16457,7 @@ namespace ia32_x2apic_isr4
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16469,7 +16469,7 @@ namespace ia32_x2apic_isr5
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16481,7 +16481,7 @@ namespace ia32_x2apic_isr6
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16493,7 +16493,7 @@ namespace ia32_x2apic_isr7
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16505,7 +16505,7 @@ namespace ia32_x2apic_tmr0
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16517,7 +16517,7 @@ namespace ia32_x2apic_tmr1
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16529,7 +16529,7 @@ namespace ia32_x2apic_tmr2
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16541,7 +16541,7 @@ namespace ia32_x2apic_tmr3
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16553,7 +16553,7 @@ namespace ia32_x2apic_tmr4
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16565,7 +16565,7 @@ namespace ia32_x2apic_tmr5
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16577,7 +16577,7 @@ namespace ia32_x2apic_tmr6
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16589,7 +16589,7 @@ namespace ia32_x2apic_tmr7
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16601,7 +16601,7 @@ namespace ia32_x2apic_irr0
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16613,7 +16613,7 @@ namespace ia32_x2apic_irr1
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16625,7 +16625,7 @@ namespace ia32_x2apic_irr2
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16637,7 +16637,7 @@ namespace ia32_x2apic_irr3
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16649,7 +16649,7 @@ namespace ia32_x2apic_irr4
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16661,7 +16661,7 @@ namespace ia32_x2apic_irr5
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16673,7 +16673,7 @@ namespace ia32_x2apic_irr6
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16685,7 +16685,7 @@ namespace ia32_x2apic_irr7
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16700,7 +16700,7 @@ namespace ia32_x2apic_esr
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -16733,7 +16733,7 @@ namespace ia32_x2apic_lvt_cmci
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -16761,7 +16761,7 @@ namespace ia32_x2apic_lvt_cmci
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case fixed: bfdebug_subtext(level, name, "fixed", msg); break;
@@ -16795,7 +16795,7 @@ namespace ia32_x2apic_lvt_cmci
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case idle: bfdebug_subtext(level, name, "idle", msg); break;
@@ -16834,11 +16834,11 @@ namespace ia32_x2apic_lvt_cmci
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(),  msg);
         vector::dump(level, msg);
@@ -16877,7 +16877,7 @@ namespace ia32_x2apic_icr
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -16905,7 +16905,7 @@ namespace ia32_x2apic_icr
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case fixed: bfdebug_subtext(level, name, "fixed", msg); break;
@@ -16939,7 +16939,7 @@ namespace ia32_x2apic_icr
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case physical: bfdebug_subtext(level, name, "physical", msg); break;
@@ -16978,7 +16978,7 @@ namespace ia32_x2apic_icr
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -17003,7 +17003,7 @@ namespace ia32_x2apic_icr
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case edge_mode: bfdebug_subtext(level, name, "edge", msg); break;
@@ -17035,7 +17035,7 @@ namespace ia32_x2apic_icr
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int lev, std::string *msg = nullptr)
+        inline void dump(int lev, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case no_shorthand: bfdebug_subtext(lev, name, "no_shorthand", msg); break;
@@ -17064,11 +17064,11 @@ namespace ia32_x2apic_icr
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         vector::dump(level, msg);
@@ -17110,7 +17110,7 @@ namespace ia32_x2apic_lvt_timer
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -17135,7 +17135,7 @@ namespace ia32_x2apic_lvt_timer
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case idle: bfdebug_subtext(level, name, "idle", msg); break;
@@ -17174,7 +17174,7 @@ namespace ia32_x2apic_lvt_timer
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -17200,7 +17200,7 @@ namespace ia32_x2apic_lvt_timer
         inline auto set(value_type msr, value_type val)
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case one_shot: bfdebug_subtext(level, name, "one-shot", msg); break;
@@ -17211,7 +17211,7 @@ namespace ia32_x2apic_lvt_timer
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         vector::dump(level, msg);
@@ -17250,7 +17250,7 @@ namespace ia32_x2apic_lvt_thermal
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -17278,7 +17278,7 @@ namespace ia32_x2apic_lvt_thermal
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case fixed: bfdebug_subtext(level, name, "fixed", msg); break;
@@ -17312,7 +17312,7 @@ namespace ia32_x2apic_lvt_thermal
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case idle: bfdebug_subtext(level, name, "idle", msg); break;
@@ -17351,11 +17351,11 @@ namespace ia32_x2apic_lvt_thermal
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(),  msg);
         vector::dump(level, msg);
@@ -17394,7 +17394,7 @@ namespace ia32_x2apic_lvt_pmi
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -17422,7 +17422,7 @@ namespace ia32_x2apic_lvt_pmi
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case fixed: bfdebug_subtext(level, name, "fixed", msg); break;
@@ -17456,7 +17456,7 @@ namespace ia32_x2apic_lvt_pmi
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case idle: bfdebug_subtext(level, name, "idle", msg); break;
@@ -17495,11 +17495,11 @@ namespace ia32_x2apic_lvt_pmi
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(),  msg);
         vector::dump(level, msg);
@@ -17538,7 +17538,7 @@ namespace ia32_x2apic_lvt_lint0
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -17566,7 +17566,7 @@ namespace ia32_x2apic_lvt_lint0
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case fixed: bfdebug_subtext(level, name, "fixed", msg); break;
@@ -17600,7 +17600,7 @@ namespace ia32_x2apic_lvt_lint0
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case idle: bfdebug_subtext(level, name, "idle", msg); break;
@@ -17630,7 +17630,7 @@ namespace ia32_x2apic_lvt_lint0
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case active_high: bfdebug_subtext(level, name, "active_high", msg); break;
@@ -17651,7 +17651,7 @@ namespace ia32_x2apic_lvt_lint0
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -17676,7 +17676,7 @@ namespace ia32_x2apic_lvt_lint0
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case edge_mode: bfdebug_subtext(level, name, "edge", msg); break;
@@ -17715,11 +17715,11 @@ namespace ia32_x2apic_lvt_lint0
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(),  msg);
         vector::dump(level, msg);
@@ -17760,7 +17760,7 @@ namespace ia32_x2apic_lvt_lint1
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -17788,7 +17788,7 @@ namespace ia32_x2apic_lvt_lint1
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case fixed: bfdebug_subtext(level, name, "fixed", msg); break;
@@ -17822,7 +17822,7 @@ namespace ia32_x2apic_lvt_lint1
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case idle: bfdebug_subtext(level, name, "idle", msg); break;
@@ -17852,7 +17852,7 @@ namespace ia32_x2apic_lvt_lint1
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case active_high: bfdebug_subtext(level, name, "active_high", msg); break;
@@ -17873,7 +17873,7 @@ namespace ia32_x2apic_lvt_lint1
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -17898,7 +17898,7 @@ namespace ia32_x2apic_lvt_lint1
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case edge_mode: bfdebug_subtext(level, name, "edge", msg); break;
@@ -17937,11 +17937,11 @@ namespace ia32_x2apic_lvt_lint1
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(),  msg);
         vector::dump(level, msg);
@@ -17982,7 +17982,7 @@ namespace ia32_x2apic_lvt_error
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -18007,7 +18007,7 @@ namespace ia32_x2apic_lvt_error
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             switch (get()) {
                 case idle: bfdebug_subtext(level, name, "idle", msg); break;
@@ -18016,7 +18016,7 @@ namespace ia32_x2apic_lvt_error
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(),  msg);
         vector::dump(level, msg);
@@ -18035,7 +18035,7 @@ namespace ia32_x2apic_init_count
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -18047,7 +18047,7 @@ namespace ia32_x2apic_cur_count
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -18062,7 +18062,7 @@ namespace ia32_x2apic_div_conf
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -18129,7 +18129,7 @@ namespace ia32_debug_interface
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -18163,7 +18163,7 @@ namespace ia32_debug_interface
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -18197,11 +18197,11 @@ namespace ia32_debug_interface
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         enable::dump(level, msg);
@@ -18251,11 +18251,11 @@ namespace ia32_l3_qos_cfg
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         enable::dump(level, msg);
@@ -18291,7 +18291,7 @@ namespace ia32_qm_evtsel
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -18313,11 +18313,11 @@ namespace ia32_qm_evtsel
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         event_id::dump(level, msg);
@@ -18345,7 +18345,7 @@ namespace ia32_qm_ctr
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -18367,7 +18367,7 @@ namespace ia32_qm_ctr
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -18389,11 +18389,11 @@ namespace ia32_qm_ctr
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         resource_monitored_data::dump(level, msg);
@@ -18431,7 +18431,7 @@ namespace ia32_pqr_assoc
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -18453,11 +18453,11 @@ namespace ia32_pqr_assoc
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         resource_monitoring_id::dump(level, msg);
@@ -18506,7 +18506,7 @@ namespace ia32_bndcfgs
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -18540,7 +18540,7 @@ namespace ia32_bndcfgs
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -18562,11 +18562,11 @@ namespace ia32_bndcfgs
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         en::dump(level, msg);
@@ -18616,11 +18616,11 @@ namespace ia32_xss
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         trace_packet::dump(level, msg);
@@ -18668,11 +18668,11 @@ namespace ia32_pkg_hdc_ctl
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         hdc_pkg_enable::dump(level, msg);
@@ -18720,11 +18720,11 @@ namespace ia32_pm_ctl1
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         hdc_allow_block::dump(level, msg);
@@ -18757,11 +18757,11 @@ namespace ia32_thread_stall
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         stall_cycle_cnt::dump(level, msg);
@@ -18809,7 +18809,7 @@ namespace ia32_efer
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -18843,7 +18843,7 @@ namespace ia32_efer
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -18877,7 +18877,7 @@ namespace ia32_efer
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -18911,11 +18911,11 @@ namespace ia32_efer
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         sce::dump(level, msg);
@@ -18936,7 +18936,7 @@ namespace ia32_fs_base
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -18951,7 +18951,7 @@ namespace ia32_gs_base
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -58,7 +58,7 @@ namespace virtual_processor_identifier
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -82,7 +82,7 @@ namespace posted_interrupt_notification_vector
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -109,7 +109,7 @@ namespace eptp_index
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
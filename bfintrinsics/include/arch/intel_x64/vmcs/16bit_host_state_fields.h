@@ -79,7 +79,7 @@ namespace host_es_selector
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -134,7 +134,7 @@ namespace host_es_selector
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -162,11 +162,11 @@ namespace host_es_selector
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         rpl::dump(level, msg);
@@ -219,7 +219,7 @@ namespace host_cs_selector
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -274,7 +274,7 @@ namespace host_cs_selector
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -302,11 +302,11 @@ namespace host_cs_selector
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         rpl::dump(level, msg);
@@ -359,7 +359,7 @@ namespace host_ss_selector
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -414,7 +414,7 @@ namespace host_ss_selector
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -442,11 +442,11 @@ namespace host_ss_selector
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         rpl::dump(level, msg);
@@ -499,7 +499,7 @@ namespace host_ds_selector
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -554,7 +554,7 @@ namespace host_ds_selector
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -582,11 +582,11 @@ namespace host_ds_selector
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         rpl::dump(level, msg);
@@ -639,7 +639,7 @@ namespace host_fs_selector
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -694,7 +694,7 @@ namespace host_fs_selector
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -722,11 +722,11 @@ namespace host_fs_selector
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         rpl::dump(level, msg);
@@ -779,7 +779,7 @@ namespace host_gs_selector
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -834,7 +834,7 @@ namespace host_gs_selector
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -862,11 +862,11 @@ namespace host_gs_selector
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         rpl::dump(level, msg);
@@ -919,7 +919,7 @@ namespace host_tr_selector
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -974,7 +974,7 @@ namespace host_tr_selector
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -1002,11 +1002,11 @@ namespace host_tr_selector
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         rpl::dump(level, msg);
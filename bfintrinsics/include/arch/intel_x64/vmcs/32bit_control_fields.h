@@ -97,7 +97,7 @@ namespace pin_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -143,7 +143,7 @@ namespace pin_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -189,7 +189,7 @@ namespace pin_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -235,7 +235,7 @@ namespace pin_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -281,11 +281,11 @@ namespace pin_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, "pin_based_vm_execution_controls", get(), msg);
         external_interrupt_exiting::dump(level, msg);
@@ -358,7 +358,7 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -404,7 +404,7 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -450,7 +450,7 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -496,7 +496,7 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -542,7 +542,7 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -588,7 +588,7 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -634,7 +634,7 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -680,7 +680,7 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -726,7 +726,7 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -772,7 +772,7 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -818,7 +818,7 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -864,7 +864,7 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -910,7 +910,7 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -956,7 +956,7 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -1002,7 +1002,7 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -1048,7 +1048,7 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -1094,7 +1094,7 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -1140,7 +1140,7 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -1186,7 +1186,7 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -1232,7 +1232,7 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -1278,11 +1278,11 @@ namespace primary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, "primary_processor_based_vm_execution_controls", get(), msg);
         interrupt_window_exiting::dump(level, msg);
@@ -1329,7 +1329,7 @@ namespace exception_bitmap
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -1353,7 +1353,7 @@ namespace page_fault_error_code_mask
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -1377,7 +1377,7 @@ namespace page_fault_error_code_match
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -1401,7 +1401,7 @@ namespace cr3_target_count
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -1467,7 +1467,7 @@ namespace vm_exit_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -1513,7 +1513,7 @@ namespace vm_exit_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -1559,7 +1559,7 @@ namespace vm_exit_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -1605,7 +1605,7 @@ namespace vm_exit_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -1651,7 +1651,7 @@ namespace vm_exit_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -1697,7 +1697,7 @@ namespace vm_exit_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -1743,7 +1743,7 @@ namespace vm_exit_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -1789,7 +1789,7 @@ namespace vm_exit_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -1835,7 +1835,7 @@ namespace vm_exit_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -1881,7 +1881,7 @@ namespace vm_exit_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -1927,11 +1927,11 @@ namespace vm_exit_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, "vm_exit_controls", get(), msg);
         save_debug_controls::dump(level, msg);
@@ -1968,7 +1968,7 @@ namespace vm_exit_msr_store_count
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -1992,7 +1992,7 @@ namespace vm_exit_msr_load_count
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -2058,7 +2058,7 @@ namespace vm_entry_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -2104,7 +2104,7 @@ namespace vm_entry_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -2150,7 +2150,7 @@ namespace vm_entry_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -2196,7 +2196,7 @@ namespace vm_entry_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -2242,7 +2242,7 @@ namespace vm_entry_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -2288,7 +2288,7 @@ namespace vm_entry_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -2334,7 +2334,7 @@ namespace vm_entry_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -2380,7 +2380,7 @@ namespace vm_entry_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -2426,11 +2426,11 @@ namespace vm_entry_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, "vm_entry_controls", get(), msg);
         load_debug_controls::dump(level, msg);
@@ -2465,7 +2465,7 @@ namespace vm_entry_msr_load_count
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -2513,7 +2513,7 @@ namespace vm_entry_interruption_information
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -2550,7 +2550,7 @@ namespace vm_entry_interruption_information
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -2605,7 +2605,7 @@ namespace vm_entry_interruption_information
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2633,7 +2633,7 @@ namespace vm_entry_interruption_information
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -2688,11 +2688,11 @@ namespace vm_entry_interruption_information
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         vector::dump(level, msg);
@@ -2723,7 +2723,7 @@ namespace vm_entry_exception_error_code
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -2747,7 +2747,7 @@ namespace vm_entry_instruction_length
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -2771,7 +2771,7 @@ namespace tpr_threshold
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -2837,7 +2837,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -2883,7 +2883,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -2929,7 +2929,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -2975,7 +2975,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -3021,7 +3021,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -3067,7 +3067,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -3113,7 +3113,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -3159,7 +3159,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -3205,7 +3205,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -3251,7 +3251,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -3297,7 +3297,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -3343,7 +3343,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -3389,7 +3389,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -3435,7 +3435,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -3481,7 +3481,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -3527,7 +3527,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -3573,7 +3573,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -3619,7 +3619,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -3665,7 +3665,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -3711,7 +3711,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -3757,7 +3757,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -3803,7 +3803,7 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
@@ -3849,11 +3849,11 @@ namespace secondary_processor_based_vm_execution_controls
         inline void set_if_allowed(bool val, bool verbose = false)
         { val ? enable_if_allowed(verbose) : disable_if_allowed(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vm_control(level, exists(), is_allowed1(), is_enabled_if_exists(), name, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, "secondary_processor_based_vm_execution_controls", get(), msg);
         virtualize_apic_accesses::dump(level, msg);
@@ -3905,7 +3905,7 @@ namespace ple_gap
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -3932,7 +3932,7 @@ namespace ple_window
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -55,7 +55,7 @@ namespace guest_es_limit
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -79,7 +79,7 @@ namespace guest_cs_limit
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -103,7 +103,7 @@ namespace guest_ss_limit
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -127,7 +127,7 @@ namespace guest_ds_limit
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -151,7 +151,7 @@ namespace guest_fs_limit
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -175,7 +175,7 @@ namespace guest_gs_limit
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -199,7 +199,7 @@ namespace guest_ldtr_limit
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -223,7 +223,7 @@ namespace guest_tr_limit
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -247,7 +247,7 @@ namespace guest_gdtr_limit
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 
     inline auto size()
@@ -274,7 +274,7 @@ namespace guest_idtr_limit
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 
     inline auto size()
@@ -325,7 +325,7 @@ namespace guest_es_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -380,7 +380,7 @@ namespace guest_es_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -408,7 +408,7 @@ namespace guest_es_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -463,7 +463,7 @@ namespace guest_es_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -518,7 +518,7 @@ namespace guest_es_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -573,7 +573,7 @@ namespace guest_es_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -628,7 +628,7 @@ namespace guest_es_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -683,7 +683,7 @@ namespace guest_es_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -711,7 +711,7 @@ namespace guest_es_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -766,11 +766,11 @@ namespace guest_es_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         type::dump(level, msg);
@@ -830,7 +830,7 @@ namespace guest_cs_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -885,7 +885,7 @@ namespace guest_cs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -913,7 +913,7 @@ namespace guest_cs_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -968,7 +968,7 @@ namespace guest_cs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -1023,7 +1023,7 @@ namespace guest_cs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -1078,7 +1078,7 @@ namespace guest_cs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -1133,7 +1133,7 @@ namespace guest_cs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -1188,7 +1188,7 @@ namespace guest_cs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -1216,7 +1216,7 @@ namespace guest_cs_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -1271,11 +1271,11 @@ namespace guest_cs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         type::dump(level, msg);
@@ -1335,7 +1335,7 @@ namespace guest_ss_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -1390,7 +1390,7 @@ namespace guest_ss_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -1418,7 +1418,7 @@ namespace guest_ss_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -1473,7 +1473,7 @@ namespace guest_ss_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -1528,7 +1528,7 @@ namespace guest_ss_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -1583,7 +1583,7 @@ namespace guest_ss_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -1638,7 +1638,7 @@ namespace guest_ss_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -1693,7 +1693,7 @@ namespace guest_ss_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -1721,7 +1721,7 @@ namespace guest_ss_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -1776,11 +1776,11 @@ namespace guest_ss_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         type::dump(level, msg);
@@ -1840,7 +1840,7 @@ namespace guest_ds_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -1895,7 +1895,7 @@ namespace guest_ds_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -1923,7 +1923,7 @@ namespace guest_ds_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -1978,7 +1978,7 @@ namespace guest_ds_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2033,7 +2033,7 @@ namespace guest_ds_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2088,7 +2088,7 @@ namespace guest_ds_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2143,7 +2143,7 @@ namespace guest_ds_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2198,7 +2198,7 @@ namespace guest_ds_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2226,7 +2226,7 @@ namespace guest_ds_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -2281,11 +2281,11 @@ namespace guest_ds_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         type::dump(level, msg);
@@ -2345,7 +2345,7 @@ namespace guest_fs_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -2400,7 +2400,7 @@ namespace guest_fs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2428,7 +2428,7 @@ namespace guest_fs_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -2483,7 +2483,7 @@ namespace guest_fs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2538,7 +2538,7 @@ namespace guest_fs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2593,7 +2593,7 @@ namespace guest_fs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2648,7 +2648,7 @@ namespace guest_fs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2703,7 +2703,7 @@ namespace guest_fs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2731,7 +2731,7 @@ namespace guest_fs_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -2786,11 +2786,11 @@ namespace guest_fs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         type::dump(level, msg);
@@ -2850,7 +2850,7 @@ namespace guest_gs_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -2905,7 +2905,7 @@ namespace guest_gs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2933,7 +2933,7 @@ namespace guest_gs_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -2988,7 +2988,7 @@ namespace guest_gs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -3043,7 +3043,7 @@ namespace guest_gs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -3098,7 +3098,7 @@ namespace guest_gs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -3153,7 +3153,7 @@ namespace guest_gs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -3208,7 +3208,7 @@ namespace guest_gs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -3236,7 +3236,7 @@ namespace guest_gs_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -3291,11 +3291,11 @@ namespace guest_gs_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         type::dump(level, msg);
@@ -3355,7 +3355,7 @@ namespace guest_ldtr_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -3410,7 +3410,7 @@ namespace guest_ldtr_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -3438,7 +3438,7 @@ namespace guest_ldtr_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -3493,7 +3493,7 @@ namespace guest_ldtr_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -3548,7 +3548,7 @@ namespace guest_ldtr_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -3603,7 +3603,7 @@ namespace guest_ldtr_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -3658,7 +3658,7 @@ namespace guest_ldtr_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -3713,7 +3713,7 @@ namespace guest_ldtr_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -3741,7 +3741,7 @@ namespace guest_ldtr_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -3796,11 +3796,11 @@ namespace guest_ldtr_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         type::dump(level, msg);
@@ -3860,7 +3860,7 @@ namespace guest_tr_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -3915,7 +3915,7 @@ namespace guest_tr_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -3943,7 +3943,7 @@ namespace guest_tr_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -3998,7 +3998,7 @@ namespace guest_tr_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -4053,7 +4053,7 @@ namespace guest_tr_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -4108,7 +4108,7 @@ namespace guest_tr_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -4163,7 +4163,7 @@ namespace guest_tr_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -4218,7 +4218,7 @@ namespace guest_tr_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -4246,7 +4246,7 @@ namespace guest_tr_access_rights
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -4301,11 +4301,11 @@ namespace guest_tr_access_rights
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         type::dump(level, msg);
@@ -4392,7 +4392,7 @@ namespace guest_interruptibility_state
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -4447,7 +4447,7 @@ namespace guest_interruptibility_state
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -4502,7 +4502,7 @@ namespace guest_interruptibility_state
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -4557,7 +4557,7 @@ namespace guest_interruptibility_state
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -4612,7 +4612,7 @@ namespace guest_interruptibility_state
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -4640,11 +4640,11 @@ namespace guest_interruptibility_state
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         blocking_by_sti::dump(level, msg);
@@ -4681,7 +4681,7 @@ namespace guest_activity_state
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -4705,7 +4705,7 @@ namespace guest_smbase
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -4729,7 +4729,7 @@ namespace guest_ia32_sysenter_cs
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -4753,7 +4753,7 @@ namespace vmx_preemption_timer_value
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -55,7 +55,7 @@ namespace host_ia32_sysenter_cs
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -413,7 +413,7 @@ namespace exit_reason
             return basic_exit_reason_description(field);
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_text(level, msg); }
     }
 
@@ -426,7 +426,7 @@ namespace exit_reason
         inline auto get()
         { return get_bits(get_vmcs_field(addr, name, true), mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -454,7 +454,7 @@ namespace exit_reason
         inline auto is_disabled_if_exists(bool verbose = false)
         { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, true), from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -482,7 +482,7 @@ namespace exit_reason
         inline auto is_disabled_if_exists(bool verbose = false)
         { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, true), from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -510,7 +510,7 @@ namespace exit_reason
         inline auto is_disabled_if_exists(bool verbose = false)
         { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, true), from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -538,11 +538,11 @@ namespace exit_reason
         inline auto is_disabled_if_exists(bool verbose = false)
         { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, true), from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         basic_exit_reason::dump(level, msg);
@@ -583,7 +583,7 @@ namespace vm_exit_interruption_information
         inline auto get_if_exists(bool verbose = false)
         { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -607,7 +607,7 @@ namespace vm_exit_interruption_information
         inline auto get_if_exists(bool verbose = false)
         { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -635,7 +635,7 @@ namespace vm_exit_interruption_information
         inline auto is_disabled_if_exists(bool verbose = false)
         { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -663,7 +663,7 @@ namespace vm_exit_interruption_information
         inline auto is_disabled_if_exists(bool verbose = false)
         { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -682,7 +682,7 @@ namespace vm_exit_interruption_information
         inline auto get_if_exists(bool verbose = false)
         { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -710,11 +710,11 @@ namespace vm_exit_interruption_information
         inline auto is_disabled_if_exists(bool verbose = false)
         { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         vector::dump(level, msg);
@@ -740,7 +740,7 @@ namespace vm_exit_interruption_error_code
     inline auto get_if_exists(bool verbose = false)
     { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -773,7 +773,7 @@ namespace idt_vectoring_information
         inline auto get_if_exists(bool verbose = false)
         { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -799,7 +799,7 @@ namespace idt_vectoring_information
         inline auto get_if_exists(bool verbose = false)
         { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -827,7 +827,7 @@ namespace idt_vectoring_information
         inline auto is_disabled_if_exists(bool verbose = false)
         { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -846,7 +846,7 @@ namespace idt_vectoring_information
         inline auto get_if_exists(bool verbose = false)
         { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -874,11 +874,11 @@ namespace idt_vectoring_information
         inline auto is_disabled_if_exists(bool verbose = false)
         { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         vector::dump(level, msg);
@@ -903,7 +903,7 @@ namespace idt_vectoring_error_code
     inline auto get_if_exists(bool verbose = false)
     { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -921,7 +921,7 @@ namespace vm_exit_instruction_length
     inline auto get_if_exists(bool verbose = false)
     { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -939,7 +939,7 @@ namespace vm_exit_instruction_information
     inline auto get_if_exists(bool verbose = false)
     { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 
     namespace ins
@@ -971,11 +971,11 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             address_size::dump(level, msg);
@@ -1011,7 +1011,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1037,11 +1037,11 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             address_size::dump(level, msg);
@@ -1079,7 +1079,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1102,7 +1102,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1128,7 +1128,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1164,7 +1164,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1192,7 +1192,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -1228,7 +1228,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1256,7 +1256,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -1292,11 +1292,11 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             scaling::dump(level, msg);
@@ -1340,7 +1340,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1363,7 +1363,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1389,7 +1389,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1425,7 +1425,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1453,7 +1453,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -1489,7 +1489,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1517,7 +1517,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -1553,11 +1553,11 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             scaling::dump(level, msg);
@@ -1601,7 +1601,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1624,7 +1624,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1650,7 +1650,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1686,7 +1686,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1714,7 +1714,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -1750,7 +1750,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1778,7 +1778,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -1814,11 +1814,11 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             scaling::dump(level, msg);
@@ -1862,7 +1862,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1885,7 +1885,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1907,7 +1907,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1933,7 +1933,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1969,7 +1969,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1997,7 +1997,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -2033,7 +2033,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -2061,7 +2061,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -2085,11 +2085,11 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             scaling::dump(level, msg);
@@ -2134,7 +2134,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -2157,7 +2157,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -2179,7 +2179,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -2205,7 +2205,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -2241,7 +2241,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -2269,7 +2269,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -2305,7 +2305,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -2333,7 +2333,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -2357,11 +2357,11 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             scaling::dump(level, msg);
@@ -2406,7 +2406,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -2429,7 +2429,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -2451,7 +2451,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -2477,7 +2477,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -2513,7 +2513,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -2541,7 +2541,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -2577,7 +2577,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -2605,7 +2605,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -2629,11 +2629,11 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             scaling::dump(level, msg);
@@ -2678,7 +2678,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -2701,7 +2701,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -2723,7 +2723,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -2749,7 +2749,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -2785,7 +2785,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -2813,7 +2813,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -2849,7 +2849,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -2877,7 +2877,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -2901,11 +2901,11 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             scaling::dump(level, msg);
@@ -2950,7 +2950,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -2986,7 +2986,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3009,7 +3009,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3031,7 +3031,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3057,7 +3057,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3093,7 +3093,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3121,7 +3121,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -3157,7 +3157,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3185,7 +3185,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -3209,11 +3209,11 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             scaling::dump(level, msg);
@@ -3259,7 +3259,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3295,7 +3295,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3318,7 +3318,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3340,7 +3340,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3366,7 +3366,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3402,7 +3402,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3430,7 +3430,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -3466,7 +3466,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3494,7 +3494,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -3518,11 +3518,11 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             scaling::dump(level, msg);
@@ -3568,7 +3568,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3604,7 +3604,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3627,7 +3627,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3649,7 +3649,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3675,7 +3675,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3711,7 +3711,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3739,7 +3739,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -3775,7 +3775,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3803,7 +3803,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -3827,11 +3827,11 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             scaling::dump(level, msg);
@@ -3877,7 +3877,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3913,7 +3913,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3936,7 +3936,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3958,7 +3958,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -3984,7 +3984,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -4020,7 +4020,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -4048,7 +4048,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -4084,7 +4084,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -4112,7 +4112,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -4136,11 +4136,11 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             scaling::dump(level, msg);
@@ -4198,7 +4198,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -4221,11 +4221,11 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             destination_register::dump(level, msg);
@@ -4275,7 +4275,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -4298,11 +4298,11 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             destination_register::dump(level, msg);
@@ -4340,7 +4340,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -4363,7 +4363,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -4389,7 +4389,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -4425,7 +4425,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -4453,7 +4453,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -4489,7 +4489,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -4517,11 +4517,11 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             scaling::dump(level, msg);
@@ -4564,7 +4564,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -4587,7 +4587,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -4613,7 +4613,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -4649,7 +4649,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -4677,7 +4677,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -4713,7 +4713,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -4741,11 +4741,11 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             scaling::dump(level, msg);
@@ -4788,7 +4788,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -4811,7 +4811,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -4837,7 +4837,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -4873,7 +4873,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -4901,7 +4901,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -4937,7 +4937,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -4965,11 +4965,11 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             scaling::dump(level, msg);
@@ -5012,7 +5012,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5035,7 +5035,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5061,7 +5061,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5097,7 +5097,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5125,7 +5125,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -5161,7 +5161,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5189,11 +5189,11 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             scaling::dump(level, msg);
@@ -5236,7 +5236,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5259,7 +5259,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5285,7 +5285,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5321,7 +5321,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5349,7 +5349,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -5385,7 +5385,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5413,11 +5413,11 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             scaling::dump(level, msg);
@@ -5460,7 +5460,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5483,7 +5483,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5509,7 +5509,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5545,7 +5545,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5573,7 +5573,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -5609,7 +5609,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5637,11 +5637,11 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             scaling::dump(level, msg);
@@ -5684,7 +5684,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5720,7 +5720,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5743,7 +5743,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5765,7 +5765,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5791,7 +5791,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5827,7 +5827,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5855,7 +5855,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -5891,7 +5891,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -5919,7 +5919,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -5955,11 +5955,11 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             scaling::dump(level, msg);
@@ -6005,7 +6005,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -6041,7 +6041,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -6064,7 +6064,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -6086,7 +6086,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -6112,7 +6112,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -6148,7 +6148,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -6176,7 +6176,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -6212,7 +6212,7 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -6240,7 +6240,7 @@ namespace vm_exit_instruction_information
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -6276,11 +6276,11 @@ namespace vm_exit_instruction_information
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             scaling::dump(level, msg);
@@ -55,7 +55,7 @@ namespace vmcs_link_pointer
     inline void set_if_exists(value_type val, bool verbose = false)
     { set_vmcs_field_if_exists(val, addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -130,7 +130,7 @@ namespace guest_ia32_debugctl
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -185,7 +185,7 @@ namespace guest_ia32_debugctl
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -240,7 +240,7 @@ namespace guest_ia32_debugctl
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -295,7 +295,7 @@ namespace guest_ia32_debugctl
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -350,7 +350,7 @@ namespace guest_ia32_debugctl
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -405,7 +405,7 @@ namespace guest_ia32_debugctl
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -460,7 +460,7 @@ namespace guest_ia32_debugctl
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -515,7 +515,7 @@ namespace guest_ia32_debugctl
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
     namespace freeze_perfmon_on_pmi
@@ -569,7 +569,7 @@ namespace guest_ia32_debugctl
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -624,7 +624,7 @@ namespace guest_ia32_debugctl
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -679,7 +679,7 @@ namespace guest_ia32_debugctl
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -734,7 +734,7 @@ namespace guest_ia32_debugctl
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -762,11 +762,11 @@ namespace guest_ia32_debugctl
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         lbr::dump(level, msg);
@@ -856,7 +856,7 @@ namespace guest_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -884,11 +884,11 @@ namespace guest_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             memory_type::dump(level, msg);
@@ -944,7 +944,7 @@ namespace guest_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -972,11 +972,11 @@ namespace guest_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             memory_type::dump(level, msg);
@@ -1032,7 +1032,7 @@ namespace guest_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1060,11 +1060,11 @@ namespace guest_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             memory_type::dump(level, msg);
@@ -1120,7 +1120,7 @@ namespace guest_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1148,11 +1148,11 @@ namespace guest_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             memory_type::dump(level, msg);
@@ -1208,7 +1208,7 @@ namespace guest_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1236,11 +1236,11 @@ namespace guest_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             memory_type::dump(level, msg);
@@ -1296,7 +1296,7 @@ namespace guest_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1324,11 +1324,11 @@ namespace guest_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             memory_type::dump(level, msg);
@@ -1384,7 +1384,7 @@ namespace guest_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1412,11 +1412,11 @@ namespace guest_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             memory_type::dump(level, msg);
@@ -1472,7 +1472,7 @@ namespace guest_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1500,11 +1500,11 @@ namespace guest_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             memory_type::dump(level, msg);
@@ -1512,7 +1512,7 @@ namespace guest_ia32_pat
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         pa0::dump(level, msg);
@@ -1600,7 +1600,7 @@ namespace guest_ia32_efer
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -1655,7 +1655,7 @@ namespace guest_ia32_efer
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -1710,7 +1710,7 @@ namespace guest_ia32_efer
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -1765,7 +1765,7 @@ namespace guest_ia32_efer
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -1793,11 +1793,11 @@ namespace guest_ia32_efer
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         sce::dump(level, msg);
@@ -1851,11 +1851,11 @@ namespace guest_ia32_perf_global_ctrl
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         reserved::dump(level, msg);
@@ -1936,7 +1936,7 @@ namespace guest_pdpte0
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -1966,7 +1966,7 @@ namespace guest_pdpte0
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask(), from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -2021,7 +2021,7 @@ namespace guest_pdpte0
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2076,7 +2076,7 @@ namespace guest_pdpte0
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2106,11 +2106,11 @@ namespace guest_pdpte0
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask(), from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         present::dump(level, msg);
@@ -2195,7 +2195,7 @@ namespace guest_pdpte1
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2225,7 +2225,7 @@ namespace guest_pdpte1
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask(), from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -2280,7 +2280,7 @@ namespace guest_pdpte1
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2335,7 +2335,7 @@ namespace guest_pdpte1
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2365,11 +2365,11 @@ namespace guest_pdpte1
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask(), from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         present::dump(level, msg);
@@ -2454,7 +2454,7 @@ namespace guest_pdpte2
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2484,7 +2484,7 @@ namespace guest_pdpte2
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask(), from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -2539,7 +2539,7 @@ namespace guest_pdpte2
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2594,7 +2594,7 @@ namespace guest_pdpte2
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2624,11 +2624,11 @@ namespace guest_pdpte2
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask(), from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         present::dump(level, msg);
@@ -2713,7 +2713,7 @@ namespace guest_pdpte3
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2743,7 +2743,7 @@ namespace guest_pdpte3
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask(), from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -2798,7 +2798,7 @@ namespace guest_pdpte3
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2853,7 +2853,7 @@ namespace guest_pdpte3
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -2883,11 +2883,11 @@ namespace guest_pdpte3
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask(), from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         present::dump(level, msg);
@@ -2972,7 +2972,7 @@ namespace guest_ia32_bndcfgs
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -3027,7 +3027,7 @@ namespace guest_ia32_bndcfgs
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -3055,7 +3055,7 @@ namespace guest_ia32_bndcfgs
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
@@ -3083,11 +3083,11 @@ namespace guest_ia32_bndcfgs
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         en::dump(level, msg);
@@ -103,7 +103,7 @@ namespace host_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -131,11 +131,11 @@ namespace host_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             memory_type::dump(level, msg);
@@ -191,7 +191,7 @@ namespace host_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -219,11 +219,11 @@ namespace host_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             memory_type::dump(level, msg);
@@ -279,7 +279,7 @@ namespace host_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -307,11 +307,11 @@ namespace host_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             memory_type::dump(level, msg);
@@ -367,7 +367,7 @@ namespace host_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -395,11 +395,11 @@ namespace host_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             memory_type::dump(level, msg);
@@ -455,7 +455,7 @@ namespace host_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -483,11 +483,11 @@ namespace host_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             memory_type::dump(level, msg);
@@ -543,7 +543,7 @@ namespace host_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -571,11 +571,11 @@ namespace host_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             memory_type::dump(level, msg);
@@ -631,7 +631,7 @@ namespace host_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -659,11 +659,11 @@ namespace host_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             memory_type::dump(level, msg);
@@ -719,7 +719,7 @@ namespace host_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -747,11 +747,11 @@ namespace host_ia32_pat
             inline void set_if_exists(value_type val, bool verbose = false)
             { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             memory_type::dump(level, msg);
@@ -759,7 +759,7 @@ namespace host_ia32_pat
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         pa0::dump(level, msg);
@@ -844,7 +844,7 @@ namespace host_ia32_efer
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -899,7 +899,7 @@ namespace host_ia32_efer
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -954,7 +954,7 @@ namespace host_ia32_efer
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -1009,7 +1009,7 @@ namespace host_ia32_efer
         inline void set_if_exists(bool val, bool verbose = false)
         { val ? enable_if_exists(verbose) : disable_if_exists(verbose); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subbool(level, msg); }
     }
 
@@ -1037,11 +1037,11 @@ namespace host_ia32_efer
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         sce::dump(level, msg);
@@ -1095,11 +1095,11 @@ namespace host_ia32_perf_global_ctrl
         inline void set_if_exists(value_type val, bool verbose = false)
         { set_vmcs_field_bits_if_exists(val, addr, mask, from, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_subnhex(level, msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         dump_vmcs_nhex(level, msg);
         reserved::dump(level, msg);
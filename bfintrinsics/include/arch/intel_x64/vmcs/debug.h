@@ -46,7 +46,7 @@ namespace debug
 {
     inline void dump(int level = 0)
     {
-        bfdebug_transaction(level, [&](std::string * msg) {
+        bfdebug_transaction(level, [&](bfdebug_msg_t * msg) {
             bfdebug_lnbr(level, msg);
             bfdebug_info(level, "16bit control fields", msg);
             bfdebug_brk3(level, msg);
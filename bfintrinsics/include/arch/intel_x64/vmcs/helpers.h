@@ -210,7 +210,7 @@ disable_vm_control_if_allowed(
 }
 
 inline void
-dump_vm_control(int level, bool exists, bool is_allowed1, bool enabled, const char *name, std::string *msg)
+dump_vm_control(int level, bool exists, bool is_allowed1, bool enabled, const char *name, bfdebug_msg_t *msg)
 {
     if (!exists || !is_allowed1) {
         bfdebug_subtext(level, name, "unsupported", msg);
@@ -49,7 +49,7 @@ namespace exit_qualification
     inline auto get_if_exists(bool verbose = false)
     { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 
     namespace debug_exception
@@ -86,7 +86,7 @@ namespace exit_qualification
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -114,7 +114,7 @@ namespace exit_qualification
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -142,7 +142,7 @@ namespace exit_qualification
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -170,7 +170,7 @@ namespace exit_qualification
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -189,7 +189,7 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -217,7 +217,7 @@ namespace exit_qualification
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -245,11 +245,11 @@ namespace exit_qualification
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             b0::dump(level, msg);
@@ -272,7 +272,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -301,11 +301,11 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             vector::dump(level, msg);
@@ -337,7 +337,7 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -356,7 +356,7 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -380,11 +380,11 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             tss_selector::dump(level, msg);
@@ -403,7 +403,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -417,7 +417,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -431,7 +431,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -445,7 +445,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -459,7 +459,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -473,7 +473,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -487,7 +487,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -501,7 +501,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -515,7 +515,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -529,7 +529,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -543,7 +543,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -557,7 +557,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -571,7 +571,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -585,7 +585,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -599,7 +599,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -613,7 +613,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -627,7 +627,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -641,7 +641,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -655,7 +655,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -684,7 +684,7 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -708,7 +708,7 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -730,7 +730,7 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -749,7 +749,7 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -785,7 +785,7 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -804,12 +804,12 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
 
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             control_register_number::dump(level, msg);
@@ -846,7 +846,7 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -865,7 +865,7 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -887,7 +887,7 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -923,11 +923,11 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             debug_register_number::dump(level, msg);
@@ -966,7 +966,7 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -988,7 +988,7 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1016,7 +1016,7 @@ namespace exit_qualification
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -1044,7 +1044,7 @@ namespace exit_qualification
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -1066,7 +1066,7 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1085,7 +1085,7 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1104,11 +1104,11 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             size_of_access::dump(level, msg);
@@ -1131,7 +1131,7 @@ namespace exit_qualification
         inline auto get_if_exists(bool verbose = false)
         { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { dump_vmcs_nhex(level, msg); }
     }
 
@@ -1160,7 +1160,7 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1184,7 +1184,7 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1203,11 +1203,11 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             offset::dump(level, msg);
@@ -1244,7 +1244,7 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1263,11 +1263,11 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             access_type::dump(level, msg);
@@ -1309,7 +1309,7 @@ namespace exit_qualification
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -1337,7 +1337,7 @@ namespace exit_qualification
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -1365,7 +1365,7 @@ namespace exit_qualification
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -1393,7 +1393,7 @@ namespace exit_qualification
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -1421,7 +1421,7 @@ namespace exit_qualification
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -1449,7 +1449,7 @@ namespace exit_qualification
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -1468,7 +1468,7 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
@@ -1496,7 +1496,7 @@ namespace exit_qualification
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
@@ -1524,11 +1524,11 @@ namespace exit_qualification
             inline auto is_disabled_if_exists(bool verbose = false)
             { return is_bit_cleared(get_vmcs_field_if_exists(addr, name, verbose, exists()), from); }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subbool(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             data_read::dump(level, msg);
@@ -1568,11 +1568,11 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             vector::dump(level, msg);
@@ -1604,11 +1604,11 @@ namespace exit_qualification
             inline auto get_if_exists(bool verbose = false)
             { return get_bits(get_vmcs_field_if_exists(addr, name, verbose, exists()), mask) >> from; }
 
-            inline void dump(int level, std::string *msg = nullptr)
+            inline void dump(int level, bfdebug_msg_t *msg = nullptr)
             { dump_vmcs_subnhex(level, msg); }
         }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         {
             dump_vmcs_nhex(level, msg);
             offset::dump(level, msg);
@@ -1630,7 +1630,7 @@ namespace io_rcx
     inline auto get_if_exists(bool verbose = false)
     { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -1648,7 +1648,7 @@ namespace io_rsi
     inline auto get_if_exists(bool verbose = false)
     { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -1666,7 +1666,7 @@ namespace io_rdi
     inline auto get_if_exists(bool verbose = false)
     { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -1684,7 +1684,7 @@ namespace io_rip
     inline auto get_if_exists(bool verbose = false)
     { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
@@ -1702,7 +1702,7 @@ namespace guest_linear_address
     inline auto get_if_exists(bool verbose = false)
     { return get_vmcs_field_if_exists(addr, name, verbose, exists()); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { dump_vmcs_nhex(level, msg); }
 }
 
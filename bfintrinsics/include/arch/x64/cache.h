@@ -44,6 +44,9 @@
 extern "C" void _invd(void) noexcept;
 extern "C" void _wbinvd(void) noexcept;
 extern "C" void _clflush(void *addr) noexcept;
+extern "C" void _clflushopt(void *addr) noexcept;
+extern "C" void _clwb(void *addr) noexcept;
+extern "C" void _sfence(void) noexcept;
 
 // *INDENT-OFF*
 
@@ -67,6 +70,21 @@ inline void clflush(integer_pointer addr) noexcept
 inline void clflush(pointer addr) noexcept
 { _clflush(addr); }
 
+inline void clflushopt(integer_pointer addr) noexcept
+{ _clflushopt(reinterpret_cast<pointer>(addr)); }
+
+inline void clflushopt(pointer addr) noexcept
+{ _clflushopt(addr); }
+
+inline void clwb(integer_pointer addr) noexcept
+{ _clwb(reinterpret_cast<pointer>(addr)); }
+
+inline void clwb(pointer addr) noexcept
+{ _clwb(addr); }
+
+inline void sfence() noexcept
+{ _sfence(); }
+
 }
 }
 
@@ -121,7 +121,7 @@ namespace addr_size
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -137,11 +137,11 @@ namespace addr_size
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         phys::dump(level, msg);
@@ -160,11 +160,11 @@ namespace basic_cpuid_info
         inline auto get() noexcept
         { return _cpuid_eax(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         eax::dump(level, msg);
     }
@@ -181,11 +181,11 @@ namespace extend_cpuid_info
         inline auto get() noexcept
         { return _cpuid_eax(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         eax::dump(level, msg);
     }
@@ -202,7 +202,7 @@ namespace processor_string_1
         inline auto get() noexcept
         { return _cpuid_eax(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
@@ -213,7 +213,7 @@ namespace processor_string_1
         inline auto get() noexcept
         { return _cpuid_ebx(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
@@ -224,7 +224,7 @@ namespace processor_string_1
         inline auto get() noexcept
         { return _cpuid_ecx(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
@@ -235,11 +235,11 @@ namespace processor_string_1
         inline auto get() noexcept
         { return _cpuid_edx(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         eax::dump(level, msg);
         ebx::dump(level, msg);
@@ -259,7 +259,7 @@ namespace processor_string_2
         inline auto get() noexcept
         { return _cpuid_eax(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
@@ -270,7 +270,7 @@ namespace processor_string_2
         inline auto get() noexcept
         { return _cpuid_ebx(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
@@ -281,7 +281,7 @@ namespace processor_string_2
         inline auto get() noexcept
         { return _cpuid_ecx(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
@@ -292,11 +292,11 @@ namespace processor_string_2
         inline auto get() noexcept
         { return _cpuid_edx(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         eax::dump(level, msg);
         ebx::dump(level, msg);
@@ -316,7 +316,7 @@ namespace processor_string_3
         inline auto get() noexcept
         { return _cpuid_eax(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
@@ -327,7 +327,7 @@ namespace processor_string_3
         inline auto get() noexcept
         { return _cpuid_ebx(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
@@ -338,7 +338,7 @@ namespace processor_string_3
         inline auto get() noexcept
         { return _cpuid_ecx(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
@@ -349,11 +349,11 @@ namespace processor_string_3
         inline auto get() noexcept
         { return _cpuid_edx(addr); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_nhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         eax::dump(level, msg);
         ebx::dump(level, msg);
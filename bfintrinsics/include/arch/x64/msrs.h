@@ -70,7 +70,7 @@ namespace ia32_p5_mc_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -82,7 +82,7 @@ namespace ia32_p5_mc_type
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -94,7 +94,7 @@ namespace ia32_tsc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -139,7 +139,7 @@ namespace ia32_apic_base
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -173,7 +173,7 @@ namespace ia32_apic_base
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -207,7 +207,7 @@ namespace ia32_apic_base
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -229,11 +229,11 @@ namespace ia32_apic_base
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         bsp_flag::dump(level, msg);
@@ -272,11 +272,11 @@ namespace ia32_mperf
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         tsc_freq_clock_count::dump(level, msg);
@@ -312,11 +312,11 @@ namespace ia32_aperf
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         actual_freq_clock_count::dump(level, msg);
@@ -343,7 +343,7 @@ namespace ia32_mtrrcap
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -365,7 +365,7 @@ namespace ia32_mtrrcap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -387,7 +387,7 @@ namespace ia32_mtrrcap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -409,11 +409,11 @@ namespace ia32_mtrrcap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         vcnt::dump(level, msg);
@@ -452,11 +452,11 @@ namespace ia32_sysenter_cs
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         cs_selector::dump(level, msg);
@@ -474,7 +474,7 @@ namespace ia32_sysenter_esp
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -489,7 +489,7 @@ namespace ia32_sysenter_eip
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -513,7 +513,7 @@ namespace ia32_mcg_cap
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -535,7 +535,7 @@ namespace ia32_mcg_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -557,7 +557,7 @@ namespace ia32_mcg_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -579,7 +579,7 @@ namespace ia32_mcg_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -601,7 +601,7 @@ namespace ia32_mcg_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -617,7 +617,7 @@ namespace ia32_mcg_cap
         inline auto get(value_type msr) noexcept
         { return get_bits(msr, mask) >> from; }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -639,7 +639,7 @@ namespace ia32_mcg_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -661,7 +661,7 @@ namespace ia32_mcg_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -683,11 +683,11 @@ namespace ia32_mcg_cap
         inline auto is_disabled(value_type msr)
         { return is_bit_cleared(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         count::dump(level, msg);
@@ -743,7 +743,7 @@ namespace ia32_mcg_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -777,7 +777,7 @@ namespace ia32_mcg_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -811,7 +811,7 @@ namespace ia32_mcg_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -845,11 +845,11 @@ namespace ia32_mcg_status
         inline auto disable(value_type msr)
         { return clear_bit(msr, from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         ripv::dump(level, msg);
@@ -870,7 +870,7 @@ namespace ia32_mcg_ctl
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -903,7 +903,7 @@ namespace ia32_pat
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -925,7 +925,7 @@ namespace ia32_pat
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -947,7 +947,7 @@ namespace ia32_pat
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -969,7 +969,7 @@ namespace ia32_pat
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -991,7 +991,7 @@ namespace ia32_pat
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -1013,7 +1013,7 @@ namespace ia32_pat
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -1035,7 +1035,7 @@ namespace ia32_pat
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -1057,7 +1057,7 @@ namespace ia32_pat
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -1094,7 +1094,7 @@ namespace ia32_pat
         }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         pa0::dump(level, msg);
@@ -1116,7 +1116,7 @@ namespace ia32_mc0_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1128,7 +1128,7 @@ namespace ia32_mc0_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1140,7 +1140,7 @@ namespace ia32_mc0_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1152,7 +1152,7 @@ namespace ia32_mc0_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1164,7 +1164,7 @@ namespace ia32_mc1_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1176,7 +1176,7 @@ namespace ia32_mc1_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1188,7 +1188,7 @@ namespace ia32_mc1_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1200,7 +1200,7 @@ namespace ia32_mc1_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1212,7 +1212,7 @@ namespace ia32_mc2_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1224,7 +1224,7 @@ namespace ia32_mc2_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1236,7 +1236,7 @@ namespace ia32_mc2_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1248,7 +1248,7 @@ namespace ia32_mc2_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1260,7 +1260,7 @@ namespace ia32_mc3_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1272,7 +1272,7 @@ namespace ia32_mc3_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1284,7 +1284,7 @@ namespace ia32_mc3_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1296,7 +1296,7 @@ namespace ia32_mc3_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1308,7 +1308,7 @@ namespace ia32_mc4_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1320,7 +1320,7 @@ namespace ia32_mc4_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1332,7 +1332,7 @@ namespace ia32_mc4_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1344,7 +1344,7 @@ namespace ia32_mc4_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1356,7 +1356,7 @@ namespace ia32_mc5_ctl
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1368,7 +1368,7 @@ namespace ia32_mc5_status
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1380,7 +1380,7 @@ namespace ia32_mc5_addr
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1392,7 +1392,7 @@ namespace ia32_mc5_misc
     inline auto get() noexcept
     { return _read_msr(addr); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1407,7 +1407,7 @@ namespace ia32_star
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1422,7 +1422,7 @@ namespace ia32_lstar
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1437,7 +1437,7 @@ namespace ia32_fmask
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1452,7 +1452,7 @@ namespace ia32_kernel_gs_base
     inline void set(value_type val) noexcept
     { _write_msr(addr, val); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_nhex(level, name, get(), msg); }
 }
 
@@ -1485,11 +1485,11 @@ namespace ia32_tsc_aux
         inline auto set(value_type msr, value_type val) noexcept
         { return set_bits(msr, mask, val << from); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         aux::dump(level, msg);
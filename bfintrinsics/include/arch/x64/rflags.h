@@ -92,7 +92,7 @@ namespace carry_flag
     inline auto disable(value_type rflags)
     { return clear_bit(rflags, from); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_subbool(level, name, is_enabled(), msg); }
 }
 
@@ -126,7 +126,7 @@ namespace parity_flag
     inline auto disable(value_type rflags)
     { return clear_bit(rflags, from); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_subbool(level, name, is_enabled(), msg); }
 }
 
@@ -160,7 +160,7 @@ namespace auxiliary_carry_flag
     inline auto disable(value_type rflags)
     { return clear_bit(rflags, from); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_subbool(level, name, is_enabled(), msg); }
 }
 
@@ -194,7 +194,7 @@ namespace zero_flag
     inline auto disable(value_type rflags)
     { return clear_bit(rflags, from); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_subbool(level, name, is_enabled(), msg); }
 }
 
@@ -228,7 +228,7 @@ namespace sign_flag
     inline auto disable(value_type rflags)
     { return clear_bit(rflags, from); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_subbool(level, name, is_enabled(), msg); }
 }
 
@@ -262,7 +262,7 @@ namespace trap_flag
     inline auto disable(value_type rflags)
     { return clear_bit(rflags, from); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_subbool(level, name, is_enabled(), msg); }
 }
 
@@ -296,7 +296,7 @@ namespace interrupt_enable_flag
     inline auto disable(value_type rflags)
     { return clear_bit(rflags, from); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_subbool(level, name, is_enabled(), msg); }
 }
 
@@ -330,7 +330,7 @@ namespace direction_flag
     inline auto disable(value_type rflags)
     { return clear_bit(rflags, from); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_subbool(level, name, is_enabled(), msg); }
 }
 
@@ -364,7 +364,7 @@ namespace overflow_flag
     inline auto disable(value_type rflags)
     { return clear_bit(rflags, from); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_subbool(level, name, is_enabled(), msg); }
 }
 
@@ -386,7 +386,7 @@ namespace privilege_level
     inline auto set(value_type rflags, value_type val) noexcept
     { return set_bits(rflags, mask, val << from); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_subnhex(level, name, get(), msg); }
 }
 
@@ -420,7 +420,7 @@ namespace nested_task
     inline auto disable(value_type rflags)
     { return clear_bit(rflags, from); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_subbool(level, name, is_enabled(), msg); }
 }
 
@@ -454,7 +454,7 @@ namespace resume_flag
     inline auto disable(value_type rflags)
     { return clear_bit(rflags, from); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_subbool(level, name, is_enabled(), msg); }
 }
 
@@ -488,7 +488,7 @@ namespace virtual_8086_mode
     inline auto disable(value_type rflags)
     { return clear_bit(rflags, from); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_subbool(level, name, is_enabled(), msg); }
 }
 
@@ -522,7 +522,7 @@ namespace alignment_check_access_control
     inline auto disable(value_type rflags)
     { return clear_bit(rflags, from); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_subbool(level, name, is_enabled(), msg); }
 }
 
@@ -556,7 +556,7 @@ namespace virtual_interupt_flag
     inline auto disable(value_type rflags)
     { return clear_bit(rflags, from); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_subbool(level, name, is_enabled(), msg); }
 }
 
@@ -590,7 +590,7 @@ namespace virtual_interupt_pending
     inline auto disable(value_type rflags)
     { return clear_bit(rflags, from); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_subbool(level, name, is_enabled(), msg); }
 }
 
@@ -624,11 +624,11 @@ namespace id_flag
     inline auto disable(value_type rflags)
     { return clear_bit(rflags, from); }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     { bfdebug_subbool(level, name, is_enabled(), msg); }
 }
 
-inline void dump(int level, std::string *msg = nullptr)
+inline void dump(int level, bfdebug_msg_t *msg = nullptr)
 {
     bfdebug_nhex(level, name, get(), msg);
     carry_flag::dump(level, msg);
@@ -104,7 +104,7 @@ namespace es
         inline auto set(value_type sr, value_type val)
         { _write_es(gsl::narrow_cast<value_type>(set_bits(sr, mask, gsl::narrow_cast<value_type>(val << from)))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -138,7 +138,7 @@ namespace es
         inline auto disable(value_type sr)
         { _write_es(gsl::narrow_cast<value_type>(clear_bit(sr, from))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -160,11 +160,11 @@ namespace es
         inline auto set(value_type sr, value_type val)
         { _write_es(gsl::narrow_cast<value_type>(set_bits(sr, mask, gsl::narrow_cast<value_type>(val << from)))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         rpl::dump(level, msg);
@@ -201,7 +201,7 @@ namespace cs
         inline auto set(value_type sr, value_type val)
         { _write_cs(gsl::narrow_cast<value_type>(set_bits(sr, mask, gsl::narrow_cast<value_type>(val << from)))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -235,7 +235,7 @@ namespace cs
         inline auto disable(value_type sr)
         { _write_cs(gsl::narrow_cast<value_type>(clear_bit(sr, from))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -257,11 +257,11 @@ namespace cs
         inline auto set(value_type sr, value_type val)
         { _write_cs(gsl::narrow_cast<value_type>(set_bits(sr, mask, gsl::narrow_cast<value_type>(val << from)))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         rpl::dump(level, msg);
@@ -298,7 +298,7 @@ namespace ss
         inline auto set(value_type sr, value_type val)
         { _write_ss(gsl::narrow_cast<value_type>(set_bits(sr, mask, gsl::narrow_cast<value_type>(val << from)))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -332,7 +332,7 @@ namespace ss
         inline auto disable(value_type sr)
         { _write_ss(gsl::narrow_cast<value_type>(clear_bit(sr, from))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -354,11 +354,11 @@ namespace ss
         inline auto set(value_type sr, value_type val)
         { _write_ss(gsl::narrow_cast<value_type>(set_bits(sr, mask, gsl::narrow_cast<value_type>(val << from)))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         rpl::dump(level, msg);
@@ -395,7 +395,7 @@ namespace ds
         inline auto set(value_type sr, value_type val)
         { _write_ds(gsl::narrow_cast<value_type>(set_bits(sr, mask, gsl::narrow_cast<value_type>(val << from)))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -429,7 +429,7 @@ namespace ds
         inline auto disable(value_type sr)
         { _write_ds(gsl::narrow_cast<value_type>(clear_bit(sr, from))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -451,11 +451,11 @@ namespace ds
         inline auto set(value_type sr, value_type val)
         { _write_ds(gsl::narrow_cast<value_type>(set_bits(sr, mask, gsl::narrow_cast<value_type>(val << from)))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         rpl::dump(level, msg);
@@ -492,7 +492,7 @@ namespace fs
         inline auto set(value_type sr, value_type val)
         { _write_fs(gsl::narrow_cast<value_type>(set_bits(sr, mask, gsl::narrow_cast<value_type>(val << from)))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -526,7 +526,7 @@ namespace fs
         inline auto disable(value_type sr)
         { _write_fs(gsl::narrow_cast<value_type>(clear_bit(sr, from))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -548,11 +548,11 @@ namespace fs
         inline auto set(value_type sr, value_type val)
         { _write_fs(gsl::narrow_cast<value_type>(set_bits(sr, mask, gsl::narrow_cast<value_type>(val << from)))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         rpl::dump(level, msg);
@@ -589,7 +589,7 @@ namespace gs
         inline auto set(value_type sr, value_type val)
         { _write_gs(gsl::narrow_cast<value_type>(set_bits(sr, mask, gsl::narrow_cast<value_type>(val << from)))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -623,7 +623,7 @@ namespace gs
         inline auto disable(value_type sr)
         { _write_gs(gsl::narrow_cast<value_type>(clear_bit(sr, from))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -645,11 +645,11 @@ namespace gs
         inline auto set(value_type sr, value_type val)
         { _write_gs(gsl::narrow_cast<value_type>(set_bits(sr, mask, gsl::narrow_cast<value_type>(val << from)))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         rpl::dump(level, msg);
@@ -686,7 +686,7 @@ namespace ldtr
         inline auto set(value_type sr, value_type val)
         { _write_ldtr(gsl::narrow_cast<value_type>(set_bits(sr, mask, gsl::narrow_cast<value_type>(val << from)))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -720,7 +720,7 @@ namespace ldtr
         inline auto disable(value_type sr)
         { _write_ldtr(gsl::narrow_cast<value_type>(clear_bit(sr, from))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -742,11 +742,11 @@ namespace ldtr
         inline auto set(value_type sr, value_type val)
         { _write_ldtr(gsl::narrow_cast<value_type>(set_bits(sr, mask, gsl::narrow_cast<value_type>(val << from)))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         rpl::dump(level, msg);
@@ -783,7 +783,7 @@ namespace tr
         inline auto set(value_type sr, value_type val)
         { _write_tr(gsl::narrow_cast<value_type>(set_bits(sr, mask, gsl::narrow_cast<value_type>(val << from)))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
@@ -817,7 +817,7 @@ namespace tr
         inline auto disable(value_type sr)
         { _write_tr(gsl::narrow_cast<value_type>(clear_bit(sr, from))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subbool(level, name, is_enabled(), msg); }
     }
 
@@ -839,11 +839,11 @@ namespace tr
         inline auto set(value_type sr, value_type val)
         { _write_tr(gsl::narrow_cast<value_type>(set_bits(sr, mask, gsl::narrow_cast<value_type>(val << from)))); }
 
-        inline void dump(int level, std::string *msg = nullptr)
+        inline void dump(int level, bfdebug_msg_t *msg = nullptr)
         { bfdebug_subnhex(level, name, get(), msg); }
     }
 
-    inline void dump(int level, std::string *msg = nullptr)
+    inline void dump(int level, bfdebug_msg_t *msg = nullptr)
     {
         bfdebug_nhex(level, name, get(), msg);
         rpl::dump(level, msg);
@@ -852,7 +852,7 @@ namespace tr
     }
 }
 
-inline void dump(int level, std::string *msg = nullptr)
+inline void dump(int level, bfdebug_msg_t *msg = nullptr)
 {
     es::dump(level, msg);
     cs::dump(level, msg);
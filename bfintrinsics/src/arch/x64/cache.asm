@@ -35,3 +35,18 @@ global _clflush:function
 _clflush:
     clflush [rdi]
     ret
+
+global _clflushopt:function
+_clflushopt:
+    clflushopt [rdi]
+    ret
+
+global _clwb:function
+_clwb:
+    clwb [rdi]
+    ret
+
+global _sfence:function
+_sfence:
+    sfence
+    ret
@@ -247,7 +247,7 @@ TEST_CASE("disable_vm_control_if_allowed")
 TEST_CASE("dump_vm_control")
 {
     constexpr const auto name = "dump";
-    std::string msg = "dump";
+    bfdebug_msg_t msg;
 
     CHECK_NOTHROW(dump_vm_control(0, false, false, false, name, &msg));
     CHECK_NOTHROW(dump_vm_control(0, false, true, false, name, &msg));
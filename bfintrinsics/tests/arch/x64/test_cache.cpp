@@ -33,6 +33,18 @@ extern "C" void
 _clflush(void *addr) noexcept
 { (void) addr; }
 
+extern "C" void
+_clflushopt(void *addr) noexcept
+{ (void) addr; }
+
+extern "C" void
+_clwb(void *addr) noexcept
+{ (void) addr; }
+
+extern "C" void
+_sfence() noexcept
+{ }
+
 TEST_CASE("cache_invd")
 {
     CHECK_NOTHROW(cache::invd());
@@ -50,3 +62,24 @@ TEST_CASE("cache_clflush")
     int test = 8;
     CHECK_NOTHROW(cache::clflush(&test));
 }
+
+TEST_CASE("cache_clflushopt")
+{
+    CHECK_NOTHROW(cache::clflushopt(0x10));
+
+    int test = 8;
+    CHECK_NOTHROW(cache::clflushopt(&test));
+}
+
+TEST_CASE("cache_clwb")
+{
+    CHECK_NOTHROW(cache::clwb(0x10));
+
+    int test = 8;
+    CHECK_NOTHROW(cache::clwb(&test));
+}
+
+TEST_CASE("cache_sfence")
+{
+    CHECK_NOTHROW(cache::sfence());
+}
@@ -33,7 +33,10 @@ enum class command_line_parser_command {
     stop = 5,
     quick = 6,
     dump = 7,
-    status = 8
+    status = 8,
+    trace = 9,
+    level = 10,
+    bundle = 11
 };
 
 #ifdef _MSC_VER
@@ -61,6 +64,10 @@ public:
     using arg_list_type = std::vector<arg_type>;            ///< Arg list type
     using filename_type = file::filename_type;              ///< Filename type
     using vcpuid_type = ioctl::vcpuid_type;                 ///< VCPUID type
+    using subsystem_type = ioctl::subsystem_type;           ///< Debug subsystem type
+    using level_type = ioctl::level_type;                   ///< Debug level type
+    using ring_size_type = ioctl::ring_size_type;           ///< Debug ring size type
+    using channel_type = int;                               ///< Debug ring channel type
     using command_type = command_line_parser_command;       ///< Command type
 
     /// Command Line Parser Constructor
@@ -114,6 +121,18 @@ public:
     ///
     virtual const filename_type &modules() const noexcept;
 
+    /// Output
+    ///
+    /// If the command provided by the arguments is "bundle", this returns
+    /// the filename that the bundle should be written to.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @return output filename
+    ///
+    virtual const filename_type &output() const noexcept;
+
     /// vCPU ID
     ///
     /// @expects none
@@ -123,6 +142,74 @@ public:
     ///
     virtual vcpuid_type vcpuid() const noexcept;
 
+    /// Follow
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @return returns true if the user asked to follow the debug ring
+    ///
+    virtual bool follow() const noexcept;
+
+    /// Timestamps
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @return returns true if the user asked for the debug ring to be
+    ///     printed with wall-clock timestamps
+    ///
+    virtual bool timestamps() const noexcept;
+
+    /// Debug Ring Channel
+    ///
+    /// If the command provided by the arguments is "dump", this returns the
+    /// channel (see DEBUG_RING_CHANNEL) whose debug rings should be dumped.
+    /// If the user did not provide a channel, DEBUG_RING_CHANNEL_DEBUG is
+    /// returned.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @return returns the debug ring channel provided by the user
+    ///
+    virtual channel_type channel() const noexcept;
+
+    /// Debug Subsystem
+    ///
+    /// If the command provided by the arguments is "level", this returns
+    /// the subsystem whose debug level should be changed. If the user did
+    /// not provide a subsystem, BFDEBUG_SUBSYSTEM_ALL is returned.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @return returns the debug subsystem provided by the user
+    ///
+    virtual subsystem_type subsystem() const noexcept;
+
+    /// Debug Level
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @return returns the debug level provided by the user
+    ///
+    virtual level_type level() const noexcept;
+
+    /// Debug Ring Size
+    ///
+    /// If the command provided by the arguments is "load" or "quick", this
+    /// returns the size of the VMM's debug rings. If the user did not provide
+    /// a size, DEBUG_RING_SIZE is returned.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @return returns the debug ring size provided by the user
+    ///
+    virtual ring_size_type debug_ring_size() const noexcept;
+
 private:
 
     void reset() noexcept;
@@ -134,12 +221,22 @@ private:
     void parse_quick(arg_list_type &args);
     void parse_dump(arg_list_type &args);
     void parse_status(arg_list_type &args);
+    void parse_trace(arg_list_type &args);
+    void parse_level(arg_list_type &args);
+    void parse_bundle(arg_list_type &args);
 
 private:
 
     command_type m_cmd{};
     filename_type m_modules{};
+    filename_type m_output{};
     vcpuid_type m_vcpuid{};
+    bool m_follow{};
+    bool m_timestamps{};
+    channel_type m_channel{};
+    subsystem_type m_subsystem{};
+    level_type m_level{};
+    ring_size_type m_debug_ring_size{};
 };
 
 #ifdef _MSC_VER
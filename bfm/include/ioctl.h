@@ -20,10 +20,14 @@
 #define IOCTL_H
 
 #include <memory>
+#include <vector>
 
 #include <bfgsl.h>
 #include <bffile.h>
+#include <bfsupport.h>
 #include <bfdebugringinterface.h>
+#include <bftraceringinterface.h>
+#include <bfstatusinterface.h>
 
 #ifdef _MSC_VER
 #pragma warning(push)
@@ -64,9 +68,20 @@ public:
     using binary_data = file::binary_data;          ///< Binary data type
     using drr_type = debug_ring_resources_t;        ///< Debug ring resources type
     using drr_pointer = drr_type *;                 ///< Debug ring resources pointer type
+    using const_drr_pointer = const drr_type *;     ///< Debug ring resources const pointer type
+    using trr_type = trace_ring_resources_t;        ///< Trace ring resources type
+    using trr_pointer = trr_type *;                 ///< Trace ring resources pointer type
+    using cpuid_type = uint64_t;                    ///< CPUID type
     using vcpuid_type = uint64_t;                   ///< VCPUID type
     using status_type = int64_t;                    ///< Status type
     using status_pointer = status_type *;           ///< Status pointer type
+    using vmm_status_type = vmm_status_t;           ///< Status page type
+    using const_vmm_status_pointer = const vmm_status_type *;   ///< Status page const pointer type
+    using subsystem_type = uint64_t;                ///< Debug subsystem type
+    using level_type = int64_t;                     ///< Debug level type
+    using ring_size_type = uint64_t;                ///< Debug ring size type
+    using tsc_info_type = tsc_info_t;               ///< TSC info type
+    using tsc_info_pointer = tsc_info_type *;       ///< TSC info pointer type
 
     /// Default Constructor
     ///
@@ -102,6 +117,18 @@ public:
     ///
     virtual void call_ioctl_add_module(const binary_data &module_data);
 
+    /// Add Modules
+    ///
+    /// Add a list of modules to the driver entry, in order. Where supported,
+    /// this is done using a single call into the driver entry.
+    ///
+    /// @param modules ELF files to be added to the driver entry
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    virtual void call_ioctl_add_modules(const std::vector<binary_data> &modules);
+
     /// Load VMM
     ///
     /// Loads the VMM
@@ -140,7 +167,9 @@ public:
 
     /// Dump VMM
     ///
-    /// Dumps the contents of the VMM's debug ring
+    /// Dumps the contents of the VMM's debug ring. drr->len must be set to
+    /// the size of the buffer that follows drr, which must be at least as
+    /// large as the VMM's debug ring.
     ///
     /// @expects drr != null;
     /// @ensures none
@@ -150,6 +179,33 @@ public:
     ///
     virtual void call_ioctl_dump_vmm(gsl::not_null<drr_pointer> drr, vcpuid_type vcpuid);
 
+    /// Map Debug Ring
+    ///
+    /// Maps the debug ring of the provided vcpuid read-only into the address
+    /// space of this process. Once mapped, the debug ring can be read using
+    /// its spos / epos without calling into the driver. The mapping is valid
+    /// until this class is destroyed.
+    ///
+    /// @expects none
+    /// @ensures ret != nullptr
+    ///
+    /// @param vcpuid indicates which drr to map (every vcpu has its own drr)
+    /// @return a read-only pointer to the mapped debug ring
+    ///
+    virtual const_drr_pointer map_debug_ring(vcpuid_type vcpuid);
+
+    /// Dump Trace
+    ///
+    /// Dumps the contents of a CPU's trace ring
+    ///
+    /// @expects trr != null;
+    /// @ensures none
+    ///
+    /// @param trr pointer a trace_ring_resources_t
+    /// @param cpuid indicates which trr to get (every cpu has its own trr)
+    ///
+    virtual void call_ioctl_dump_trace(gsl::not_null<trr_pointer> trr, cpuid_type cpuid);
+
     /// VMM Status
     ///
     /// Get the status of the VMM
@@ -161,6 +217,56 @@ public:
     ///
     virtual void call_ioctl_vmm_status(gsl::not_null<status_pointer> status);
 
+    /// Map VMM Status
+    ///
+    /// Maps the driver's status page read-only into the address space of
+    /// this process. Once mapped, the status page can be read using
+    /// vmm_status_read() without calling into the driver. The mapping is
+    /// valid until this class is destroyed.
+    ///
+    /// @expects none
+    /// @ensures ret != nullptr
+    ///
+    /// @return a read-only pointer to the mapped status page
+    ///
+    virtual const_vmm_status_pointer map_vmm_status();
+
+    /// Set Debug Level
+    ///
+    /// Sets the debug level of one of the VMM's subsystems
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @param subsystem the subsystem to change (BFDEBUG_SUBSYSTEM_xxx)
+    /// @param level the new debug level
+    ///
+    virtual void call_ioctl_set_debug_level(subsystem_type subsystem, level_type level);
+
+    /// Set Debug Ring Size
+    ///
+    /// Sets the size of the VMM's debug rings. This must be called before
+    /// the VMM is loaded.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @param size the size of each debug ring's buffer
+    ///
+    virtual void call_ioctl_set_debug_ring_size(ring_size_type size);
+
+    /// Get TSC Info
+    ///
+    /// Gets the TSC frequency, and the wall-clock anchor that were given to
+    /// the VMM when it was loaded.
+    ///
+    /// @expects info != nullptr
+    /// @ensures none
+    ///
+    /// @param info pointer to the tsc_info_t to store the results
+    ///
+    virtual void call_ioctl_get_tsc_info(gsl::not_null<tsc_info_pointer> info);
+
 private:
 
     std::unique_ptr<ioctl_private_base> m_d;
@@ -48,6 +48,8 @@ public:
     using status_type = ioctl::status_type;                         ///< Status type
     using filename_type = std::string;                              ///< Filename type
     using list_type = std::vector<std::string>;                     ///< List type
+    using drr_list_type = std::vector<ioctl::const_drr_pointer>;    ///< Mapped debug ring list type
+    using pos_list_type = std::vector<uint64_t>;                    ///< Debug ring position list type
 
     /// Default Constructor
     ///
@@ -92,7 +94,15 @@ private:
     void stop_vmm();
     void quick_vmm();
     void dump_vmm();
+    void dump_vmm_merged();
+    void follow_vmm();
+    void follow_vmm_once(const drr_list_type &rings, pos_list_type &positions);
+    void get_tsc_info();
     void vmm_status();
+    void vmm_stats();
+    void dump_trace();
+    void set_debug_level();
+    void bundle_vmm();
 
     status_type get_status() const;
 
@@ -105,6 +115,9 @@ private:
     gsl::not_null<file *> m_file;
     gsl::not_null<ioctl *> m_ioctl;
     gsl::not_null<command_line_parser *> m_clp;
+
+    ioctl::tsc_info_type m_tsc_info{};
+    uint64_t m_last_tsc{};
 };
 
 #ifdef _MSC_VER
@@ -27,6 +27,29 @@
 // Implementation
 // -----------------------------------------------------------------------------
 
+static command_line_parser::subsystem_type
+debug_subsystem(const std::string &name)
+{
+    if (name == "default") { return BFDEBUG_SUBSYSTEM_DEFAULT; }
+    if (name == "memory_manager") { return BFDEBUG_SUBSYSTEM_MEMORY_MANAGER; }
+    if (name == "vmcs") { return BFDEBUG_SUBSYSTEM_VMCS; }
+    if (name == "exit_handler") { return BFDEBUG_SUBSYSTEM_EXIT_HANDLER; }
+    if (name == "vcpu") { return BFDEBUG_SUBSYSTEM_VCPU; }
+    if (name == "all") { return BFDEBUG_SUBSYSTEM_ALL; }
+
+    throw std::runtime_error("unknown debug subsystem: " + name);
+}
+
+static command_line_parser::channel_type
+debug_channel(const std::string &name)
+{
+    if (name == "debug") { return DEBUG_RING_CHANNEL_DEBUG; }
+    if (name == "metrics") { return DEBUG_RING_CHANNEL_METRICS; }
+    if (name == "trace") { return DEBUG_RING_CHANNEL_TRACE; }
+
+    throw std::runtime_error("unknown debug ring channel: " + name);
+}
+
 command_line_parser::command_line_parser()
 { reset(); }
 
@@ -60,6 +83,41 @@ command_line_parser::parse(const arg_list_type &args)
             continue;
         }
 
+        if (*arg == "--debug-ring-size") {
+
+            if (++arg == args.end()) {
+                break;
+            }
+
+            m_debug_ring_size = std::stoull(*arg, nullptr, 0);
+
+            if (debug_ring_size_valid(m_debug_ring_size) == 0) {
+                throw std::runtime_error("invalid debug ring size: " + *arg);
+            }
+
+            continue;
+        }
+
+        if (*arg == "--channel") {
+
+            if (++arg == args.end()) {
+                break;
+            }
+
+            m_channel = debug_channel(*arg);
+            continue;
+        }
+
+        if (*arg == "-f" || *arg == "--follow") {
+            m_follow = true;
+            continue;
+        }
+
+        if (*arg == "-t" || *arg == "--timestamps") {
+            m_timestamps = true;
+            continue;
+        }
+
         if (*arg == "-h" || *arg == "--help") {
             return reset();
         }
@@ -87,6 +145,9 @@ command_line_parser::parse(const arg_list_type &args)
     if (cmd == "quick") { return parse_quick(filtered_args); }
     if (cmd == "dump") { return parse_dump(filtered_args); }
     if (cmd == "status") { return parse_status(filtered_args); }
+    if (cmd == "trace") { return parse_trace(filtered_args); }
+    if (cmd == "level") { return parse_level(filtered_args); }
+    if (cmd == "bundle") { return parse_bundle(filtered_args); }
 
     throw std::runtime_error("unknown command: " + cmd);
 }
@@ -99,16 +160,51 @@ const command_line_parser::filename_type &
 command_line_parser::modules() const noexcept
 { return m_modules; }
 
+const command_line_parser::filename_type &
+command_line_parser::output() const noexcept
+{ return m_output; }
+
 command_line_parser::vcpuid_type
 command_line_parser::vcpuid() const noexcept
 { return m_vcpuid; }
 
+bool
+command_line_parser::follow() const noexcept
+{ return m_follow; }
+
+bool
+command_line_parser::timestamps() const noexcept
+{ return m_timestamps; }
+
+command_line_parser::channel_type
+command_line_parser::channel() const noexcept
+{ return m_channel; }
+
+command_line_parser::subsystem_type
+command_line_parser::subsystem() const noexcept
+{ return m_subsystem; }
+
+command_line_parser::level_type
+command_line_parser::level() const noexcept
+{ return m_level; }
+
+command_line_parser::ring_size_type
+command_line_parser::debug_ring_size() const noexcept
+{ return m_debug_ring_size; }
+
 void
 command_line_parser::reset() noexcept
 {
     m_cmd = command_type::help;
     m_modules.clear();
+    m_output.clear();
     m_vcpuid = vcpuid::invalid;
+    m_follow = false;
+    m_timestamps = false;
+    m_channel = DEBUG_RING_CHANNEL_DEBUG;
+    m_subsystem = BFDEBUG_SUBSYSTEM_ALL;
+    m_level = DEBUG_LEVEL;
+    m_debug_ring_size = DEBUG_RING_SIZE;
 }
 
 void
@@ -162,3 +258,39 @@ command_line_parser::parse_status(arg_list_type &args)
     bfignored(args);
     m_cmd = command_type::status;
 }
+
+void
+command_line_parser::parse_trace(arg_list_type &args)
+{
+    bfignored(args);
+    m_cmd = command_type::trace;
+}
+
+void
+command_line_parser::parse_level(arg_list_type &args)
+{
+    if (args.empty()) {
+        throw std::runtime_error("missing debug level");
+    }
+
+    m_level = std::stoll(args[0], nullptr, 10);
+
+    if (args.size() > 1) {
+        m_subsystem = debug_subsystem(args[1]);
+    }
+
+    m_cmd = command_type::level;
+}
+
+void
+command_line_parser::parse_bundle(arg_list_type &args)
+{
+    if (args.size() < 2) {
+        throw std::runtime_error("missing bundle modules or output");
+    }
+
+    m_modules = args[0];
+    m_output = args[1];
+
+    m_cmd = command_type::bundle;
+}
@@ -20,12 +20,264 @@
 #include <bffile.h>
 #include <bfjson.h>
 #include <bfstring.h>
+#include <bfvcpuid.h>
 #include <bfshuffle.h>
 #include <bfelf_loader.h>
 #include <bfdriverinterface.h>
 
 #include <ioctl_driver.h>
 
+#include <ctime>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <iomanip>
+#include <sstream>
+#include <algorithm>
+
+constexpr const auto follow_interval = std::chrono::milliseconds(100);
+
+// The debug output of the VMM is written to the global debug ring, and to
+// the per-CPU debug rings. All other channels only have per-CPU debug rings.
+//
+
+static std::vector<vcpuid::type>
+channel_ring_ids(command_line_parser::channel_type channel)
+{
+    std::vector<vcpuid::type> ids;
+
+    if (channel == DEBUG_RING_CHANNEL_DEBUG) {
+        ids.push_back(vcpuid::invalid);
+    }
+
+    for (auto cpuid = 0ULL; cpuid < MAX_DEBUG_RING_CPUS; cpuid++) {
+        if (channel == DEBUG_RING_CHANNEL_DEBUG) {
+            ids.push_back(DEBUG_RING_CPUID(cpuid));
+        }
+        else {
+            ids.push_back(DEBUG_RING_CHANNEL(channel, cpuid));
+        }
+    }
+
+    return ids;
+}
+
+// The size of the VMM's debug rings is chosen when the VMM is loaded, so
+// when a debug ring is dumped, a buffer large enough to hold the largest
+// debug ring is provided, and the driver sets len to the actual size.
+//
+
+static std::unique_ptr<char[]>
+make_debug_ring()
+{ return std::make_unique<char[]>(debug_ring_total_size(DEBUG_RING_MAX_SIZE)); }
+
+static ioctl::drr_pointer
+reset_debug_ring(const std::unique_ptr<char[]> &mem)
+{
+    auto drr = reinterpret_cast<ioctl::drr_pointer>(mem.get());
+
+    drr->epos = 0;
+    drr->spos = 0;
+    drr->len = DEBUG_RING_MAX_SIZE;
+
+    return drr;
+}
+
+using entry_type = std::pair<uint64_t, std::string>;
+using entry_list_type = std::vector<entry_type>;
+
+// When the debug ring is mapped, it is read while the VMM writes it, so a
+// stamp might be torn. The stamp is parsed by hand, so that an invalid
+// stamp only drops the string it belongs to, instead of the entire dump.
+//
+
+static bool
+parse_stamp(const std::string &str, uint64_t &tsc)
+{
+    uint64_t val = 0;
+
+    for (auto i = 1; i < DEBUG_RING_STAMP_SIZE; i++) {
+        auto c = str.at(static_cast<std::size_t>(i));
+        val <<= 4;
+
+        if (c >= '0' && c <= '9') {
+            val |= static_cast<uint64_t>(c - '0');
+        }
+        else if (c >= 'A' && c <= 'F') {
+            val |= static_cast<uint64_t>(c - 'A' + 10);
+        }
+        else if (c >= 'a' && c <= 'f') {
+            val |= static_cast<uint64_t>(c - 'a' + 10);
+        }
+        else {
+            return false;
+        }
+    }
+
+    tsc = val;
+    return true;
+}
+
+static uint64_t
+debug_ring_entries(
+    gsl::not_null<ioctl::const_drr_pointer> drr, entry_list_type &entries, uint64_t pos = 0)
+{
+    uint64_t tsc = 0;
+
+    auto len = drr->len;
+    if (debug_ring_size_valid(len) == 0) {
+        return pos;
+    }
+
+    auto epos = drr->epos;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    auto spos = std::max(drr->spos, pos);
+
+    if (spos > epos || epos - spos > len) {
+        return pos;
+    }
+
+    auto buf = debug_ring_buf(drr);
+
+    std::string raw;
+    for (auto i = spos; i != epos; i++) {
+        raw.push_back(buf[i & (len - 1)]);
+    }
+
+    // If the debug ring is being written while it is read (i.e. it is mapped
+    // instead of copied), the VMM might have evicted some of the strings
+    // that were just read. The VMM only evicts complete strings, and moves
+    // the start position before overwriting them, so anything before the
+    // new start position is dropped.
+    //
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+    auto skip = std::min<uint64_t>(drr->spos > spos ? drr->spos - spos : 0, raw.length());
+
+    std::string str;
+    for (auto i = skip; i < raw.length(); i++) {
+        auto c = raw[i];
+
+        if (c != '\0') {
+            str.push_back(c);
+
+            if (i + 1 != raw.length()) {
+                continue;
+            }
+        }
+
+        // Strings that were written without a stamp (i.e. by a CPU that does
+        // not own a debug ring) inherit the timestamp of the string that was
+        // written before it so that the order of each ring is preserved.
+        //
+
+        if (str.length() >= DEBUG_RING_STAMP_SIZE && str.front() == DEBUG_RING_STAMP_MARKER) {
+            if (!parse_stamp(str, tsc)) {
+                str.clear();
+                continue;
+            }
+
+            str.erase(0, DEBUG_RING_STAMP_SIZE);
+        }
+
+        if (!str.empty()) {
+            entries.emplace_back(tsc, std::move(str));
+        }
+
+        str.clear();
+    }
+
+    return epos;
+}
+
+static uint64_t
+tsc_to_ns(const ioctl::tsc_info_type &info, uint64_t ticks)
+{
+    // The frequency is in kHz, so the remainder is converted separately to
+    // keep the multiplication from overflowing.
+
+    return ((ticks / info.freq) * 1000000) + (((ticks % info.freq) * 1000000) / info.freq);
+}
+
+static std::string
+timestamp(const ioctl::tsc_info_type &info, uint64_t tsc, uint64_t last)
+{
+    auto ns = tsc >= info.tsc ?
+              info.wallclock + tsc_to_ns(info, tsc - info.tsc) :
+              info.wallclock - tsc_to_ns(info, info.tsc - tsc);
+
+    auto delta = last != 0 && tsc > last ? tsc_to_ns(info, tsc - last) : 0;
+    auto secs = static_cast<std::time_t>(ns / 1000000000);
+
+    std::ostringstream ss;
+    ss << std::setfill('0') << '[';
+    ss << std::put_time(std::gmtime(&secs), "%Y-%m-%d %H:%M:%S");
+    ss << '.' << std::setw(6) << (ns % 1000000000) / 1000;
+    ss << " +" << delta / 1000000000 << '.' << std::setw(6) << (delta % 1000000000) / 1000;
+    ss << "] ";
+
+    return ss.str();
+}
+
+static void
+print_entries(entry_list_type &entries, const ioctl::tsc_info_type &info, uint64_t &last)
+{
+    std::stable_sort(entries.begin(), entries.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.first < rhs.first;
+    });
+
+    for (const auto &entry : entries) {
+        if (info.freq != 0 && entry.first != 0) {
+            std::cout << timestamp(info, entry.first, last);
+            last = entry.first;
+        }
+
+        std::cout << entry.second;
+    }
+}
+
+using record_type = std::pair<uint64_t, trace_record_t>;
+using record_list_type = std::vector<record_type>;
+
+static std::string
+trace_record_to_string(uint64_t cpuid, const trace_record_t &record)
+{
+    auto name = std::string{};
+    auto args = std::vector<const char *>{};
+
+    switch (record.id) {
+        case TRACE_EVENT_EXIT: name = "exit"; args = {"reason", "rip"}; break;
+        case TRACE_EVENT_RDMSR: name = "rdmsr"; args = {"msr", "val"}; break;
+        case TRACE_EVENT_WRMSR: name = "wrmsr"; args = {"msr", "val"}; break;
+        case TRACE_EVENT_MAP: name = "map"; args = {"virt", "phys", "size"}; break;
+        case TRACE_EVENT_UNMAP: name = "unmap"; args = {"virt", "size"}; break;
+        case TRACE_EVENT_MAP_CR3: name = "map_cr3"; args = {"virt", "gva", "cr3", "size"}; break;
+
+        default:
+            if (record.id >= TRACE_EVENT_USER) {
+                name = "user+" + bfn::to_string(record.id - TRACE_EVENT_USER, 10);
+            }
+            else {
+                name = "unknown(" + bfn::to_string(record.id, 10) + ")";
+            }
+
+            args = {"arg0", "arg1", "arg2", "arg3"};
+            break;
+    }
+
+    auto str = bfn::to_string(record.tsc, 16);
+
+    str += " cpu " + bfn::to_string(cpuid, 10);
+    str += " vcpu " + bfn::to_string(record.vcpuid, 16);
+    str += " " + name + ":";
+
+    for (auto i = 0U; i < args.size(); i++) {
+        str += " " + std::string(args.at(i)) + "=" + bfn::to_string(gsl::at(record.args, i), 16);
+    }
+
+    return str;
+}
+
 ioctl_driver::ioctl_driver(gsl::not_null<file *> f,
                            gsl::not_null<ioctl *> ctl,
                            gsl::not_null<command_line_parser *> clp) :
@@ -61,6 +313,15 @@ ioctl_driver::process()
 
         case command_line_parser::command_type::status:
             return this->vmm_status();
+
+        case command_line_parser::command_type::trace:
+            return this->dump_trace();
+
+        case command_line_parser::command_type::level:
+            return this->set_debug_level();
+
+        case command_line_parser::command_type::bundle:
+            return this->bundle_vmm();
     }
 }
 
@@ -82,10 +343,14 @@ ioctl_driver::load_vmm()
         unload_vmm();
     });
 
+    m_ioctl->call_ioctl_set_debug_ring_size(m_clp->debug_ring_size());
+
+    std::vector<ioctl::binary_data> modules;
     for (const auto &module : module_list) {
-        m_ioctl->call_ioctl_add_module(m_file->read_binary(module));
+        modules.push_back(m_file->read_binary(module));
     }
 
+    m_ioctl->call_ioctl_add_modules(modules);
     m_ioctl->call_ioctl_load_vmm();
 }
 
@@ -141,8 +406,8 @@ ioctl_driver::quick_vmm()
 void
 ioctl_driver::dump_vmm()
 {
-    auto drr = ioctl::drr_type{};
-    auto buffer = std::make_unique<char[]>(DEBUG_RING_SIZE);
+    auto mem = make_debug_ring();
+    auto drr = reset_debug_ring(mem);
 
     switch (get_status()) {
         case VMM_RUNNING: break;
@@ -152,25 +417,249 @@ ioctl_driver::dump_vmm()
         default: throw std::runtime_error("unknown status");
     }
 
-    m_ioctl->call_ioctl_dump_vmm(&drr, m_clp->vcpuid());
+    this->get_tsc_info();
+
+    if (m_clp->follow()) {
+        return this->follow_vmm();
+    }
 
-    if (debug_ring_read(&drr, buffer.get(), DEBUG_RING_SIZE) > 0) {
-        std::cout << buffer.get();
+    if (m_clp->vcpuid() == vcpuid::invalid) {
+        return this->dump_vmm_merged();
     }
 
+    m_ioctl->call_ioctl_dump_vmm(drr, m_clp->vcpuid());
+
+    entry_list_type entries;
+    debug_ring_entries(drr, entries);
+
+    print_entries(entries, m_tsc_info, m_last_tsc);
     std::cout << '\n';
 }
 
+void
+ioctl_driver::dump_vmm_merged()
+{
+    auto found = false;
+    auto mem = make_debug_ring();
+
+    entry_list_type entries;
+
+    auto dump = [&](vcpuid::type id) {
+        auto drr = reset_debug_ring(mem);
+
+        try {
+            m_ioctl->call_ioctl_dump_vmm(drr, id);
+        }
+        catch (std::runtime_error &) {
+            return;
+        }
+
+        found = true;
+        debug_ring_entries(drr, entries);
+    };
+
+    for (const auto &id : channel_ring_ids(m_clp->channel())) {
+        dump(id);
+    }
+
+    if (!found) {
+        throw std::runtime_error("failed to dump vmm: no debug rings found");
+    }
+
+    print_entries(entries, m_tsc_info, m_last_tsc);
+    std::cout << '\n';
+}
+
+void
+ioctl_driver::follow_vmm()
+{
+    drr_list_type rings;
+
+    if (m_clp->vcpuid() != vcpuid::invalid) {
+        rings.push_back(m_ioctl->map_debug_ring(m_clp->vcpuid()));
+    }
+    else {
+        auto map = [&](vcpuid::type id) {
+            try {
+                rings.push_back(m_ioctl->map_debug_ring(id));
+            }
+            catch (std::runtime_error &)
+            { }
+        };
+
+        for (const auto &id : channel_ring_ids(m_clp->channel())) {
+            map(id);
+        }
+    }
+
+    if (rings.empty()) {
+        throw std::runtime_error("failed to follow vmm: no debug rings found");
+    }
+
+    // The debug rings are mapped, so polling them is just a read of each
+    // ring's end position. The driver is not called again until bfm exits.
+    //
+
+    pos_list_type positions(rings.size());
+
+    while (true) {
+        follow_vmm_once(rings, positions);
+        std::this_thread::sleep_for(follow_interval);
+    }
+}
+
+void
+ioctl_driver::follow_vmm_once(const drr_list_type &rings, pos_list_type &positions)
+{
+    expects(rings.size() == positions.size());
+
+    entry_list_type entries;
+
+    for (auto i = 0ULL; i < rings.size(); i++) {
+        positions.at(i) = debug_ring_entries(rings.at(i), entries, positions.at(i));
+    }
+
+    print_entries(entries, m_tsc_info, m_last_tsc);
+    std::cout << std::flush;
+}
+
+void
+ioctl_driver::get_tsc_info()
+{
+    m_tsc_info = {};
+    m_last_tsc = 0;
+
+    if (!m_clp->timestamps()) {
+        return;
+    }
+
+    m_ioctl->call_ioctl_get_tsc_info(&m_tsc_info);
+
+    if (m_tsc_info.freq == 0) {
+        throw std::runtime_error("timestamps not supported: unknown TSC frequency");
+    }
+}
+
 void
 ioctl_driver::vmm_status()
 {
     switch (get_status()) {
-        case VMM_UNLOADED: std::cout << "vmm unloaded\n"; return;
-        case VMM_LOADED: std::cout << "vmm loaded\n"; return;
-        case VMM_RUNNING: std::cout << "vmm running\n"; return;
-        case VMM_CORRUPT: std::cout << "vmm corrupt\n"; return;
+        case VMM_UNLOADED: std::cout << "vmm unloaded\n"; break;
+        case VMM_LOADED: std::cout << "vmm loaded\n"; break;
+        case VMM_RUNNING: std::cout << "vmm running\n"; break;
+        case VMM_CORRUPT: std::cout << "vmm corrupt\n"; break;
         default: throw std::runtime_error("unknown status");
     }
+
+    this->vmm_stats();
+}
+
+// The counters come from the driver's status page, which cannot be mapped
+// on every platform, so they are only printed if the status page can be
+// mapped, and a consistent copy of it can be read.
+//
+
+void
+ioctl_driver::vmm_stats()
+{
+    ioctl::const_vmm_status_pointer page = nullptr;
+
+    try {
+        page = m_ioctl->map_vmm_status();
+    }
+    catch (std::runtime_error &) {
+        return;
+    }
+
+    ioctl::vmm_status_type status{};
+    if (vmm_status_read(page, &status) == 0) {
+        return;
+    }
+
+    uint64_t exits = 0;
+    for (auto i = 0ULL; i < MAX_VMM_STATUS_CPUS; i++) {
+        exits += status.exits[i].count;
+    }
+
+    std::cout << "cpus started: " << status.num_cpus_started << " of " << status.num_cpus << '\n';
+    std::cout << "memory: " << status.memory << " bytes\n";
+    std::cout << "exits: " << exits << '\n';
+}
+
+void
+ioctl_driver::dump_trace()
+{
+    auto found = false;
+    auto trr = std::make_unique<ioctl::trr_type>();
+    auto buffer = std::make_unique<trace_record_t[]>(TRACE_RING_SIZE);
+
+    record_list_type records;
+
+    switch (get_status()) {
+        case VMM_RUNNING: break;
+        case VMM_LOADED: break;
+        case VMM_UNLOADED: throw std::runtime_error("vmm must be loaded first");
+        case VMM_CORRUPT: throw std::runtime_error("vmm corrupt");
+        default: throw std::runtime_error("unknown status");
+    }
+
+    for (auto cpuid = 0ULL; cpuid < MAX_TRACE_RING_CPUS; cpuid++) {
+        try {
+            m_ioctl->call_ioctl_dump_trace(trr.get(), cpuid);
+        }
+        catch (std::runtime_error &) {
+            continue;
+        }
+
+        found = true;
+
+        auto num = trace_ring_read(trr.get(), buffer.get(), TRACE_RING_SIZE);
+        for (auto i = 0ULL; i < num; i++) {
+            records.emplace_back(cpuid, buffer[i]);
+        }
+    }
+
+    if (!found) {
+        throw std::runtime_error("failed to dump trace: no trace rings found");
+    }
+
+    std::stable_sort(records.begin(), records.end(), [](const auto &lhs, const auto &rhs) {
+        return lhs.second.tsc < rhs.second.tsc;
+    });
+
+    for (const auto &record : records) {
+        std::cout << trace_record_to_string(record.first, record.second) << '\n';
+    }
+}
+
+void
+ioctl_driver::set_debug_level()
+{
+    switch (get_status()) {
+        case VMM_RUNNING: break;
+        case VMM_LOADED: break;
+        case VMM_UNLOADED: throw std::runtime_error("vmm must be loaded first");
+        case VMM_CORRUPT: throw std::runtime_error("vmm corrupt");
+        default: throw std::runtime_error("unknown status");
+    }
+
+    m_ioctl->call_ioctl_set_debug_level(m_clp->subsystem(), m_clp->level());
+}
+
+// A bundle contains all of the VMM's modules, already relocated (see
+// bfelf_bundle_create()), which means the driver can load the VMM without
+// resolving any symbols. Bundles are created once (e.g. when the VMM is
+// installed), and are then loaded like any other VMM.
+//
+
+void
+ioctl_driver::bundle_vmm()
+{
+    auto filename = vmm_filename();
+    auto module_list = vmm_module_list(filename);
+
+    binaries_info binaries{m_file, module_list, false};
+    m_file->write_binary(m_clp->output(), bfelf_bundle_create(binaries));
 }
 
 ioctl_driver::list_type
@@ -214,6 +703,9 @@ ioctl_driver::vmm_module_list(const filename_type &filename)
             module_list.push_back(module);
         }
     }
+    else if (m_file->extension(filename) == ".bundle") {
+        module_list.push_back(filename);
+    }
     else {
         bfn::buffer buffer{};
         bfelf_binary_t binary{};
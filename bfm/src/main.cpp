@@ -78,16 +78,45 @@ bfm_help()
     std::cout << R"(Usage: bfm [OPTION]... load...)" << std::endl;
     std::cout << R"(  or:  bfm [OPTION]... load... binary)" << std::endl;
     std::cout << R"(  or:  bfm [OPTION]... load... file.modules)" << std::endl;
+    std::cout << R"(  or:  bfm [OPTION]... load... file.bundle)" << std::endl;
     std::cout << R"(  or:  bfm [OPTION]... unload...)" << std::endl;
     std::cout << R"(  or:  bfm [OPTION]... start...)" << std::endl;
     std::cout << R"(  or:  bfm [OPTION]... quick...)" << std::endl;
     std::cout << R"(  or:  bfm [OPTION]... stop...)" << std::endl;
     std::cout << R"(  or:  bfm [OPTION]... dump...)" << std::endl;
     std::cout << R"(  or:  bfm [OPTION]... status...)" << std::endl;
+    std::cout << R"(  or:  bfm [OPTION]... trace...)" << std::endl;
+    std::cout << R"(  or:  bfm [OPTION]... level... LEVEL [SUBSYSTEM])" << std::endl;
+    std::cout << R"(  or:  bfm [OPTION]... bundle... binary|file.modules file.bundle)" << std::endl;
     std::cout << R"(Controls or queries the bareflank hypervisor)" << std::endl;
     std::cout << std::endl;
+    std::cout << R"(           --channel CHANNEL)" << std::endl;
+    std::cout << R"(                       the channel to dump, one of debug (the default),)" << std::endl;
+    std::cout << R"(                       metrics or trace (dump only))" << std::endl;
+    std::cout << R"(           --debug-ring-size SIZE)" << std::endl;
+    std::cout << R"(                       the size of each debug ring in bytes (load and)" << std::endl;
+    std::cout << R"(                       quick only, must be a power of 2))" << std::endl;
+    std::cout << R"(       -f, --follow    keep printing the debug ring as it is written)" << std::endl;
+    std::cout << R"(                       (dump only, requires mmap support in bfdriver))" << std::endl;
     std::cout << R"(       -h, --help      show this help menu)" << std::endl;
-    std::cout << R"(           --vcpuid    indicate the requested vcpuid)" << std::endl;
+    std::cout << R"(       -t, --timestamps)" << std::endl;
+    std::cout << R"(                       prefix each line of the debug ring with its)" << std::endl;
+    std::cout << R"(                       wall-clock time (UTC), and the time since the)" << std::endl;
+    std::cout << R"(                       previous line (dump only))" << std::endl;
+    std::cout << R"(           --vcpuid    indicate the requested vcpuid (dump merges all)" << std::endl;
+    std::cout << R"(                       of the CPU debug rings if not provided))" << std::endl;
+    std::cout << std::endl;
+    std::cout << R"(The level command changes the debug level of a VMM subsystem at runtime.)" << std::endl;
+    std::cout << R"(SUBSYSTEM is one of default, memory_manager, vmcs, exit_handler, vcpu or)" << std::endl;
+    std::cout << R"(all (the default))" << std::endl;
+    std::cout << std::endl;
+    std::cout << R"(The VMM writes its debug output (stdout / stderr) to the debug channel.)" << std::endl;
+    std::cout << R"(Anything the VMM writes to fd 3 and fd 4 goes to the metrics and trace)" << std::endl;
+    std::cout << R"(channels, which are not written to the serial port)" << std::endl;
+    std::cout << std::endl;
+    std::cout << R"(The bundle command loads and relocates the VMM's modules once, and writes)" << std::endl;
+    std::cout << R"(the result to file.bundle, which can then be loaded without resolving any)" << std::endl;
+    std::cout << R"(symbols)" << std::endl;
 }
 
 int
@@ -120,7 +149,10 @@ protected_main(const command_line_parser::arg_list_type &args)
     // IO Controller
 
     auto ctl = std::make_unique<ioctl>();
-    ctl->open();
+
+    if (clp->cmd() != command_line_parser_command::bundle) {
+        ctl->open();
+    }
 
     // -------------------------------------------------------------------------
     // Page-In Memory
@@ -23,6 +23,7 @@
 
 #include <fcntl.h>
 #include <unistd.h>
+#include <sys/mman.h>
 #include <sys/ioctl.h>
 
 // -----------------------------------------------------------------------------
@@ -53,6 +54,13 @@ bfm_write_ioctl(int fd, unsigned long request, const void *data)
     return ioctl(fd, request, data);
 }
 
+void *
+bfm_mmap(int fd, size_t len, off_t offset = 0)
+{
+    auto ptr = mmap(nullptr, len, PROT_READ, MAP_SHARED, fd, offset);
+    return ptr != MAP_FAILED ? ptr : nullptr;
+}
+
 // -----------------------------------------------------------------------------
 // Implementation
 // -----------------------------------------------------------------------------
@@ -64,6 +72,10 @@ ioctl_private::ioctl_private() :
 
 ioctl_private::~ioctl_private()
 {
+    for (const auto &map : maps) {
+        munmap(map.first, map.second);
+    }
+
     if (fd >= 0) {
         close(fd);
     }
@@ -95,6 +107,18 @@ ioctl_private::call_ioctl_add_module(gsl::not_null<module_data_type> data)
     }
 }
 
+void
+ioctl_private::call_ioctl_add_modules(const module_vec_list_type &vec)
+{
+    expects(!vec.empty());
+
+    add_modules_t modules = {vec.size(), reinterpret_cast<uint64_t>(vec.data())};
+
+    if (bfm_write_ioctl(fd, IOCTL_ADD_MODULES, &modules) < 0) {
+        throw std::runtime_error("ioctl failed: IOCTL_ADD_MODULES");
+    }
+}
+
 void
 ioctl_private::call_ioctl_load_vmm()
 {
@@ -139,6 +163,77 @@ ioctl_private::call_ioctl_dump_vmm(gsl::not_null<drr_pointer> drr, vcpuid_type v
     }
 }
 
+static ioctl_private::const_drr_pointer
+to_debug_ring(const void *map)
+{
+    // The debug ring is page aligned, and the driver maps it from the start
+    // of its header, so the debug ring is always at the start of the map.
+    //
+
+    auto drr = static_cast<ioctl_private::const_drr_pointer>(map);
+
+    if (drr->tag1 != DEBUG_RING_TAG1 || drr->tag2 != DEBUG_RING_TAG2) {
+        return nullptr;
+    }
+
+    return drr;
+}
+
+ioctl_private::const_drr_pointer
+ioctl_private::map_debug_ring(vcpuid_type vcpuid)
+{
+    if (bfm_write_ioctl(fd, IOCTL_SET_VCPUID, &vcpuid) < 0) {
+        throw std::runtime_error("ioctl failed: IOCTL_SET_VCPUID");
+    }
+
+    // The size of the debug ring is stored in its header, so the header is
+    // mapped first to get the size, and then the entire debug ring is
+    // mapped.
+    //
+
+    auto size = DEBUG_RING_MMAP_SIZE(0);
+    auto map = bfm_mmap(fd, size);
+    if (map == nullptr) {
+        throw std::runtime_error("mmap failed: debug ring");
+    }
+
+    auto drr = to_debug_ring(map);
+    if (drr == nullptr || debug_ring_size_valid(drr->len) == 0) {
+        munmap(map, size);
+        throw std::runtime_error("mmap failed: debug ring not found");
+    }
+
+    auto len = drr->len;
+    munmap(map, size);
+
+    size = DEBUG_RING_MMAP_SIZE(len);
+    map = bfm_mmap(fd, size);
+    if (map == nullptr) {
+        throw std::runtime_error("mmap failed: debug ring");
+    }
+
+    maps.emplace_back(map, size);
+
+    drr = to_debug_ring(map);
+    if (drr == nullptr || drr->len != len) {
+        throw std::runtime_error("mmap failed: debug ring not found");
+    }
+
+    return drr;
+}
+
+void
+ioctl_private::call_ioctl_dump_trace(gsl::not_null<trr_pointer> trr, cpuid_type cpuid)
+{
+    if (bfm_write_ioctl(fd, IOCTL_SET_VCPUID, &cpuid) < 0) {
+        throw std::runtime_error("ioctl failed: IOCTL_SET_VCPUID");
+    }
+
+    if (bfm_read_ioctl(fd, IOCTL_DUMP_TRACE, trr) < 0) {
+        throw std::runtime_error("ioctl failed: IOCTL_DUMP_TRACE");
+    }
+}
+
 void
 ioctl_private::call_ioctl_vmm_status(gsl::not_null<status_pointer> status)
 {
@@ -146,3 +241,41 @@ ioctl_private::call_ioctl_vmm_status(gsl::not_null<status_pointer> status)
         throw std::runtime_error("ioctl failed: IOCTL_VMM_STATUS");
     }
 }
+
+ioctl_private::const_vmm_status_pointer
+ioctl_private::map_vmm_status()
+{
+    auto map = bfm_mmap(fd, VMM_STATUS_SIZE, VMM_STATUS_MMAP_OFFSET);
+    if (map == nullptr) {
+        throw std::runtime_error("mmap failed: status page");
+    }
+
+    maps.emplace_back(map, VMM_STATUS_SIZE);
+    return static_cast<const_vmm_status_pointer>(map);
+}
+
+void
+ioctl_private::call_ioctl_set_debug_level(subsystem_type subsystem, level_type level)
+{
+    debug_level_t debug_level = {subsystem, level};
+
+    if (bfm_write_ioctl(fd, IOCTL_SET_DEBUG_LEVEL, &debug_level) < 0) {
+        throw std::runtime_error("ioctl failed: IOCTL_SET_DEBUG_LEVEL");
+    }
+}
+
+void
+ioctl_private::call_ioctl_set_debug_ring_size(ring_size_type size)
+{
+    if (bfm_write_ioctl(fd, IOCTL_SET_DEBUG_RING_SIZE, &size) < 0) {
+        throw std::runtime_error("ioctl failed: IOCTL_SET_DEBUG_RING_SIZE");
+    }
+}
+
+void
+ioctl_private::call_ioctl_get_tsc_info(gsl::not_null<tsc_info_pointer> info)
+{
+    if (bfm_read_ioctl(fd, IOCTL_GET_TSC_INFO, info) < 0) {
+        throw std::runtime_error("ioctl failed: IOCTL_GET_TSC_INFO");
+    }
+}
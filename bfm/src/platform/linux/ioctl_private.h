@@ -19,7 +19,11 @@
 #ifndef IOCTL_PRIVATE_H
 #define IOCTL_PRIVATE_H
 
+#include <vector>
+#include <utility>
+
 #include <ioctl.h>
+#include <bfdriverinterface.h>
 
 class ioctl_private : public ioctl_private_base
 {
@@ -27,9 +31,18 @@ public:
 
     using module_len_type = size_t;
     using module_data_type = const char *;
+    using module_vec_list_type = std::vector<module_vec_t>;
     using drr_pointer = ioctl::drr_pointer;
+    using const_drr_pointer = ioctl::const_drr_pointer;
+    using trr_pointer = ioctl::trr_pointer;
+    using cpuid_type = ioctl::cpuid_type;
     using vcpuid_type = ioctl::vcpuid_type;
     using status_pointer = ioctl::status_pointer;
+    using const_vmm_status_pointer = ioctl::const_vmm_status_pointer;
+    using subsystem_type = ioctl::subsystem_type;
+    using level_type = ioctl::level_type;
+    using ring_size_type = ioctl::ring_size_type;
+    using tsc_info_pointer = ioctl::tsc_info_pointer;
     using handle_type = int;
 
     ioctl_private();
@@ -38,16 +51,24 @@ public:
     virtual void open();
     virtual void call_ioctl_add_module_length(module_len_type len);
     virtual void call_ioctl_add_module(gsl::not_null<module_data_type> data);
+    virtual void call_ioctl_add_modules(const module_vec_list_type &vec);
     virtual void call_ioctl_load_vmm();
     virtual void call_ioctl_unload_vmm();
     virtual void call_ioctl_start_vmm();
     virtual void call_ioctl_stop_vmm();
     virtual void call_ioctl_dump_vmm(gsl::not_null<drr_pointer> drr, vcpuid_type vcpuid);
+    virtual const_drr_pointer map_debug_ring(vcpuid_type vcpuid);
+    virtual void call_ioctl_dump_trace(gsl::not_null<trr_pointer> trr, cpuid_type cpuid);
     virtual void call_ioctl_vmm_status(gsl::not_null<status_pointer> status);
+    virtual const_vmm_status_pointer map_vmm_status();
+    virtual void call_ioctl_set_debug_level(subsystem_type subsystem, level_type level);
+    virtual void call_ioctl_set_debug_ring_size(ring_size_type size);
+    virtual void call_ioctl_get_tsc_info(gsl::not_null<tsc_info_pointer> info);
 
 private:
 
     handle_type fd;
+    std::vector<std::pair<void *, size_t>> maps;
 };
 
 #endif
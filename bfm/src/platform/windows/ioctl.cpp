@@ -39,6 +39,14 @@ ioctl::call_ioctl_add_module(const binary_data &module_data)
     }
 }
 
+void
+ioctl::call_ioctl_add_modules(const std::vector<binary_data> &modules)
+{
+    for (const auto &module_data : modules) {
+        this->call_ioctl_add_module(module_data);
+    }
+}
+
 void
 ioctl::call_ioctl_load_vmm()
 {
@@ -79,6 +87,21 @@ ioctl::call_ioctl_dump_vmm(gsl::not_null<drr_pointer> drr, vcpuid_type vcpuid)
     }
 }
 
+ioctl::const_drr_pointer
+ioctl::map_debug_ring(vcpuid_type vcpuid)
+{
+    bfignored(vcpuid);
+    throw std::runtime_error("map_debug_ring failed: not supported on this platform");
+}
+
+void
+ioctl::call_ioctl_dump_trace(gsl::not_null<trr_pointer> trr, cpuid_type cpuid)
+{
+    if (auto d = dynamic_cast<ioctl_private *>(m_d.get())) {
+        d->call_ioctl_dump_trace(trr, cpuid);
+    }
+}
+
 void
 ioctl::call_ioctl_vmm_status(gsl::not_null<status_pointer> status)
 {
@@ -86,3 +109,33 @@ ioctl::call_ioctl_vmm_status(gsl::not_null<status_pointer> status)
         d->call_ioctl_vmm_status(status);
     }
 }
+
+ioctl::const_vmm_status_pointer
+ioctl::map_vmm_status()
+{
+    throw std::runtime_error("map_vmm_status failed: not supported on this platform");
+}
+
+void
+ioctl::call_ioctl_set_debug_level(subsystem_type subsystem, level_type level)
+{
+    if (auto d = dynamic_cast<ioctl_private *>(m_d.get())) {
+        d->call_ioctl_set_debug_level(subsystem, level);
+    }
+}
+
+void
+ioctl::call_ioctl_set_debug_ring_size(ring_size_type size)
+{
+    if (auto d = dynamic_cast<ioctl_private *>(m_d.get())) {
+        d->call_ioctl_set_debug_ring_size(size);
+    }
+}
+
+void
+ioctl::call_ioctl_get_tsc_info(gsl::not_null<tsc_info_pointer> info)
+{
+    if (auto d = dynamic_cast<ioctl_private *>(m_d.get())) {
+        d->call_ioctl_get_tsc_info(info);
+    }
+}
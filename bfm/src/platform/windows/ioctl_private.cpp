@@ -209,11 +209,29 @@ ioctl_private::call_ioctl_dump_vmm(gsl::not_null<drr_pointer> drr, vcpuid_type v
         throw std::runtime_error("ioctl failed: IOCTL_SET_VCPUID");
     }
 
-    if (bfm_read_ioctl(fd, IOCTL_DUMP_VMM, drr, sizeof(*drr)) == BF_IOCTL_FAILURE) {
+    // The caller provides the size of the buffer that follows the header
+    // using len, which is how the driver knows how much it can copy.
+    //
+
+    auto size = debug_ring_total_size(drr->len);
+
+    if (bfm_read_ioctl(fd, IOCTL_DUMP_VMM, drr, gsl::narrow_cast<DWORD>(size)) == BF_IOCTL_FAILURE) {
         throw std::runtime_error("ioctl failed: IOCTL_DUMP_VMM");
     }
 }
 
+void
+ioctl_private::call_ioctl_dump_trace(gsl::not_null<trr_pointer> trr, cpuid_type cpuid)
+{
+    if (bfm_write_ioctl(fd, IOCTL_SET_VCPUID, &cpuid, sizeof(cpuid)) == BF_IOCTL_FAILURE) {
+        throw std::runtime_error("ioctl failed: IOCTL_SET_VCPUID");
+    }
+
+    if (bfm_read_ioctl(fd, IOCTL_DUMP_TRACE, trr, sizeof(*trr)) == BF_IOCTL_FAILURE) {
+        throw std::runtime_error("ioctl failed: IOCTL_DUMP_TRACE");
+    }
+}
+
 void
 ioctl_private::call_ioctl_vmm_status(gsl::not_null<status_pointer> status)
 {
@@ -222,6 +240,32 @@ ioctl_private::call_ioctl_vmm_status(gsl::not_null<status_pointer> status)
     }
 }
 
+void
+ioctl_private::call_ioctl_set_debug_level(subsystem_type subsystem, level_type level)
+{
+    debug_level_t debug_level = {subsystem, level};
+
+    if (bfm_write_ioctl(fd, IOCTL_SET_DEBUG_LEVEL, &debug_level, sizeof(debug_level)) == BF_IOCTL_FAILURE) {
+        throw std::runtime_error("ioctl failed: IOCTL_SET_DEBUG_LEVEL");
+    }
+}
+
+void
+ioctl_private::call_ioctl_set_debug_ring_size(ring_size_type size)
+{
+    if (bfm_write_ioctl(fd, IOCTL_SET_DEBUG_RING_SIZE, &size, sizeof(size)) == BF_IOCTL_FAILURE) {
+        throw std::runtime_error("ioctl failed: IOCTL_SET_DEBUG_RING_SIZE");
+    }
+}
+
+void
+ioctl_private::call_ioctl_get_tsc_info(gsl::not_null<tsc_info_pointer> info)
+{
+    if (bfm_read_ioctl(fd, IOCTL_GET_TSC_INFO, info, sizeof(*info)) == BF_IOCTL_FAILURE) {
+        throw std::runtime_error("ioctl failed: IOCTL_GET_TSC_INFO");
+    }
+}
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif
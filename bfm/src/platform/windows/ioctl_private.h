@@ -38,8 +38,14 @@ public:
     using module_len_type = size_t;
     using module_data_type = const char *;
     using drr_pointer = ioctl::drr_pointer;
+    using trr_pointer = ioctl::trr_pointer;
+    using cpuid_type = ioctl::cpuid_type;
     using vcpuid_type = ioctl::vcpuid_type;
     using status_pointer = ioctl::status_pointer;
+    using subsystem_type = ioctl::subsystem_type;
+    using level_type = ioctl::level_type;
+    using ring_size_type = ioctl::ring_size_type;
+    using tsc_info_pointer = ioctl::tsc_info_pointer;
     using handle_type = int;
 
     ioctl_private();
@@ -52,7 +58,11 @@ public:
     virtual void call_ioctl_start_vmm();
     virtual void call_ioctl_stop_vmm();
     virtual void call_ioctl_dump_vmm(gsl::not_null<drr_pointer> drr, vcpuid_type vcpuid);
+    virtual void call_ioctl_dump_trace(gsl::not_null<trr_pointer> trr, cpuid_type cpuid);
     virtual void call_ioctl_vmm_status(gsl::not_null<status_pointer> status);
+    virtual void call_ioctl_set_debug_level(subsystem_type subsystem, level_type level);
+    virtual void call_ioctl_set_debug_ring_size(ring_size_type size);
+    virtual void call_ioctl_get_tsc_info(gsl::not_null<tsc_info_pointer> info);
 
 private:
     HANDLE fd;
@@ -196,6 +196,15 @@ TEST_CASE("test command line parser with valid status")
     CHECK(clp.cmd() == command_line_parser::command_type::status);
 }
 
+TEST_CASE("test command line parser with valid trace")
+{
+    auto args = {"trace"_s};
+    command_line_parser clp{};
+
+    CHECK_NOTHROW(clp.parse(args));
+    CHECK(clp.cmd() == command_line_parser::command_type::trace);
+}
+
 TEST_CASE("test command line parser no vcpuid")
 {
     auto args = {"dump"_s, "--vcpuid"_s};
@@ -224,3 +233,179 @@ TEST_CASE("test command line parser valid vcpuid")
     CHECK(clp.cmd() == command_line_parser::command_type::dump);
     CHECK(clp.vcpuid() == 2);
 }
+
+TEST_CASE("test command line parser follow")
+{
+    auto args = {"dump"_s, "--follow"_s};
+    command_line_parser clp{};
+
+    CHECK_NOTHROW(clp.parse(args));
+    CHECK(clp.cmd() == command_line_parser::command_type::dump);
+    CHECK(clp.follow());
+}
+
+TEST_CASE("test command line parser no follow")
+{
+    auto args = {"dump"_s};
+    command_line_parser clp{};
+
+    CHECK_NOTHROW(clp.parse(args));
+    CHECK(clp.cmd() == command_line_parser::command_type::dump);
+    CHECK(!clp.follow());
+}
+
+TEST_CASE("test command line parser timestamps")
+{
+    auto args = {"dump"_s, "-t"_s};
+    command_line_parser clp{};
+
+    CHECK_NOTHROW(clp.parse(args));
+    CHECK(clp.cmd() == command_line_parser::command_type::dump);
+    CHECK(clp.timestamps());
+}
+
+TEST_CASE("test command line parser no timestamps")
+{
+    auto args = {"dump"_s};
+    command_line_parser clp{};
+
+    CHECK_NOTHROW(clp.parse(args));
+    CHECK(!clp.timestamps());
+}
+
+TEST_CASE("test command line parser channel")
+{
+    auto args = {"dump"_s, "--channel"_s, "metrics"_s};
+    command_line_parser clp{};
+
+    CHECK_NOTHROW(clp.parse(args));
+    CHECK(clp.cmd() == command_line_parser::command_type::dump);
+    CHECK(clp.channel() == DEBUG_RING_CHANNEL_METRICS);
+}
+
+TEST_CASE("test command line parser trace channel")
+{
+    auto args = {"dump"_s, "--channel"_s, "trace"_s};
+    command_line_parser clp{};
+
+    CHECK_NOTHROW(clp.parse(args));
+    CHECK(clp.channel() == DEBUG_RING_CHANNEL_TRACE);
+}
+
+TEST_CASE("test command line parser default channel")
+{
+    auto args = {"dump"_s};
+    command_line_parser clp{};
+
+    CHECK_NOTHROW(clp.parse(args));
+    CHECK(clp.channel() == DEBUG_RING_CHANNEL_DEBUG);
+}
+
+TEST_CASE("test command line parser invalid channel")
+{
+    auto args = {"dump"_s, "--channel"_s, "unknown"_s};
+    command_line_parser clp{};
+
+    CHECK_THROWS(clp.parse(args));
+    CHECK(clp.cmd() == command_line_parser::command_type::help);
+}
+
+TEST_CASE("test command line parser debug ring size")
+{
+    auto args = {"load"_s, "--debug-ring-size"_s, "0x10000"_s, "test"_s};
+    command_line_parser clp{};
+
+    CHECK_NOTHROW(clp.parse(args));
+    CHECK(clp.cmd() == command_line_parser::command_type::load);
+    CHECK(clp.modules() == "test");
+    CHECK(clp.debug_ring_size() == 0x10000);
+}
+
+TEST_CASE("test command line parser default debug ring size")
+{
+    auto args = {"load"_s, "test"_s};
+    command_line_parser clp{};
+
+    CHECK_NOTHROW(clp.parse(args));
+    CHECK(clp.debug_ring_size() == DEBUG_RING_SIZE);
+}
+
+TEST_CASE("test command line parser invalid debug ring size")
+{
+    auto args = {"load"_s, "--debug-ring-size"_s, "12345"_s, "test"_s};
+    command_line_parser clp{};
+
+    CHECK_THROWS(clp.parse(args));
+    CHECK(clp.cmd() == command_line_parser::command_type::help);
+    CHECK(clp.debug_ring_size() == DEBUG_RING_SIZE);
+}
+
+TEST_CASE("test command line parser level missing level")
+{
+    auto args = {"level"_s};
+    command_line_parser clp{};
+
+    CHECK_THROWS(clp.parse(args));
+    CHECK(clp.cmd() == command_line_parser::command_type::help);
+}
+
+TEST_CASE("test command line parser level invalid level")
+{
+    auto args = {"level"_s, "not_a_number"_s};
+    command_line_parser clp{};
+
+    CHECK_THROWS(clp.parse(args));
+    CHECK(clp.cmd() == command_line_parser::command_type::help);
+}
+
+TEST_CASE("test command line parser level invalid subsystem")
+{
+    auto args = {"level"_s, "1"_s, "not_a_subsystem"_s};
+    command_line_parser clp{};
+
+    CHECK_THROWS(clp.parse(args));
+    CHECK(clp.cmd() == command_line_parser::command_type::help);
+}
+
+TEST_CASE("test command line parser level all subsystems")
+{
+    auto args = {"level"_s, "2"_s};
+    command_line_parser clp{};
+
+    CHECK_NOTHROW(clp.parse(args));
+    CHECK(clp.cmd() == command_line_parser::command_type::level);
+    CHECK(clp.level() == 2);
+    CHECK(clp.subsystem() == BFDEBUG_SUBSYSTEM_ALL);
+}
+
+TEST_CASE("test command line parser level single subsystem")
+{
+    auto args = {"level"_s, "3"_s, "vmcs"_s};
+    command_line_parser clp{};
+
+    CHECK_NOTHROW(clp.parse(args));
+    CHECK(clp.cmd() == command_line_parser::command_type::level);
+    CHECK(clp.level() == 3);
+    CHECK(clp.subsystem() == BFDEBUG_SUBSYSTEM_VMCS);
+}
+
+TEST_CASE("test command line parser bundle")
+{
+    auto args = {"bundle"_s, "vmm.modules"_s, "vmm.bundle"_s};
+    command_line_parser clp{};
+
+    CHECK_NOTHROW(clp.parse(args));
+    CHECK(clp.cmd() == command_line_parser::command_type::bundle);
+    CHECK(clp.modules() == "vmm.modules");
+    CHECK(clp.output() == "vmm.bundle");
+}
+
+TEST_CASE("test command line parser bundle missing output")
+{
+    auto args = {"bundle"_s, "vmm.modules"_s};
+    command_line_parser clp{};
+
+    CHECK_THROWS(clp.parse(args));
+    CHECK(clp.cmd() == command_line_parser::command_type::help);
+    CHECK(clp.output().empty());
+}
@@ -18,6 +18,8 @@
 
 #include <test_support.h>
 
+#include <sstream>
+
 #ifdef _HIPPOMOCKS__ENABLE_CFUNC_MOCKING_SUPPORT
 
 ioctl::status_type g_status = 0;
@@ -50,11 +52,18 @@ setup_ioctl(MockRepository &mocks, ioctl::status_type status)
 
     mocks.OnCall(ctl, ioctl::open);
     mocks.OnCall(ctl, ioctl::call_ioctl_add_module);
+    mocks.OnCall(ctl, ioctl::call_ioctl_add_modules);
     mocks.OnCall(ctl, ioctl::call_ioctl_load_vmm);
     mocks.OnCall(ctl, ioctl::call_ioctl_unload_vmm);
     mocks.OnCall(ctl, ioctl::call_ioctl_start_vmm);
     mocks.OnCall(ctl, ioctl::call_ioctl_stop_vmm);
     mocks.OnCall(ctl, ioctl::call_ioctl_dump_vmm);
+    mocks.OnCall(ctl, ioctl::call_ioctl_dump_trace);
+    mocks.OnCall(ctl, ioctl::map_debug_ring).Throw(std::runtime_error("error"));
+    mocks.OnCall(ctl, ioctl::map_vmm_status).Throw(std::runtime_error("error"));
+    mocks.OnCall(ctl, ioctl::call_ioctl_set_debug_level);
+    mocks.OnCall(ctl, ioctl::call_ioctl_set_debug_ring_size);
+    mocks.OnCall(ctl, ioctl::call_ioctl_get_tsc_info);
 
     mocks.OnCall(ctl, ioctl::call_ioctl_vmm_status).Do([&](auto s) {
         *s = g_status;
@@ -70,7 +79,14 @@ setup_command_line_parser(MockRepository &mocks, clpc type)
 
     mocks.OnCall(clp, command_line_parser::cmd).Return(type);
     mocks.OnCall(clp, command_line_parser::modules).Return(std::string{"test"});
+    mocks.OnCall(clp, command_line_parser::output).Return(std::string{"test.bundle"});
     mocks.OnCall(clp, command_line_parser::vcpuid).Return(0);
+    mocks.OnCall(clp, command_line_parser::follow).Return(false);
+    mocks.OnCall(clp, command_line_parser::timestamps).Return(false);
+    mocks.OnCall(clp, command_line_parser::channel).Return(DEBUG_RING_CHANNEL_DEBUG);
+    mocks.OnCall(clp, command_line_parser::subsystem).Return(BFDEBUG_SUBSYSTEM_VMCS);
+    mocks.OnCall(clp, command_line_parser::level).Return(1);
+    mocks.OnCall(clp, command_line_parser::debug_ring_size).Return(DEBUG_RING_SIZE);
 
     return clp;
 }
@@ -309,6 +325,21 @@ TEST_CASE("test ioctl driver vmm module list non-empty needed list")
     CHECK(driver.vmm_module_list("test.bin").size() == 3);
 }
 
+TEST_CASE("test ioctl driver vmm module list bundle")
+{
+    MockRepository mocks;
+    ioctl_driver::list_type module_list{"test.bundle"};
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_UNLOADED);
+    auto clp = setup_command_line_parser(mocks, clpc::help);
+
+    mocks.OnCall(fil, file::extension).Return(".bundle"_s);
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK(driver.vmm_module_list("test.bundle") == module_list);
+}
+
 TEST_CASE("test ioctl driver process help")
 {
     MockRepository mocks;
@@ -422,7 +453,25 @@ TEST_CASE("test ioctl driver process add module fails")
         R"({"test":"test.bin"})"
     );
 
-    mocks.ExpectCall(ctl, ioctl::call_ioctl_add_module).Throw(std::runtime_error("error"));
+    mocks.ExpectCall(ctl, ioctl::call_ioctl_add_modules).Throw(std::runtime_error("error"));
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_THROWS(driver.process());
+}
+
+TEST_CASE("test ioctl driver process set debug ring size fails")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_UNLOADED);
+    auto clp = setup_command_line_parser(mocks, clpc::load);
+
+    mocks.OnCall(fil, file::read_text).Return(
+        R"({"test":"test.bin"})"
+    );
+
+    mocks.ExpectCall(ctl, ioctl::call_ioctl_set_debug_ring_size).Throw(std::runtime_error("error"));
 
     auto driver = ioctl_driver(fil, ctl, clp);
     CHECK_THROWS(driver.process());
@@ -440,13 +489,59 @@ TEST_CASE("test ioctl driver process load success")
         R"({"test":"test.bin"})"
     );
 
-    mocks.ExpectCall(ctl, ioctl::call_ioctl_add_module);
+    mocks.ExpectCall(ctl, ioctl::call_ioctl_add_modules);
     mocks.ExpectCall(ctl, ioctl::call_ioctl_load_vmm);
 
     auto driver = ioctl_driver(fil, ctl, clp);
     CHECK_NOTHROW(driver.process());
 }
 
+TEST_CASE("test ioctl driver process load adds all modules at once")
+{
+    MockRepository mocks;
+    std::size_t num_modules = 0;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_UNLOADED);
+    auto clp = setup_command_line_parser(mocks, clpc::load);
+
+    mocks.OnCall(fil, file::read_text).Return(
+        R"(["test1.bin", "test2.bin", "test3.bin"])"
+    );
+
+    mocks.NeverCall(ctl, ioctl::call_ioctl_add_module);
+    mocks.ExpectCall(ctl, ioctl::call_ioctl_add_modules).Do([&](const auto &modules) {
+        num_modules = modules.size();
+    });
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_NOTHROW(driver.process());
+    CHECK(num_modules == 3);
+}
+
+TEST_CASE("test ioctl driver process load debug ring size")
+{
+    MockRepository mocks;
+    ioctl::ring_size_type size = 0;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_UNLOADED);
+    auto clp = setup_command_line_parser(mocks, clpc::load);
+
+    mocks.OnCall(fil, file::read_text).Return(
+        R"({"test":"test.bin"})"
+    );
+
+    mocks.OnCall(clp, command_line_parser::debug_ring_size).Return(DEBUG_RING_MAX_SIZE);
+    mocks.OnCall(ctl, ioctl::call_ioctl_set_debug_ring_size).Do([&](auto s) {
+        size = s;
+    });
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_NOTHROW(driver.process());
+    CHECK(size == DEBUG_RING_MAX_SIZE);
+}
+
 TEST_CASE("test ioctl driver process unload vmm running")
 {
     MockRepository mocks;
@@ -806,9 +901,9 @@ TEST_CASE("test ioctl driver process dump success running")
     mocks.OnCall(ctl, ioctl::call_ioctl_dump_vmm).Do([](gsl::not_null<ioctl::drr_pointer> drr, auto) {
         drr->spos = 0;
         drr->epos = 3;
-        drr->buf[0] = 'h';
-        drr->buf[1] = 'i';
-        drr->buf[2] = '\n';
+        debug_ring_buf(drr)[0] = 'h';
+        debug_ring_buf(drr)[1] = 'i';
+        debug_ring_buf(drr)[2] = '\n';
     });
 
     auto driver = ioctl_driver(fil, ctl, clp);
@@ -826,15 +921,464 @@ TEST_CASE("test ioctl driver process dump success loaded")
     mocks.OnCall(ctl, ioctl::call_ioctl_dump_vmm).Do([](gsl::not_null<ioctl::drr_pointer> drr, auto) {
         drr->spos = 0;
         drr->epos = 3;
-        drr->buf[0] = 'h';
-        drr->buf[1] = 'i';
-        drr->buf[2] = '\n';
+        debug_ring_buf(drr)[0] = 'h';
+        debug_ring_buf(drr)[1] = 'i';
+        debug_ring_buf(drr)[2] = '\n';
     });
 
     auto driver = ioctl_driver(fil, ctl, clp);
     CHECK_NOTHROW(driver.process());
 }
 
+static auto
+make_drr()
+{ return std::make_unique<char[]>(debug_ring_total_size(DEBUG_RING_SIZE)); }
+
+static ioctl::drr_pointer
+to_drr(const std::unique_ptr<char[]> &mem)
+{ return reinterpret_cast<ioctl::drr_pointer>(mem.get()); }
+
+static void
+setup_drr(gsl::not_null<ioctl::drr_pointer> drr, const std::string &str)
+{
+    drr->spos = 0;
+    drr->epos = str.length() + 1;
+    drr->len = DEBUG_RING_SIZE;
+
+    for (auto i = 0U; i < str.length(); i++) {
+        debug_ring_buf(drr)[i] = str.at(i);
+    }
+
+    debug_ring_buf(drr)[str.length()] = '\0';
+}
+
+TEST_CASE("test ioctl driver process dump merged no rings")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_RUNNING);
+    auto clp = setup_command_line_parser(mocks, clpc::dump);
+
+    mocks.OnCall(clp, command_line_parser::vcpuid).Return(vcpuid::invalid);
+    mocks.OnCall(ctl, ioctl::call_ioctl_dump_vmm).Throw(std::runtime_error("error"));
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_THROWS(driver.process());
+}
+
+TEST_CASE("test ioctl driver process dump merged success")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_RUNNING);
+    auto clp = setup_command_line_parser(mocks, clpc::dump);
+
+    mocks.OnCall(clp, command_line_parser::vcpuid).Return(vcpuid::invalid);
+    mocks.OnCall(ctl, ioctl::call_ioctl_dump_vmm).Do([](gsl::not_null<ioctl::drr_pointer> drr, auto id) {
+        switch (id) {
+            case vcpuid::invalid:
+                setup_drr(drr, "unstamped\n");
+                break;
+
+            case DEBUG_RING_CPUID(0):
+                setup_drr(drr, "\x01" "0000000000000003" "cpu0\n");
+                break;
+
+            case DEBUG_RING_CPUID(1):
+                setup_drr(drr, "\x01" "0000000000000001" "cpu1\n");
+                break;
+
+            default:
+                throw std::runtime_error("error");
+        }
+    });
+
+    std::stringstream ss;
+    auto rdbuf = std::cout.rdbuf(ss.rdbuf());
+
+    auto ___ = gsl::finally([&]
+    { std::cout.rdbuf(rdbuf); });
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_NOTHROW(driver.process());
+    CHECK(ss.str() == "unstamped\ncpu1\ncpu0\n\n");
+}
+
+TEST_CASE("test ioctl driver process dump merged invalid stamp")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_RUNNING);
+    auto clp = setup_command_line_parser(mocks, clpc::dump);
+
+    mocks.OnCall(clp, command_line_parser::vcpuid).Return(vcpuid::invalid);
+    mocks.OnCall(ctl, ioctl::call_ioctl_dump_vmm).Do([](gsl::not_null<ioctl::drr_pointer> drr, auto id) {
+        switch (id) {
+            case vcpuid::invalid:
+                setup_drr(drr, "unstamped\n");
+                break;
+
+            case DEBUG_RING_CPUID(0):
+                setup_drr(drr, "\x01" "00000000000000" "torn\n");
+                break;
+
+            case DEBUG_RING_CPUID(1):
+                setup_drr(drr, "\x01" "0000000000000001" "cpu1\n");
+                break;
+
+            default:
+                throw std::runtime_error("error");
+        }
+    });
+
+    std::stringstream ss;
+    auto rdbuf = std::cout.rdbuf(ss.rdbuf());
+
+    auto ___ = gsl::finally([&]
+    { std::cout.rdbuf(rdbuf); });
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_NOTHROW(driver.process());
+    CHECK(ss.str() == "unstamped\ncpu1\n\n");
+}
+
+TEST_CASE("test ioctl driver process dump merged channel")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_RUNNING);
+    auto clp = setup_command_line_parser(mocks, clpc::dump);
+
+    mocks.OnCall(clp, command_line_parser::vcpuid).Return(vcpuid::invalid);
+    mocks.OnCall(clp, command_line_parser::channel).Return(DEBUG_RING_CHANNEL_METRICS);
+    mocks.OnCall(ctl, ioctl::call_ioctl_dump_vmm).Do([](gsl::not_null<ioctl::drr_pointer> drr, auto id) {
+        switch (id) {
+            case DEBUG_RING_CHANNEL(DEBUG_RING_CHANNEL_METRICS, 0):
+                setup_drr(drr, "\x01" "0000000000000002" "metrics0\n");
+                break;
+
+            case DEBUG_RING_CHANNEL(DEBUG_RING_CHANNEL_METRICS, 1):
+                setup_drr(drr, "\x01" "0000000000000001" "metrics1\n");
+                break;
+
+            case vcpuid::invalid:
+            case DEBUG_RING_CPUID(0):
+                setup_drr(drr, "debug\n");
+                break;
+
+            default:
+                throw std::runtime_error("error");
+        }
+    });
+
+    std::stringstream ss;
+    auto rdbuf = std::cout.rdbuf(ss.rdbuf());
+
+    auto ___ = gsl::finally([&]
+    { std::cout.rdbuf(rdbuf); });
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_NOTHROW(driver.process());
+    CHECK(ss.str() == "metrics1\nmetrics0\n\n");
+}
+
+TEST_CASE("test ioctl driver process dump timestamps")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_RUNNING);
+    auto clp = setup_command_line_parser(mocks, clpc::dump);
+
+    mocks.OnCall(clp, command_line_parser::timestamps).Return(true);
+    mocks.OnCall(ctl, ioctl::call_ioctl_get_tsc_info).Do([](gsl::not_null<ioctl::tsc_info_pointer> info) {
+        info->freq = 1000000;
+        info->tsc = 1000;
+        info->wallclock = 86400000000000;
+    });
+
+    mocks.OnCall(ctl, ioctl::call_ioctl_dump_vmm).Do([](gsl::not_null<ioctl::drr_pointer> drr, auto) {
+        auto str = "\x01" "00000000000007d0" "one\n"_s;
+        str += '\0';
+        str += "\x01" "0000000000002710" "two\n";
+
+        setup_drr(drr, str);
+    });
+
+    std::stringstream ss;
+    auto rdbuf = std::cout.rdbuf(ss.rdbuf());
+
+    auto ___ = gsl::finally([&]
+    { std::cout.rdbuf(rdbuf); });
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_NOTHROW(driver.process());
+    CHECK(ss.str() ==
+          "[1970-01-02 00:00:00.000001 +0.000000] one\n"
+          "[1970-01-02 00:00:00.000009 +0.000008] two\n\n");
+}
+
+TEST_CASE("test ioctl driver process dump timestamps unknown frequency")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_RUNNING);
+    auto clp = setup_command_line_parser(mocks, clpc::dump);
+
+    mocks.OnCall(clp, command_line_parser::timestamps).Return(true);
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_THROWS(driver.process());
+}
+
+TEST_CASE("test ioctl driver process dump timestamps failed")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_RUNNING);
+    auto clp = setup_command_line_parser(mocks, clpc::dump);
+
+    mocks.OnCall(clp, command_line_parser::timestamps).Return(true);
+    mocks.OnCall(ctl, ioctl::call_ioctl_get_tsc_info).Throw(std::runtime_error("error"));
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_THROWS(driver.process());
+}
+
+TEST_CASE("test ioctl driver process follow no rings")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_RUNNING);
+    auto clp = setup_command_line_parser(mocks, clpc::dump);
+
+    mocks.OnCall(clp, command_line_parser::vcpuid).Return(vcpuid::invalid);
+    mocks.OnCall(clp, command_line_parser::follow).Return(true);
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_THROWS(driver.process());
+}
+
+TEST_CASE("test ioctl driver process follow map failed")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_RUNNING);
+    auto clp = setup_command_line_parser(mocks, clpc::dump);
+
+    mocks.OnCall(clp, command_line_parser::follow).Return(true);
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_THROWS(driver.process());
+}
+
+TEST_CASE("test ioctl driver follow once")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_RUNNING);
+    auto clp = setup_command_line_parser(mocks, clpc::dump);
+
+    auto mem0 = make_drr();
+    auto mem1 = make_drr();
+
+    auto drr0 = to_drr(mem0);
+    auto drr1 = to_drr(mem1);
+
+    setup_drr(drr0, "\x01" "0000000000000003" "cpu0\n");
+    setup_drr(drr1, "\x01" "0000000000000001" "cpu1\n");
+
+    auto rings = ioctl_driver::drr_list_type{drr0, drr1};
+    auto positions = ioctl_driver::pos_list_type(rings.size());
+
+    std::stringstream ss;
+    auto rdbuf = std::cout.rdbuf(ss.rdbuf());
+
+    auto ___ = gsl::finally([&]
+    { std::cout.rdbuf(rdbuf); });
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+
+    CHECK_NOTHROW(driver.follow_vmm_once(rings, positions));
+    CHECK(ss.str() == "cpu1\ncpu0\n");
+
+    ss.str({});
+    CHECK_NOTHROW(driver.follow_vmm_once(rings, positions));
+    CHECK(ss.str().empty());
+
+    auto str = "\x01" "0000000000000004" "more\n"_s;
+    for (auto i = 0U; i < str.length(); i++) {
+        debug_ring_buf(drr0)[drr0->epos + i] = str.at(i);
+    }
+
+    drr0->epos += str.length() + 1;
+
+    ss.str({});
+    CHECK_NOTHROW(driver.follow_vmm_once(rings, positions));
+    CHECK(ss.str() == "more\n");
+}
+
+TEST_CASE("test ioctl driver follow once starts at spos")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_RUNNING);
+    auto clp = setup_command_line_parser(mocks, clpc::dump);
+
+    auto mem = make_drr();
+    auto drr = to_drr(mem);
+
+    setup_drr(drr, "old\n");
+
+    auto rings = ioctl_driver::drr_list_type{drr};
+    auto positions = ioctl_driver::pos_list_type{0};
+
+    drr->spos = 2;
+
+    std::stringstream ss;
+    auto rdbuf = std::cout.rdbuf(ss.rdbuf());
+
+    auto ___ = gsl::finally([&]
+    { std::cout.rdbuf(rdbuf); });
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_NOTHROW(driver.follow_vmm_once(rings, positions));
+    CHECK(ss.str() == "d\n");
+    CHECK(positions.at(0) == drr->epos);
+}
+
+TEST_CASE("test ioctl driver process trace unloaded")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_UNLOADED);
+    auto clp = setup_command_line_parser(mocks, clpc::trace);
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_THROWS(driver.process());
+}
+
+TEST_CASE("test ioctl driver process trace no rings")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_RUNNING);
+    auto clp = setup_command_line_parser(mocks, clpc::trace);
+
+    mocks.OnCall(ctl, ioctl::call_ioctl_dump_trace).Throw(std::runtime_error("error"));
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_THROWS(driver.process());
+}
+
+TEST_CASE("test ioctl driver process trace success")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_RUNNING);
+    auto clp = setup_command_line_parser(mocks, clpc::trace);
+
+    mocks.OnCall(ctl, ioctl::call_ioctl_dump_trace).Do([](gsl::not_null<ioctl::trr_pointer> trr, auto cpuid) {
+        if (cpuid > 1) {
+            throw std::runtime_error("error");
+        }
+
+        *trr = {};
+        trr->epos = 1;
+        trr->buf[0].id = cpuid == 0 ? TRACE_EVENT_EXIT : TRACE_EVENT_USER + 1;
+        trr->buf[0].tsc = cpuid == 0 ? 2 : 1;
+        trr->buf[0].vcpuid = cpuid;
+        trr->buf[0].args[0] = 0x10;
+    });
+
+    std::stringstream ss;
+    auto rdbuf = std::cout.rdbuf(ss.rdbuf());
+
+    auto ___ = gsl::finally([&]
+    { std::cout.rdbuf(rdbuf); });
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_NOTHROW(driver.process());
+    CHECK(ss.str() ==
+          "0x0000000000000001 cpu 1 vcpu 0x0000000000000001 user+1: "
+          "arg0=0x0000000000000010 arg1=0x0000000000000000 arg2=0x0000000000000000 arg3=0x0000000000000000\n"
+          "0x0000000000000002 cpu 0 vcpu 0x0000000000000000 exit: "
+          "reason=0x0000000000000010 rip=0x0000000000000000\n");
+}
+
+TEST_CASE("test ioctl driver process level unloaded")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_UNLOADED);
+    auto clp = setup_command_line_parser(mocks, clpc::level);
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_THROWS(driver.process());
+}
+
+TEST_CASE("test ioctl driver process level corrupt")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_CORRUPT);
+    auto clp = setup_command_line_parser(mocks, clpc::level);
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_THROWS(driver.process());
+}
+
+TEST_CASE("test ioctl driver process level failed")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_RUNNING);
+    auto clp = setup_command_line_parser(mocks, clpc::level);
+
+    mocks.OnCall(ctl, ioctl::call_ioctl_set_debug_level).Throw(std::runtime_error("error"));
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_THROWS(driver.process());
+}
+
+TEST_CASE("test ioctl driver process level success")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_LOADED);
+    auto clp = setup_command_line_parser(mocks, clpc::level);
+
+    auto subsystem = ioctl::subsystem_type{};
+    auto level = ioctl::level_type{};
+
+    mocks.OnCall(ctl, ioctl::call_ioctl_set_debug_level).Do([&](auto s, auto l) {
+        subsystem = s;
+        level = l;
+    });
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_NOTHROW(driver.process());
+    CHECK(subsystem == BFDEBUG_SUBSYSTEM_VMCS);
+    CHECK(level == 1);
+}
+
 TEST_CASE("test ioctl driver process vmm status running")
 {
     MockRepository mocks;
@@ -895,4 +1439,72 @@ TEST_CASE("test ioctl driver process vmm status unknown status")
     CHECK_THROWS(driver.process());
 }
 
+TEST_CASE("test ioctl driver process vmm status stats")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_RUNNING);
+    auto clp = setup_command_line_parser(mocks, clpc::status);
+
+    auto page = std::make_unique<ioctl::vmm_status_type>();
+    page->tag1 = VMM_STATUS_TAG1;
+    page->version = VMM_STATUS_VERSION;
+    page->state = VMM_RUNNING;
+    page->num_cpus = 2;
+    page->num_cpus_started = 2;
+    page->exits[0].count = 10;
+    page->exits[1].count = 20;
+
+    mocks.OnCall(ctl, ioctl::map_vmm_status).Return(page.get());
+
+    std::stringstream ss;
+    auto rdbuf = std::cout.rdbuf(ss.rdbuf());
+
+    auto ___ = gsl::finally([&]
+    { std::cout.rdbuf(rdbuf); });
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_NOTHROW(driver.process());
+    CHECK(ss.str().find("cpus started: 2 of 2") != std::string::npos);
+    CHECK(ss.str().find("exits: 30") != std::string::npos);
+}
+
+TEST_CASE("test ioctl driver process vmm status invalid stats")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_RUNNING);
+    auto clp = setup_command_line_parser(mocks, clpc::status);
+
+    auto page = std::make_unique<ioctl::vmm_status_type>();
+    mocks.OnCall(ctl, ioctl::map_vmm_status).Return(page.get());
+
+    std::stringstream ss;
+    auto rdbuf = std::cout.rdbuf(ss.rdbuf());
+
+    auto ___ = gsl::finally([&]
+    { std::cout.rdbuf(rdbuf); });
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_NOTHROW(driver.process());
+    CHECK(ss.str().find("exits") == std::string::npos);
+}
+
+TEST_CASE("test ioctl driver process bundle invalid modules")
+{
+    MockRepository mocks;
+
+    auto fil = setup_file(mocks);
+    auto ctl = setup_ioctl(mocks, VMM_UNLOADED);
+    auto clp = setup_command_line_parser(mocks, clpc::bundle);
+
+    mocks.OnCall(fil, file::read_text).Return(R"({"test":"test.bin"})");
+    mocks.NeverCall(fil, file::write_binary);
+
+    auto driver = ioctl_driver(fil, ctl, clp);
+    CHECK_THROWS(driver.process());
+}
+
 #endif
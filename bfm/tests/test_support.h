@@ -45,6 +45,12 @@ ioctl::call_ioctl_add_module(const binary_data &module_data)
     bfignored(module_data);
 }
 
+void
+ioctl::call_ioctl_add_modules(const std::vector<binary_data> &modules)
+{
+    bfignored(modules);
+}
+
 void
 ioctl::call_ioctl_load_vmm()
 { }
@@ -68,26 +74,72 @@ ioctl::call_ioctl_dump_vmm(gsl::not_null<drr_pointer> drr, vcpuid_type vcpuid)
     bfignored(vcpuid);
 }
 
+ioctl::const_drr_pointer
+ioctl::map_debug_ring(vcpuid_type vcpuid)
+{
+    bfignored(vcpuid);
+    return nullptr;
+}
+
+void
+ioctl::call_ioctl_dump_trace(gsl::not_null<trr_pointer> trr, cpuid_type cpuid)
+{
+    bfignored(trr);
+    bfignored(cpuid);
+}
+
 void
 ioctl::call_ioctl_vmm_status(gsl::not_null<status_pointer> status)
 {
     bfignored(status);
 }
 
+ioctl::const_vmm_status_pointer
+ioctl::map_vmm_status()
+{ return nullptr; }
+
+void
+ioctl::call_ioctl_set_debug_level(subsystem_type subsystem, level_type level)
+{
+    bfignored(subsystem);
+    bfignored(level);
+}
+
+void
+ioctl::call_ioctl_set_debug_ring_size(ring_size_type size)
+{
+    bfignored(size);
+}
+
+void
+ioctl::call_ioctl_get_tsc_info(gsl::not_null<tsc_info_pointer> info)
+{
+    bfignored(info);
+}
+
 TEST_CASE("support")
 {
     ioctl ctl{};
     int64_t status;
     auto drr = ioctl::drr_type{};
+    auto trr = std::make_unique<ioctl::trr_type>();
+    auto tsc_info = ioctl::tsc_info_type{};
     auto data = ioctl::binary_data{};
 
     CHECK_NOTHROW(ctl.call_ioctl_add_module(data));
+    CHECK_NOTHROW(ctl.call_ioctl_add_modules({}));
     CHECK_NOTHROW(ctl.call_ioctl_load_vmm());
     CHECK_NOTHROW(ctl.call_ioctl_unload_vmm());
     CHECK_NOTHROW(ctl.call_ioctl_start_vmm());
     CHECK_NOTHROW(ctl.call_ioctl_stop_vmm());
     CHECK_NOTHROW(ctl.call_ioctl_dump_vmm(&drr, 0));
+    CHECK_NOTHROW(ctl.map_debug_ring(0));
+    CHECK_NOTHROW(ctl.call_ioctl_dump_trace(trr.get(), 0));
     CHECK_NOTHROW(ctl.call_ioctl_vmm_status(&status));
+    CHECK_NOTHROW(ctl.map_vmm_status());
+    CHECK_NOTHROW(ctl.call_ioctl_set_debug_level(BFDEBUG_SUBSYSTEM_ALL, 0));
+    CHECK_NOTHROW(ctl.call_ioctl_set_debug_ring_size(DEBUG_RING_SIZE));
+    CHECK_NOTHROW(ctl.call_ioctl_get_tsc_info(&tsc_info));
 }
 
 #endif
@@ -26,6 +26,12 @@
 #include <chrono>
 #include <cstdlib>
 
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
 #include <bfdebug.h>
 
 template<typename T>
@@ -38,6 +44,16 @@ uint64_t benchmark(T func)
     return static_cast<uint64_t>((e - s).count());
 }
 
+template<typename T>
+uint64_t benchmark_cycles(T func)
+{
+    auto s = __rdtsc();
+    func();
+    auto e = __rdtsc();
+
+    return static_cast<uint64_t>(e - s);
+}
+
 size_t g_page_allocs = 0;
 size_t g_nonpage_allocs = 0;
 
@@ -154,6 +154,112 @@
 #define MEM_MAP_POOL_START 0x200000ULL
 #endif
 
+/*
+ * Map Window Slots
+ *
+ * Each CPU is given a private window of virtual memory that is used for
+ * short lived, single page maps (e.g. walking a guest's page tables). This
+ * defines the number of pages in each window. Note that the slots are
+ * tracked using a single 64bit bitmap, so this cannot be larger than 64.
+ *
+ * Note: defined in pages
+ */
+#ifndef MAP_WINDOW_SLOTS
+#define MAP_WINDOW_SLOTS (64ULL)
+#endif
+
+/*
+ * Max Map Window CPUs
+ *
+ * Defines the number of CPUs that are given a map window. CPUs beyond this
+ * number fall back to the memory map pool for all of their maps.
+ */
+#ifndef MAX_MAP_WINDOW_CPUS
+#define MAX_MAP_WINDOW_CPUS (64ULL)
+#endif
+
+/*
+ * Map Window Start
+ *
+ * This defines the starting location of the virtual memory that is used
+ * for the per-CPU map windows. By default the windows are placed directly
+ * after the memory map pool.
+ *
+ * Note: defined in bytes (defaults to 10MB)
+ */
+#ifndef MAP_WINDOW_START
+#define MAP_WINDOW_START (MEM_MAP_POOL_START + MAX_MEM_MAP_POOL)
+#endif
+
+/*
+ * Soft TLB Entries
+ *
+ * Defines the number of entries in each CPU's software TLB, which caches
+ * the results of guest virtual to physical address translations. Note that
+ * the TLB is direct mapped, so this must be a power of 2.
+ */
+#ifndef SOFT_TLB_ENTRIES
+#define SOFT_TLB_ENTRIES (64ULL)
+#endif
+
+/*
+ * Max Soft TLB CPUs
+ *
+ * Defines the number of CPUs that are given a software TLB. CPUs beyond this
+ * number always walk the guest's page tables.
+ */
+#ifndef MAX_SOFT_TLB_CPUS
+#define MAX_SOFT_TLB_CPUS (64ULL)
+#endif
+
+/*
+ * TLB Shootdown Queue Size
+ *
+ * Defines the number of pending TLB invalidations (i.e. unmapped virtual
+ * address ranges) that are kept for remote CPUs. Each CPU drains the queue
+ * on its next VM exit. If a CPU falls behind by more than this number of
+ * invalidations, it flushes its entire TLB instead.
+ */
+#ifndef TLB_SHOOTDOWN_QUEUE_SIZE
+#define TLB_SHOOTDOWN_QUEUE_SIZE (64ULL)
+#endif
+
+/*
+ * TLB Shootdown Max Pages
+ *
+ * Defines the largest range (in pages) that is invalidated one page at a
+ * time when draining the TLB shootdown queue. Larger ranges flush the
+ * entire TLB instead.
+ */
+#ifndef TLB_SHOOTDOWN_MAX_PAGES
+#define TLB_SHOOTDOWN_MAX_PAGES (32ULL)
+#endif
+
+/*
+ * Max TLB Shootdown CPUs
+ *
+ * Defines the number of CPUs that track the TLB shootdown queue. Since CPUs
+ * beyond this number cannot track which invalidations they have seen, they
+ * flush their entire TLB on every VM exit once an unmap has been published.
+ */
+#ifndef MAX_TLB_SHOOTDOWN_CPUS
+#define MAX_TLB_SHOOTDOWN_CPUS (64ULL)
+#endif
+
+/*
+ * VMM PCID
+ *
+ * Defines the PCID that is reserved for the VMM's address space. If the CPU
+ * supports PCIDs, the host CR3 is tagged with this PCID so that the VMM's
+ * TLB entries are kept separate from the guest's, and can survive guest
+ * execution. Note that this only helps if VPID is also enabled, as
+ * otherwise each VM entry / exit flushes the TLB anyway. Set this to 0 to
+ * disable PCID support for the VMM.
+ */
+#ifndef VMM_PCID
+#define VMM_PCID (1ULL)
+#endif
+
 /*
  * Max Supported Modules
  *
@@ -183,16 +289,83 @@
 /*
  * Debug Ring Size
  *
- * Defines the size of the debug ring. Note that each vCPU gets one of these,
- * and thus the total amount of memory that is used can add up quickly. That
- * being said, make these as large as you can afford. Also note that these
- * will be allocated using the mem pool, so make sure that it is large enough
- * to hold the debug rings for each vCPU and then some.
+ * Defines the default size of the debug ring. The size of the debug rings
+ * can also be provided when the VMM is loaded (e.g. bfm load
+ * --debug-ring-size), in which case this value is not used. Note that each
+ * CPU gets one of these, and thus the total amount of memory that is used
+ * can add up quickly. That being said, make these as large as you can
+ * afford. Also note that these will be allocated using the page pool, so
+ * make sure that it is large enough to hold the debug rings for each CPU and
+ * then some.
  *
  * Note: defined in bytes
  */
 #define DEBUG_RING_SIZE (1 << DEBUG_RING_SHIFT)
 
+/*
+ * Debug Ring Min / Max Size
+ *
+ * Defines the range of debug ring sizes that can be provided when the VMM is
+ * loaded. The size of a debug ring must also be a power of 2.
+ *
+ * Note: defined in bytes
+ */
+#ifndef DEBUG_RING_MIN_SIZE
+#define DEBUG_RING_MIN_SIZE (0x2000ULL)
+#endif
+
+#ifndef DEBUG_RING_MAX_SIZE
+#define DEBUG_RING_MAX_SIZE (0x100000ULL)
+#endif
+
+/*
+ * Max Debug Ring CPUs
+ *
+ * Defines the number of CPUs that are given their own debug ring. Each of
+ * these rings is only written to by the CPU that owns it, which means that
+ * no locks are needed. CPUs beyond this number share a single debug ring
+ * that is protected by a lock.
+ */
+#ifndef MAX_DEBUG_RING_CPUS
+#define MAX_DEBUG_RING_CPUS (64ULL)
+#endif
+
+/*
+ * Trace Ring Size
+ *
+ * Defines the number of records in each CPU's trace ring. Once the ring is
+ * full, the oldest records are overwritten.
+ *
+ * Note: must be a power of 2
+ */
+#ifndef TRACE_RING_SIZE
+#define TRACE_RING_SIZE (512ULL)
+#endif
+
+/*
+ * Max Trace Ring CPUs
+ *
+ * Defines the number of CPUs that are given a trace ring. Trace events on
+ * CPUs beyond this number are dropped.
+ */
+#ifndef MAX_TRACE_RING_CPUS
+#define MAX_TRACE_RING_CPUS (64ULL)
+#endif
+
+/*
+ * Max VMM Status CPUs
+ *
+ * Defines the number of CPUs that have their own counters in the VMM's
+ * status page (see bfstatusinterface.h). Exits on CPUs beyond this number
+ * are not counted.
+ *
+ * Note: each counter takes up a cache line, and the counters must fit in
+ * VMM_STATUS_SIZE
+ */
+#ifndef MAX_VMM_STATUS_CPUS
+#define MAX_VMM_STATUS_CPUS (256ULL)
+#endif
+
 /*
  * Stack Size
  *
@@ -365,6 +538,20 @@
 #define DEFAULT_PARITY_BITS parity_none
 #endif
 
+/*
+ * Serial TX Ring Size
+ *
+ * Characters written to the serial port are queued in a ring of this size,
+ * and drained into the UART's FIFO on VM exits instead of waiting on the
+ * UART for each character. If the ring is full, the oldest characters are
+ * dropped.
+ *
+ * Note: Defined in bytes, and must be a power of 2
+ */
+#ifndef SERIAL_TX_RING_SIZE
+#define SERIAL_TX_RING_SIZE (0x4000ULL)
+#endif
+
 /*
  * Debug Level
  *
@@ -376,4 +563,50 @@
 #define DEBUG_LEVEL 0
 #endif
 
+/*
+ * Debug Subsystems
+ *
+ * Inside the VMM, DEBUG_LEVEL is only the initial debug level. Each of the
+ * following subsystems has its own debug level that can be changed at
+ * runtime using BF_REQUEST_SET_DEBUG_LEVEL (i.e. "bfm level"). A source file
+ * selects the subsystem that its debug statements belong to by redefining
+ * BFDEBUG_SUBSYSTEM after all of its #includes (headers always use
+ * BFDEBUG_SUBSYSTEM_DEFAULT, see bfdebug.h). BFDEBUG_SUBSYSTEM_ALL can be
+ * used to set the debug level of every subsystem at once.
+ */
+#define BFDEBUG_SUBSYSTEM_DEFAULT 0
+#define BFDEBUG_SUBSYSTEM_MEMORY_MANAGER 1
+#define BFDEBUG_SUBSYSTEM_VMCS 2
+#define BFDEBUG_SUBSYSTEM_EXIT_HANDLER 3
+#define BFDEBUG_SUBSYSTEM_VCPU 4
+#define BFDEBUG_SUBSYSTEM_NUM 5
+#define BFDEBUG_SUBSYSTEM_ALL 0xFFFF
+
+/*
+ * Debug Line Size
+ *
+ * Each line that is printed by the bfdebug_xxx macros is formatted in a
+ * buffer on the stack of this size, which means printing a line does not
+ * allocate memory. Lines that are larger than this are truncated.
+ *
+ * Note: Defined in bytes
+ */
+#ifndef DEBUG_LINE_SIZE
+#define DEBUG_LINE_SIZE (0x1000)
+#endif
+
+/*
+ * Debug Transaction Size
+ *
+ * The lines of a bfdebug_transaction are collected in a buffer on the stack
+ * of this size, so that they are written together. If a transaction does not
+ * fit, the lines that are already collected are written first, which means
+ * a large transaction is written in more than one piece.
+ *
+ * Note: Defined in bytes
+ */
+#ifndef DEBUG_TRANSACTION_SIZE
+#define DEBUG_TRANSACTION_SIZE (0x1000)
+#endif
+
 #endif
@@ -33,6 +33,9 @@
 #include <bfgsl.h>
 #include <bfstring.h>
 
+#include <array>
+#include <cstring>
+#include <algorithm>
 #include <type_traits>
 
 #ifdef _MSC_VER
@@ -70,10 +73,36 @@ using cstr_t = const char *;
 #ifdef VMM
 extern "C" uint64_t thread_context_cpuid(void);
 extern "C" uint64_t write_str(const std::string &str);
+extern "C" uint64_t write_buf(const char *str, uint64_t len);
 #else
 #include <iostream>
 #endif
 
+/*
+ * Inside the VMM, the debug level of each subsystem lives in a global table
+ * that can be changed at runtime (see BFDEBUG_SUBSYSTEM_NUM). The level of a
+ * debug statement is a constant, so a disabled statement is a load of the
+ * table entry and a single, predictable branch. Outside of the VMM, the debug
+ * level is DEBUG_LEVEL.
+ *
+ * Inline code in a header is compiled by every source file that includes it,
+ * and must be the same in each of them, so it always uses
+ * BFDEBUG_SUBSYSTEM_DEFAULT. A source file can only change BFDEBUG_SUBSYSTEM
+ * after all of its #includes.
+ */
+#ifdef BFDEBUG_SUBSYSTEM
+#error "BFDEBUG_SUBSYSTEM must be redefined after all #includes, not before"
+#endif
+
+#define BFDEBUG_SUBSYSTEM BFDEBUG_SUBSYSTEM_DEFAULT
+
+#ifdef VMM
+extern "C" int64_t g_bfdebug_levels[BFDEBUG_SUBSYSTEM_NUM];
+#define __BFDEBUG_LEVEL g_bfdebug_levels[BFDEBUG_SUBSYSTEM]
+#else
+#define __BFDEBUG_LEVEL DEBUG_LEVEL
+#endif
+
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable : 4312)
@@ -94,92 +123,225 @@ view_as_pointer(const T val)
 #pragma warning(pop)
 #endif
 
+/* ---------------------------------------------------------------------------*/
+/* Line (Private)                                                             */
+/* ---------------------------------------------------------------------------*/
+
+/*
+ * Each line is formatted in place, in a fixed sized buffer that lives on the
+ * stack, including the hex and decimal numbers. This ensures that printing a
+ * line does not allocate memory, which is important as these macros are used
+ * by the exit handlers. Lines that do not fit are truncated. The last byte
+ * of the buffer is reserved for the newline, so a truncated line is still
+ * terminated, and the next line does not run into it.
+ */
+class __bfdebug_line
+{
+public:
+
+    void append(cstr_t str, size_t len) noexcept
+    {
+        len = std::min(len, this->capacity() - m_len);
+
+        std::memcpy(m_buf.data() + m_len, str, len);
+        m_len += len;
+    }
+
+    void append(cstr_t str) noexcept
+    { this->append(str, strlen(str)); }
+
+    void append(char c, size_t num = 1) noexcept
+    {
+        num = std::min(num, this->capacity() - m_len);
+
+        std::memset(m_buf.data() + m_len, c, num);
+        m_len += num;
+    }
+
+    void append_hex(uint64_t val) noexcept
+    {
+        constexpr const auto digits = "0123456789ABCDEF";
+        std::array<char, 18> str = {{'0', 'x'}};
+
+        for (auto i = str.size() - 1; i > 1; i--, val >>= 4) {
+            str.at(i) = digits[val & 0xF];
+        }
+
+        this->append(str.data(), str.size());
+    }
+
+    void append_dec(uint64_t val) noexcept
+    {
+        std::array<char, 20> str = {};
+        auto i = str.size();
+
+        do {
+            str.at(--i) = static_cast<char>('0' + (val % 10));
+            val /= 10;
+        }
+        while (val != 0);
+
+        this->append(&str.at(i), str.size() - i);
+    }
+
+    void append_newline() noexcept
+    {
+        if (m_len < m_buf.size()) {
+            m_buf.at(m_len++) = '\n';
+        }
+    }
+
+    static size_t dec_len(uint64_t val) noexcept
+    {
+        size_t len = 1;
+
+        while (val >= 10) {
+            val /= 10;
+            len++;
+        }
+
+        return len;
+    }
+
+    cstr_t data() const noexcept
+    { return m_buf.data(); }
+
+    size_t size() const noexcept
+    { return m_len; }
+
+private:
+
+    size_t capacity() const noexcept
+    { return m_buf.size() - 1; }
+
+    size_t m_len{0};
+    std::array<char, DEBUG_LINE_SIZE> m_buf;
+};
+
+using __bfdebug_line_t = gsl::not_null<__bfdebug_line *>;
+
 /* ---------------------------------------------------------------------------*/
 /* Helpers (Private)                                                          */
 /* ---------------------------------------------------------------------------*/
 
 inline void
-__bfdebug_core(gsl::not_null<std::string *> msg)
+__bfdebug_write(cstr_t str, size_t len)
+{
+#ifdef VMM
+    write_buf(str, len);
+#else
+    std::cout.write(str, static_cast<std::streamsize>(len));
+#endif
+}
+
+inline void
+__bfdebug_core(__bfdebug_line_t msg)
 {
-    *msg += bfcolor_cyan;
-    *msg += "[";
-    *msg += bfcolor_yellow;
+    msg->append(bfcolor_cyan);
+    msg->append("[");
+    msg->append(bfcolor_yellow);
 #ifdef VMM
-    *msg += std::to_string(thread_context_cpuid());
+    msg->append_dec(thread_context_cpuid());
 #else
-    *msg += '0';
+    msg->append('0');
 #endif
-    *msg += bfcolor_cyan;
-    *msg += "] ";
-    *msg += bfcolor_end;
+    msg->append(bfcolor_cyan);
+    msg->append("] ");
+    msg->append(bfcolor_end);
 }
 
 inline void
-__bfdebug_type(gsl::not_null<std::string *> msg, cstr_t color, cstr_t type)
+__bfdebug_type(__bfdebug_line_t msg, cstr_t color, cstr_t type)
 {
-    *msg += color;
-    *msg += type;
-    *msg += bfcolor_end;
-    *msg += ": ";
+    msg->append(color);
+    msg->append(type);
+    msg->append(bfcolor_end);
+    msg->append(": ");
 }
 
 inline void
-__bfdebug_jtfy(gsl::not_null<std::string *> msg, uint64_t width, cstr_t title, cstr_t indent)
+__bfdebug_jtfy(__bfdebug_line_t msg, uint64_t width, cstr_t title, cstr_t indent)
 {
     if (title != nullptr) {
         auto len = width - strlen(title);
 
         if (indent != nullptr) {
             len -= strlen(indent);
-            *msg += indent;
+            msg->append(indent);
         }
 
-        *msg += title;
-        *msg += std::string(len, ' ');
+        msg->append(title);
+        msg->append(' ', len);
     }
     else {
-        *msg += std::string(width, ' ');
+        msg->append(' ', width);
     }
 }
 
+/*
+ * The lines of a transaction are collected in a fixed sized buffer that lives
+ * on the stack, so that a transaction does not allocate memory either. When
+ * the next line does not fit, the lines that are already collected are
+ * written, and the buffer is reused for the rest of the transaction.
+ */
+class bfdebug_msg_t
+{
+public:
+
+    void append(const __bfdebug_line &ln) noexcept
+    {
+        if (ln.size() > m_buf.size() - m_len) {
+            this->write();
+        }
+
+        if (ln.size() > m_buf.size()) {
+            __bfdebug_write(ln.data(), ln.size());
+            return;
+        }
+
+        std::memcpy(m_buf.data() + m_len, ln.data(), ln.size());
+        m_len += ln.size();
+    }
+
+    void write() noexcept
+    {
+        if (m_len != 0) {
+            __bfdebug_write(m_buf.data(), m_len);
+            m_len = 0;
+        }
+    }
+
+private:
+
+    size_t m_len{0};
+    std::array<char, DEBUG_TRANSACTION_SIZE> m_buf;
+};
+
 template<typename F>
 void __bfdebug_transaction(F func)
 {
-    std::string msg;
-    msg.reserve(0x1000);
+    bfdebug_msg_t msg;
     func(&msg);
 
-#ifdef VMM
-    write_str(msg);
-#else
-    std::cout << msg;
-#endif
+    msg.write();
 }
 
 template<typename F>
-void __bfdebug_add_line(std::string *msg, F func)
+void __bfdebug_add_line(bfdebug_msg_t *msg, F func)
 {
+    __bfdebug_line ln;
+    func(&ln);
+
     if (msg == nullptr) {
-        __bfdebug_transaction([&](std::string * tmsg) {
-            func(tmsg);
-        });
+        __bfdebug_write(ln.data(), ln.size());
     }
     else {
-        std::string ln;
-        ln.reserve(0x1000);
-
-        func(&ln);
-
-        if (msg->size() + ln.size() > msg->capacity()) {
-            msg->reserve(msg->capacity() + 0x1000);
-        }
-
-        *msg += ln;
+        msg->append(ln);
     }
 }
 
 #define bfdebug_transaction(level,func)                                        \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_transaction(func);                                           \
     }
 
@@ -216,38 +378,38 @@ void __bfdebug_add_line(std::string *msg, F func)
 /* ---------------------------------------------------------------------------*/
 
 inline void
-__bfdebug_info_core(cstr_t color, cstr_t type, cstr_t title, gsl::not_null<std::string *> msg)
+__bfdebug_info_core(cstr_t color, cstr_t type, cstr_t title, __bfdebug_line_t msg)
 {
     __bfdebug_core(msg);
     __bfdebug_type(msg, color, type);
 
     if (title != nullptr) {
-        *msg += std::string(title);
+        msg->append(title);
     }
 
-    *msg += '\n';
+    msg->append_newline();
 }
 
 inline void
-__bfdebug_info(cstr_t color, cstr_t type, cstr_t title, std::string *msg = nullptr)
+__bfdebug_info(cstr_t color, cstr_t type, cstr_t title, bfdebug_msg_t *msg = nullptr)
 {
-    __bfdebug_add_line(msg, [&](std::string * ln) {
+    __bfdebug_add_line(msg, [&](__bfdebug_line * ln) {
         __bfdebug_info_core(color, type, title, ln);
     });
 }
 
 #define bfdebug_info(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_info(bfcolor_debug, "DEBUG", __VA_ARGS__);                   \
     }
 
 #define bfalert_info(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_info(bfcolor_alert, "ALERT", __VA_ARGS__);                   \
     }
 
 #define bferror_info(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_info(bfcolor_error, "ERROR", __VA_ARGS__);                   \
     }
 
@@ -256,49 +418,49 @@ __bfdebug_info(cstr_t color, cstr_t type, cstr_t title, std::string *msg = nullp
 /* ---------------------------------------------------------------------------*/
 
 inline void
-__bfdebug_lnbr_core(cstr_t color, cstr_t type, gsl::not_null<std::string *> msg)
+__bfdebug_lnbr_core(cstr_t color, cstr_t type, __bfdebug_line_t msg)
 {
     __bfdebug_core(msg);
     __bfdebug_type(msg, color, type);
 
-    *msg += '\n';
+    msg->append_newline();
 }
 
 inline void
-__bfdebug_lnbr(cstr_t color, cstr_t type, std::string *msg = nullptr)
+__bfdebug_lnbr(cstr_t color, cstr_t type, bfdebug_msg_t *msg = nullptr)
 {
-    __bfdebug_add_line(msg, [&](std::string * ln) {
+    __bfdebug_add_line(msg, [&](__bfdebug_line * ln) {
         __bfdebug_lnbr_core(color, type, ln);
     });
 }
 
 #define bfdebug_lnbr1(level)                                                   \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_lnbr(bfcolor_debug, "DEBUG");                                \
     }
 
 #define bfalert_lnbr1(level)                                                   \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_lnbr(bfcolor_alert, "ALERT");                                \
     }
 
 #define bferror_lnbr1(level)                                                   \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_lnbr(bfcolor_error, "ERROR");                                \
     }
 
 #define bfdebug_lnbr2(level,msg)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_lnbr(bfcolor_debug, "DEBUG", msg);                           \
     }
 
 #define bfalert_lnbr2(level,msg)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_lnbr(bfcolor_alert, "ALERT", msg);                           \
     }
 
 #define bferror_lnbr2(level,msg)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_lnbr(bfcolor_error, "ERROR", msg);                           \
     }
 
@@ -311,50 +473,50 @@ __bfdebug_lnbr(cstr_t color, cstr_t type, std::string *msg = nullptr)
 /* ---------------------------------------------------------------------------*/
 
 inline void
-__bfdebug_brk1_core(cstr_t color, cstr_t type, gsl::not_null<std::string *> msg)
+__bfdebug_brk1_core(cstr_t color, cstr_t type, __bfdebug_line_t msg)
 {
     __bfdebug_core(msg);
     __bfdebug_type(msg, color, type);
 
-    *msg += "======================================================================";
-    *msg += '\n';
+    msg->append("======================================================================");
+    msg->append_newline();
 }
 
 inline void
-__bfdebug_brk1(cstr_t color, cstr_t type, std::string *msg = nullptr)
+__bfdebug_brk1(cstr_t color, cstr_t type, bfdebug_msg_t *msg = nullptr)
 {
-    __bfdebug_add_line(msg, [&](std::string * ln) {
+    __bfdebug_add_line(msg, [&](__bfdebug_line * ln) {
         __bfdebug_brk1_core(color, type, ln);
     });
 }
 
 #define bfdebug_brk11(level)                                                   \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_brk1(bfcolor_debug, "DEBUG");                                \
     }
 
 #define bfalert_brk11(level)                                                   \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_brk1(bfcolor_alert, "ALERT");                                \
     }
 
 #define bferror_brk11(level)                                                   \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_brk1(bfcolor_error, "ERROR");                                \
     }
 
 #define bfdebug_brk12(level,msg)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_brk1(bfcolor_debug, "DEBUG", msg);                           \
     }
 
 #define bfalert_brk12(level,msg)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_brk1(bfcolor_alert, "ALERT", msg);                           \
     }
 
 #define bferror_brk12(level,msg)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_brk1(bfcolor_error, "ERROR", msg);                           \
     }
 
@@ -367,50 +529,50 @@ __bfdebug_brk1(cstr_t color, cstr_t type, std::string *msg = nullptr)
 /* ---------------------------------------------------------------------------*/
 
 inline void
-__bfdebug_brk2_core(cstr_t color, cstr_t type, gsl::not_null<std::string *> msg)
+__bfdebug_brk2_core(cstr_t color, cstr_t type, __bfdebug_line_t msg)
 {
     __bfdebug_core(msg);
     __bfdebug_type(msg, color, type);
 
-    *msg += "----------------------------------------------------------------------";
-    *msg += '\n';
+    msg->append("----------------------------------------------------------------------");
+    msg->append_newline();
 }
 
 inline void
-__bfdebug_brk2(cstr_t color, cstr_t type, std::string *msg = nullptr)
+__bfdebug_brk2(cstr_t color, cstr_t type, bfdebug_msg_t *msg = nullptr)
 {
-    __bfdebug_add_line(msg, [&](std::string * ln) {
+    __bfdebug_add_line(msg, [&](__bfdebug_line * ln) {
         __bfdebug_brk2_core(color, type, ln);
     });
 }
 
 #define bfdebug_brk21(level)                                                   \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_brk2(bfcolor_debug, "DEBUG");                                \
     }
 
 #define bfalert_brk21(level)                                                   \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_brk2(bfcolor_alert, "ALERT");                                \
     }
 
 #define bferror_brk21(level)                                                   \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_brk2(bfcolor_error, "ERROR");                                \
     }
 
 #define bfdebug_brk22(level,msg)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_brk2(bfcolor_debug, "DEBUG", msg);                           \
     }
 
 #define bfalert_brk22(level,msg)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_brk2(bfcolor_alert, "ALERT", msg);                           \
     }
 
 #define bferror_brk22(level,msg)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_brk2(bfcolor_error, "ERROR", msg);                           \
     }
 
@@ -423,50 +585,50 @@ __bfdebug_brk2(cstr_t color, cstr_t type, std::string *msg = nullptr)
 /* ---------------------------------------------------------------------------*/
 
 inline void
-__bfdebug_brk3_core(cstr_t color, cstr_t type, gsl::not_null<std::string *> msg)
+__bfdebug_brk3_core(cstr_t color, cstr_t type, __bfdebug_line_t msg)
 {
     __bfdebug_core(msg);
     __bfdebug_type(msg, color, type);
 
-    *msg += "......................................................................";
-    *msg += '\n';
+    msg->append("......................................................................");
+    msg->append_newline();
 }
 
 inline void
-__bfdebug_brk3(cstr_t color, cstr_t type, std::string *msg = nullptr)
+__bfdebug_brk3(cstr_t color, cstr_t type, bfdebug_msg_t *msg = nullptr)
 {
-    __bfdebug_add_line(msg, [&](std::string * ln) {
+    __bfdebug_add_line(msg, [&](__bfdebug_line * ln) {
         __bfdebug_brk3_core(color, type, ln);
     });
 }
 
 #define bfdebug_brk31(level)                                                   \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_brk3(bfcolor_debug, "DEBUG");                                \
     }
 
 #define bfalert_brk31(level)                                                   \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_brk3(bfcolor_alert, "ALERT");                                \
     }
 
 #define bferror_brk31(level)                                                   \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_brk3(bfcolor_error, "ERROR");                                \
     }
 
 #define bfdebug_brk32(level,msg)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_brk3(bfcolor_debug, "DEBUG", msg);                           \
     }
 
 #define bfalert_brk32(level,msg)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_brk3(bfcolor_alert, "ALERT", msg);                           \
     }
 
 #define bferror_brk32(level,msg)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_brk3(bfcolor_error, "ERROR", msg);                           \
     }
 
@@ -480,57 +642,57 @@ __bfdebug_brk3(cstr_t color, cstr_t type, std::string *msg = nullptr)
 
 inline void
 __bfdebug_nhex_core(
-    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, uint64_t nhex, gsl::not_null<std::string *> msg)
+    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, uint64_t nhex, __bfdebug_line_t msg)
 {
     __bfdebug_core(msg);
     __bfdebug_type(msg, color, type);
     __bfdebug_jtfy(msg, 52, title, indent);
 
-    *msg += bfn::to_string(nhex, 16);
-    *msg += '\n';
+    msg->append_hex(nhex);
+    msg->append_newline();
 }
 
 inline void
 __bfdebug_nhex(
-    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, uint64_t nhex, std::string *msg = nullptr)
+    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, uint64_t nhex, bfdebug_msg_t *msg = nullptr)
 {
-    __bfdebug_add_line(msg, [&](std::string * ln) {
+    __bfdebug_add_line(msg, [&](__bfdebug_line * ln) {
         __bfdebug_nhex_core(color, type, indent, title, nhex, ln);
     });
 }
 
 inline void
 __bfdebug_nhex(
-    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, void *nhex, std::string *msg = nullptr)
+    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, void *nhex, bfdebug_msg_t *msg = nullptr)
 { __bfdebug_nhex(color, type, indent, title, reinterpret_cast<uint64_t>(nhex), msg); }
 
 #define bfdebug_nhex(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_nhex(bfcolor_debug, "DEBUG", nullptr, __VA_ARGS__);          \
     }
 
 #define bfalert_nhex(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_nhex(bfcolor_alert, "ALERT", nullptr, __VA_ARGS__);          \
     }
 
 #define bferror_nhex(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_nhex(bfcolor_error, "ERROR", nullptr, __VA_ARGS__);          \
     }
 
 #define bfdebug_subnhex(level, ...)                                            \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_nhex(bfcolor_debug, "DEBUG", "  - ", __VA_ARGS__);           \
     }
 
 #define bfalert_subnhex(level, ...)                                            \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_nhex(bfcolor_alert, "ALERT", "  - ", __VA_ARGS__);           \
     }
 
 #define bferror_subnhex(level, ...)                                            \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_nhex(bfcolor_error, "ERROR", "  - ", __VA_ARGS__);           \
     }
 
@@ -540,53 +702,52 @@ __bfdebug_nhex(
 
 inline void
 __bfdebug_ndec_core(
-    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, uint64_t ndec, gsl::not_null<std::string *> msg)
+    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, uint64_t ndec, __bfdebug_line_t msg)
 {
-    auto str = bfn::to_string(ndec, 10);
     __bfdebug_core(msg);
     __bfdebug_type(msg, color, type);
-    __bfdebug_jtfy(msg, 70 - str.length(), title, indent);
+    __bfdebug_jtfy(msg, 70 - __bfdebug_line::dec_len(ndec), title, indent);
 
-    *msg += str;
-    *msg += '\n';
+    msg->append_dec(ndec);
+    msg->append_newline();
 }
 
 inline void
 __bfdebug_ndec(
-    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, uint64_t ndec, std::string *msg = nullptr)
+    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, uint64_t ndec, bfdebug_msg_t *msg = nullptr)
 {
-    __bfdebug_add_line(msg, [&](std::string * ln) {
+    __bfdebug_add_line(msg, [&](__bfdebug_line * ln) {
         __bfdebug_ndec_core(color, type, indent, title, ndec, ln);
     });
 }
 
 #define bfdebug_ndec(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_ndec(bfcolor_debug, "DEBUG", nullptr, __VA_ARGS__);          \
     }
 
 #define bfalert_ndec(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_ndec(bfcolor_alert, "ALERT", nullptr, __VA_ARGS__);          \
     }
 
 #define bferror_ndec(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_ndec(bfcolor_error, "ERROR", nullptr, __VA_ARGS__);          \
     }
 
 #define bfdebug_subndec(level, ...)                                            \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_ndec(bfcolor_debug, "DEBUG", "  - ", __VA_ARGS__);           \
     }
 
 #define bfalert_subndec(level, ...)                                            \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_ndec(bfcolor_alert, "ALERT", "  - ", __VA_ARGS__);           \
     }
 
 #define bferror_subndec(level, ...)                                            \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_ndec(bfcolor_error, "ERROR", "  - ", __VA_ARGS__);           \
     }
 
@@ -596,53 +757,53 @@ __bfdebug_ndec(
 
 inline void
 __bfdebug_bool_core(
-    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, bool val, gsl::not_null<std::string *> msg)
+    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, bool val, __bfdebug_line_t msg)
 {
     auto str = val ? "true" : "false";
     __bfdebug_core(msg);
     __bfdebug_type(msg, color, type);
     __bfdebug_jtfy(msg, 70 - strlen(str), title, indent);
 
-    *msg += str;
-    *msg += '\n';
+    msg->append(str);
+    msg->append_newline();
 }
 
 inline void
 __bfdebug_bool(
-    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, bool val, std::string *msg = nullptr)
+    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, bool val, bfdebug_msg_t *msg = nullptr)
 {
-    __bfdebug_add_line(msg, [&](std::string * ln) {
+    __bfdebug_add_line(msg, [&](__bfdebug_line * ln) {
         __bfdebug_bool_core(color, type, indent, title, val, ln);
     });
 }
 
 #define bfdebug_bool(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_bool(bfcolor_debug, "DEBUG", nullptr, __VA_ARGS__);          \
     }
 
 #define bfalert_bool(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_bool(bfcolor_alert, "ALERT", nullptr, __VA_ARGS__);          \
     }
 
 #define bferror_bool(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_bool(bfcolor_error, "ERROR", nullptr, __VA_ARGS__);          \
     }
 
 #define bfdebug_subbool(level, ...)                                            \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_bool(bfcolor_debug, "DEBUG", "  - ", __VA_ARGS__);           \
     }
 
 #define bfalert_subbool(level, ...)                                            \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_bool(bfcolor_alert, "ALERT", "  - ", __VA_ARGS__);           \
     }
 
 #define bferror_subbool(level, ...)                                            \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_bool(bfcolor_error, "ERROR", "  - ", __VA_ARGS__);           \
     }
 
@@ -652,53 +813,53 @@ __bfdebug_bool(
 
 inline void
 __bfdebug_text_core(
-    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, cstr_t text, gsl::not_null<std::string *> msg)
+    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, cstr_t text, __bfdebug_line_t msg)
 {
-    auto str = text == nullptr ? std::string{} : std::string{text};
+    auto str = text == nullptr ? "" : text;
     __bfdebug_core(msg);
     __bfdebug_type(msg, color, type);
-    __bfdebug_jtfy(msg, 70 - str.length(), title, indent);
+    __bfdebug_jtfy(msg, 70 - strlen(str), title, indent);
 
-    *msg += str;
-    *msg += '\n';
+    msg->append(str);
+    msg->append_newline();
 }
 
 inline void
 __bfdebug_text(
-    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, cstr_t text, std::string *msg = nullptr)
+    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, cstr_t text, bfdebug_msg_t *msg = nullptr)
 {
-    __bfdebug_add_line(msg, [&](std::string * ln) {
+    __bfdebug_add_line(msg, [&](__bfdebug_line * ln) {
         __bfdebug_text_core(color, type, indent, title, text, ln);
     });
 }
 
 #define bfdebug_text(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_text(bfcolor_debug, "DEBUG", nullptr, __VA_ARGS__);          \
     }
 
 #define bfalert_text(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_text(bfcolor_alert, "ALERT", nullptr, __VA_ARGS__);          \
     }
 
 #define bferror_text(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_text(bfcolor_error, "ERROR", nullptr, __VA_ARGS__);          \
     }
 
 #define bfdebug_subtext(level, ...)                                            \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_text(bfcolor_debug, "DEBUG", "  - ", __VA_ARGS__);           \
     }
 
 #define bfalert_subtext(level, ...)                                            \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_text(bfcolor_alert, "ALERT", "  - ", __VA_ARGS__);           \
     }
 
 #define bferror_subtext(level, ...)                                            \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_text(bfcolor_error, "ERROR", "  - ", __VA_ARGS__);           \
     }
 
@@ -708,52 +869,52 @@ __bfdebug_text(
 
 inline void
 __bfdebug_pass_core(
-    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, gsl::not_null<std::string *> msg)
+    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, __bfdebug_line_t msg)
 {
     __bfdebug_core(msg);
     __bfdebug_type(msg, color, type);
     __bfdebug_jtfy(msg, 66, title, indent);
 
-    *msg += bfcolor_green "pass" bfcolor_end;
-    *msg += '\n';
+    msg->append(bfcolor_green "pass" bfcolor_end);
+    msg->append_newline();
 }
 
 inline void
 __bfdebug_pass(
-    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, std::string *msg = nullptr)
+    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, bfdebug_msg_t *msg = nullptr)
 {
-    __bfdebug_add_line(msg, [&](std::string * ln) {
+    __bfdebug_add_line(msg, [&](__bfdebug_line * ln) {
         __bfdebug_pass_core(color, type, indent, title, ln);
     });
 }
 
 #define bfdebug_pass(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_pass(bfcolor_debug, "DEBUG", nullptr, __VA_ARGS__);          \
     }
 
 #define bfalert_pass(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_pass(bfcolor_alert, "ALERT", nullptr, __VA_ARGS__);          \
     }
 
 #define bferror_pass(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_pass(bfcolor_error, "ERROR", nullptr, __VA_ARGS__);          \
     }
 
 #define bfdebug_subpass(level, ...)                                            \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_pass(bfcolor_debug, "DEBUG", "  - ", __VA_ARGS__);           \
     }
 
 #define bfalert_subpass(level, ...)                                            \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_pass(bfcolor_alert, "ALERT", "  - ", __VA_ARGS__);           \
     }
 
 #define bferror_subpass(level, ...)                                            \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_pass(bfcolor_error, "ERROR", "  - ", __VA_ARGS__);           \
     }
 
@@ -763,52 +924,52 @@ __bfdebug_pass(
 
 inline void
 __bfdebug_fail_core(
-    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, gsl::not_null<std::string *> msg)
+    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, __bfdebug_line_t msg)
 {
     __bfdebug_core(msg);
     __bfdebug_type(msg, color, type);
     __bfdebug_jtfy(msg, 66, title, indent);
 
-    *msg += bfcolor_red "fail  <----" bfcolor_end;
-    *msg += '\n';
+    msg->append(bfcolor_red "fail  <----" bfcolor_end);
+    msg->append_newline();
 }
 
 inline void
 __bfdebug_fail(
-    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, std::string *msg = nullptr)
+    cstr_t color, cstr_t type, cstr_t indent, cstr_t title, bfdebug_msg_t *msg = nullptr)
 {
-    __bfdebug_add_line(msg, [&](std::string * ln) {
+    __bfdebug_add_line(msg, [&](__bfdebug_line * ln) {
         __bfdebug_fail_core(color, type, indent, title, ln);
     });
 }
 
 #define bfdebug_fail(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_fail(bfcolor_debug, "DEBUG", nullptr, __VA_ARGS__);          \
     }
 
 #define bfalert_fail(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_fail(bfcolor_alert, "ALERT", nullptr, __VA_ARGS__);          \
     }
 
 #define bferror_fail(level, ...)                                               \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_fail(bfcolor_error, "ERROR", nullptr, __VA_ARGS__);          \
     }
 
 #define bfdebug_subfail(level, ...)                                            \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_fail(bfcolor_debug, "DEBUG", "  - ", __VA_ARGS__);           \
     }
 
 #define bfalert_subfail(level, ...)                                            \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_fail(bfcolor_alert, "ALERT", "  - ", __VA_ARGS__);           \
     }
 
 #define bferror_subfail(level, ...)                                            \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         __bfdebug_fail(bfcolor_error, "ERROR", "  - ", __VA_ARGS__);           \
     }
 
@@ -817,7 +978,7 @@ __bfdebug_fail(
 /* ---------------------------------------------------------------------------*/
 
 #define bfdebug_test3(level,title,val)                                         \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         if ((val)) {                                                           \
             bfdebug_pass(level,title);                                         \
         }                                                                      \
@@ -827,7 +988,7 @@ __bfdebug_fail(
     }
 
 #define bfdebug_subtest3(level,title,val)                                      \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         if ((val)) {                                                           \
             bfdebug_subpass(level,title);                                      \
         }                                                                      \
@@ -837,7 +998,7 @@ __bfdebug_fail(
     }
 
 #define bfalert_test3(level,title,val)                                         \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         if ((val)) {                                                           \
             bfalert_pass(level,title);                                         \
         }                                                                      \
@@ -847,7 +1008,7 @@ __bfdebug_fail(
     }
 
 #define bfalert_subtest3(level,title,val)                                      \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         if ((val)) {                                                           \
             bfalert_subpass(level,title);                                      \
         }                                                                      \
@@ -857,7 +1018,7 @@ __bfdebug_fail(
     }
 
 #define bferror_test3(level,title,val)                                         \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         if ((val)) {                                                           \
             bferror_pass(level,title);                                         \
         }                                                                      \
@@ -867,7 +1028,7 @@ __bfdebug_fail(
     }
 
 #define bferror_subtest3(level,title,val)                                      \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         if ((val)) {                                                           \
             bferror_subpass(level,title);                                      \
         }                                                                      \
@@ -877,7 +1038,7 @@ __bfdebug_fail(
     }
 
 #define bfdebug_test4(level,title,val,msg)                                     \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         if ((val)) {                                                           \
             bfdebug_pass(level,title,msg);                                     \
         }                                                                      \
@@ -887,7 +1048,7 @@ __bfdebug_fail(
     }
 
 #define bfdebug_subtest4(level,title,val,msg)                                  \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         if ((val)) {                                                           \
             bfdebug_subpass(level,title,msg);                                  \
         }                                                                      \
@@ -897,7 +1058,7 @@ __bfdebug_fail(
     }
 
 #define bfalert_test4(level,title,val,msg)                                     \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         if ((val)) {                                                           \
             bfalert_pass(level,title,msg);                                     \
         }                                                                      \
@@ -907,7 +1068,7 @@ __bfdebug_fail(
     }
 
 #define bfalert_subtest4(level,title,val,msg)                                  \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         if ((val)) {                                                           \
             bfalert_subpass(level,title,msg);                                  \
         }                                                                      \
@@ -917,7 +1078,7 @@ __bfdebug_fail(
     }
 
 #define bferror_test4(level,title,val,msg)                                     \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         if ((val)) {                                                           \
             bferror_pass(level,title,msg);                                     \
         }                                                                      \
@@ -927,7 +1088,7 @@ __bfdebug_fail(
     }
 
 #define bferror_subtest4(level,title,val,msg)                                  \
-    if (GSL_UNLIKELY(level <= DEBUG_LEVEL)) {                                  \
+    if (GSL_UNLIKELY(level <= __BFDEBUG_LEVEL)) {                              \
         if ((val)) {                                                           \
             bferror_subpass(level,title,msg);                                  \
         }                                                                      \
@@ -46,26 +46,80 @@ extern "C" {
  */
 typedef struct debug_ring_resources_t *(*get_drr_t)(uint64_t vcpuid);
 
+/**
+ * Debug Ring CPU ID
+ *
+ * Each physical CPU writes to its own debug ring. These rings are registered
+ * using the following id so that they can be retrieved using get_drr()
+ * without colliding with the ids of the vCPUs.
+ */
+#define DEBUG_RING_CPUID(cpuid) (0xFFFFFFFFFFFF0000ULL | (uint64_t)(cpuid))
+
+/**
+ * Debug Ring Channels
+ *
+ * stdout and stderr (channel 1) are written to the debug rings above, and to
+ * the serial port. The VMM can also write to the following file descriptors,
+ * each of which is a separate channel with its own per-CPU debug rings. These
+ * rings are registered using DEBUG_RING_CHANNEL() so that they can be
+ * drained by the user independently of the debug output (e.g. bfm dump
+ * --channel metrics). Note that channels are not written to the serial port.
+ */
+#define DEBUG_RING_CHANNEL_DEBUG 1
+#define DEBUG_RING_CHANNEL_METRICS 3
+#define DEBUG_RING_CHANNEL_TRACE 4
+
+#define DEBUG_RING_CHANNEL_FIRST DEBUG_RING_CHANNEL_METRICS
+#define DEBUG_RING_NUM_CHANNELS 2
+
+#define DEBUG_RING_CHANNEL(channel, cpuid) \
+    (0xFFFFFFFFFF000000ULL | ((uint64_t)(channel) << 16) | (uint64_t)(cpuid))
+
+/**
+ * Debug Ring Stamp
+ *
+ * Strings that are written to a per-CPU debug ring are prefixed with a stamp
+ * that contains the TSC at the time the string was written. This is what
+ * allows the per-CPU debug rings to be merged into a single log. The stamp
+ * is the marker, followed by the TSC as a 16 digit, lower case hex number.
+ * Note that the stamp does not contain a '\0' so that a stamped string can
+ * still be evicted as a single string. debug_ring_read() removes the stamps.
+ */
+#define DEBUG_RING_STAMP_MARKER '\x01'
+#define DEBUG_RING_STAMP_DIGITS 16
+#define DEBUG_RING_STAMP_SIZE (1 + DEBUG_RING_STAMP_DIGITS)
+
+/**
+ * Debug Ring Tags
+ *
+ * Used to identify a debug ring in memory (e.g. in a memory dump, or in a
+ * mapping of the debug ring's pages).
+ */
+#define DEBUG_RING_TAG1 0xDB60DB60DB60DB60ULL
+#define DEBUG_RING_TAG2 0x06BD06BD06BD06BDULL
+
 /**
  * @struct debug_ring_resources_t
  *
  * Debug Ring Resources
  *
- * Each driver entry needs to allocate some memory for the debug ring, and
- * then cast this structure over the allocated memory to access the bits used
- * by the ring.
+ * The debug ring resources are a header that is immediately followed by the
+ * circular buffer that stores the debug strings (see debug_ring_buf()). The
+ * size of the circular buffer is stored in the header (len), and must be a
+ * power of 2 so that a position in the buffer is simply pos & (len - 1).
+ * This allows the size of the debug ring to be chosen at runtime, while
+ * readers (e.g. bfm) only need the header to know how to read it.
  *
- * Prior to providing this structure to the debug ring, the memory should be
- * cleared, and the len of the buffer should be set to the total length of
- * memory allocated minus the size of debug_ring_resources_t.
+ * To allocate a debug ring, allocate debug_ring_total_size(len) bytes,
+ * clear the memory, and then set len.
  *
  * @code
  *
- *  int len = PAGE_SIZE * 100;
- *  struct debug_ring_resources_t *drr = valloc(len);
+ *  uint64_t len = DEBUG_RING_SIZE;
+ *  struct debug_ring_resources_t *drr = valloc(debug_ring_total_size(len));
  *
- *  memset(drr, 0, len);
- *  drr->len = len - sizeof(debug_ring_resources_t);
+ *  memset(drr, 0, debug_ring_total_size(len));
+ *  drr->len = len;
  *
  *  <give to vmm and do stuff>
  *
@@ -91,8 +145,8 @@ typedef struct debug_ring_resources_t *(*get_drr_t)(uint64_t vcpuid);
  *     the start position in the circular buffer
  * @var debug_ring_resources_t::tag1
  *     used to identify the debug ring from a memory dump
- * @var debug_ring_resources_t::buf
- *     the circular buffer that stores the debug strings.
+ * @var debug_ring_resources_t::len
+ *     the size of the circular buffer (a power of 2)
  * @var debug_ring_resources_t::tag2
  *     used to identify the debug ring from a memory dump
  */
@@ -101,16 +155,68 @@ struct debug_ring_resources_t {
     uint64_t spos;
 
     uint64_t tag1;
-    char buf[DEBUG_RING_SIZE];
+    uint64_t len;
     uint64_t tag2;
 };
 
+/**
+ * Debug Ring Size Valid
+ *
+ * @expects none
+ * @ensures none
+ *
+ * @param len the size of a debug ring's circular buffer
+ * @return 1 if len is a power of 2 between DEBUG_RING_MIN_SIZE and
+ *     DEBUG_RING_MAX_SIZE, 0 otherwise
+ */
+static inline int
+debug_ring_size_valid(uint64_t len)
+{
+    if (len < DEBUG_RING_MIN_SIZE || len > DEBUG_RING_MAX_SIZE) {
+        return 0;
+    }
+
+    return (len & (len - 1)) == 0 ? 1 : 0;
+}
+
+/**
+ * Debug Ring Total Size
+ *
+ * @expects none
+ * @ensures none
+ *
+ * @param len the size of a debug ring's circular buffer
+ * @return the number of bytes needed to store a debug ring's header, and its
+ *     circular buffer
+ */
+static inline uint64_t
+debug_ring_total_size(uint64_t len)
+{
+    return sizeof(struct debug_ring_resources_t) + len;
+}
+
+/**
+ * Debug Ring Buffer
+ *
+ * @expects drr != 0
+ * @ensures none
+ *
+ * @param drr the debug_ring_resource that was used to create the
+ *        debug ring
+ * @return a pointer to the circular buffer that follows the header
+ */
+static inline char *
+debug_ring_buf(const struct debug_ring_resources_t *drr)
+{
+    return (char *)drr + sizeof(struct debug_ring_resources_t);
+}
+
 /**
  * Debug Ring Read
  *
  * Reads strings that have been written to the debug ring. Although you can
  * provide any buffer size you want, it's advised to provide a buffer that
- * is the same size as the buffer that was originally allocated.
+ * is the same size as the debug ring's circular buffer (i.e. drr->len).
  *
  * @expects none
  * @ensures none
@@ -118,7 +224,7 @@ struct debug_ring_resources_t {
  * @param drr the debug_ring_resource that was used to create the
  *        debug ring
  * @param str the buffer to read the string into. should be the same size
- *        as drr in bytes
+ *        as drr->len in bytes
  * @param len the length of the str buffer in bytes
  * @return the number of bytes read from the debug ring, 0
  *        on error
@@ -128,29 +234,41 @@ debug_ring_read(struct debug_ring_resources_t *drr, char *str, uint64_t len)
 {
     uint64_t i;
     uint64_t spos;
+    uint64_t mask;
+    uint64_t skip;
     uint64_t count;
     uint64_t content;
+    const char *buf;
 
     if (drr == 0 || str == 0 || len == 0) {
         return 0;
     }
 
-    if (drr->spos > drr->epos) {
+    if (drr->spos > drr->epos || debug_ring_size_valid(drr->len) == 0) {
         return 0;
     }
 
-    spos = drr->spos % DEBUG_RING_SIZE;
+    buf = debug_ring_buf(drr);
+    mask = drr->len - 1;
+
+    spos = drr->spos & mask;
     content = drr->epos - drr->spos;
 
-    for (i = 0, count = 0; i < content && i < len - 1; i++) {
-        if (drr->buf[spos] != '\0') {
-            str[count++] = drr->buf[spos];
+    for (i = 0, skip = 0, count = 0; i < content && i < len - 1; i++) {
+        if (skip > 0) {
+            skip--;
+        }
+        else if (buf[spos] == DEBUG_RING_STAMP_MARKER) {
+            skip = DEBUG_RING_STAMP_DIGITS;
+        }
+        else if (buf[spos] != '\0') {
+            str[count++] = buf[spos];
         }
 
-        spos = ((spos + 1) % DEBUG_RING_SIZE);
+        spos = ((spos + 1) & mask);
     }
 
-    str[i] = '\0';
+    str[count] = '\0';
     return count;
 }
 
@@ -21,7 +21,10 @@
 #define BFDRIVERINTERFACE_H
 
 #include <bftypes.h>
+#include <bfsupport.h>
 #include <bfdebugringinterface.h>
+#include <bftraceringinterface.h>
+#include <bfstatusinterface.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -57,6 +60,22 @@ extern "C" {
 #define IOCTL_DUMP_VMM_CMD 0x807
 #define IOCTL_VMM_STATUS_CMD 0x808
 #define IOCTL_SET_VCPUID_CMD 0x80A
+#define IOCTL_DUMP_TRACE_CMD 0x80B
+#define IOCTL_SET_DEBUG_LEVEL_CMD 0x80C
+#define IOCTL_SET_DEBUG_RING_SIZE_CMD 0x80D
+#define IOCTL_GET_TSC_INFO_CMD 0x80E
+#define IOCTL_ADD_MODULES_CMD 0x80F
+
+/*
+ * Debug Level
+ *
+ * Provided to IOCTL_SET_DEBUG_LEVEL to change the debug level of one of the
+ * VMM's subsystems (BFDEBUG_SUBSYSTEM_xxx) at runtime.
+ */
+struct debug_level_t {
+    uint64_t subsystem;
+    int64_t level;
+};
 
 /* -------------------------------------------------------------------------- */
 /* Linux Interfaces                                                           */
@@ -64,6 +83,56 @@ extern "C" {
 
 #ifdef __linux__
 
+/*
+ * Debug Ring mmap
+ *
+ * The debug ring of the vcpuid that was last set using IOCTL_SET_VCPUID can
+ * be mapped read-only into user space by calling mmap() on the device with
+ * an offset of 0, and a length of up to DEBUG_RING_MMAP_SIZE(len), where len
+ * is the size of the debug ring's buffer. This allows the debug ring to be
+ * read without an ioctl, or a copy of the debug ring.
+ *
+ * The debug ring is page aligned, so the mapping starts with the debug
+ * ring's header, and only covers the pages that hold the debug ring. Since
+ * the size of the debug ring is stored in its header, a reader that does
+ * not know the size can first map DEBUG_RING_MMAP_SIZE(0) bytes (i.e. the
+ * first page), read len from the header, and then map the entire debug
+ * ring.
+ */
+#define DEBUG_RING_MMAP_PAGE_SIZE 0x1000ULL
+#define DEBUG_RING_MMAP_SIZE(len) \
+    ((sizeof(struct debug_ring_resources_t) + (len) + DEBUG_RING_MMAP_PAGE_SIZE - 1) & \
+     ~(DEBUG_RING_MMAP_PAGE_SIZE - 1))
+
+/*
+ * VMM Status mmap
+ *
+ * The driver's status page (see vmm_status_t) can be mapped read-only into
+ * user space by calling mmap() on the device with an offset of
+ * VMM_STATUS_MMAP_OFFSET, and a length of VMM_STATUS_SIZE. Unlike the debug
+ * ring, the status page can be mapped even if the VMM is not loaded.
+ */
+#define VMM_STATUS_MMAP_OFFSET 0x100000ULL
+
+/*
+ * Add Modules
+ *
+ * Provided to IOCTL_ADD_MODULES to add more than one module using a single
+ * ioctl. vec is the user space address of an array of num module_vec_t,
+ * each of which is the user space address and size of a module. This is
+ * the same as calling IOCTL_ADD_MODULE_LENGTH and IOCTL_ADD_MODULE for
+ * each module, in order.
+ */
+struct module_vec_t {
+    uint64_t addr;
+    uint64_t size;
+};
+
+struct add_modules_t {
+    uint64_t num;
+    uint64_t vec;
+};
+
 #define IOCTL_ADD_MODULE_LENGTH _IOW(BAREFLANK_MAJOR, IOCTL_ADD_MODULE_LENGTH_CMD, uint64_t *)
 #define IOCTL_ADD_MODULE _IOW(BAREFLANK_MAJOR, IOCTL_ADD_MODULE_CMD, char *)
 #define IOCTL_LOAD_VMM _IO(BAREFLANK_MAJOR, IOCTL_LOAD_VMM_CMD)
@@ -73,6 +142,11 @@ extern "C" {
 #define IOCTL_DUMP_VMM _IOR(BAREFLANK_MAJOR, IOCTL_DUMP_VMM_CMD, struct debug_ring_resources_t *)
 #define IOCTL_VMM_STATUS _IOR(BAREFLANK_MAJOR, IOCTL_VMM_STATUS_CMD, int64_t *)
 #define IOCTL_SET_VCPUID _IOW(BAREFLANK_MAJOR, IOCTL_SET_VCPUID_CMD, uint64_t *)
+#define IOCTL_DUMP_TRACE _IOR(BAREFLANK_MAJOR, IOCTL_DUMP_TRACE_CMD, struct trace_ring_resources_t *)
+#define IOCTL_SET_DEBUG_LEVEL _IOW(BAREFLANK_MAJOR, IOCTL_SET_DEBUG_LEVEL_CMD, struct debug_level_t *)
+#define IOCTL_SET_DEBUG_RING_SIZE _IOW(BAREFLANK_MAJOR, IOCTL_SET_DEBUG_RING_SIZE_CMD, uint64_t *)
+#define IOCTL_GET_TSC_INFO _IOR(BAREFLANK_MAJOR, IOCTL_GET_TSC_INFO_CMD, struct tsc_info_t *)
+#define IOCTL_ADD_MODULES _IOW(BAREFLANK_MAJOR, IOCTL_ADD_MODULES_CMD, struct add_modules_t *)
 
 #endif
 
@@ -106,6 +180,10 @@ DEFINE_GUID(
 #define IOCTL_DUMP_VMM CTL_CODE(BAREFLANK_DEVICETYPE, IOCTL_DUMP_VMM_CMD, METHOD_OUT_DIRECT, FILE_READ_DATA)
 #define IOCTL_VMM_STATUS CTL_CODE(BAREFLANK_DEVICETYPE, IOCTL_VMM_STATUS_CMD, METHOD_BUFFERED, FILE_READ_DATA)
 #define IOCTL_SET_VCPUID CTL_CODE(BAREFLANK_DEVICETYPE, IOCTL_SET_VCPUID_CMD, METHOD_IN_DIRECT, FILE_WRITE_DATA)
+#define IOCTL_DUMP_TRACE CTL_CODE(BAREFLANK_DEVICETYPE, IOCTL_DUMP_TRACE_CMD, METHOD_OUT_DIRECT, FILE_READ_DATA)
+#define IOCTL_SET_DEBUG_LEVEL CTL_CODE(BAREFLANK_DEVICETYPE, IOCTL_SET_DEBUG_LEVEL_CMD, METHOD_IN_DIRECT, FILE_WRITE_DATA)
+#define IOCTL_SET_DEBUG_RING_SIZE CTL_CODE(BAREFLANK_DEVICETYPE, IOCTL_SET_DEBUG_RING_SIZE_CMD, METHOD_IN_DIRECT, FILE_WRITE_DATA)
+#define IOCTL_GET_TSC_INFO CTL_CODE(BAREFLANK_DEVICETYPE, IOCTL_GET_TSC_INFO_CMD, METHOD_OUT_DIRECT, FILE_READ_DATA)
 
 #endif
 
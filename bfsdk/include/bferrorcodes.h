@@ -60,6 +60,20 @@
 #define GET_DRR_SUCCESS bfscast(int64_t, SUCCESS)
 #define GET_DRR_FAILURE bfscast(int64_t, 0x8000000000010000)
 
+/* -------------------------------------------------------------------------- */
+/* Trace Ring Error Codes                                                     */
+/* -------------------------------------------------------------------------- */
+
+#define GET_TRR_SUCCESS bfscast(int64_t, SUCCESS)
+#define GET_TRR_FAILURE bfscast(int64_t, 0x8000000000020000)
+
+/* -------------------------------------------------------------------------- */
+/* Debug Level Error Codes                                                    */
+/* -------------------------------------------------------------------------- */
+
+#define SET_DEBUG_LEVEL_SUCCESS bfscast(int64_t, SUCCESS)
+#define SET_DEBUG_LEVEL_FAILURE bfscast(int64_t, 0x8000000000030000)
+
 /* -------------------------------------------------------------------------- */
 /* ELF Loader Error Codes                                                     */
 /* -------------------------------------------------------------------------- */
@@ -139,6 +153,8 @@ ec_to_str(int64_t value)
         case CRT_FAILURE: return "CRT_FAILURE";
         case REGISTER_EH_FRAME_FAILURE: return "REGISTER_EH_FRAME_FAILURE";
         case GET_DRR_FAILURE: return "GET_DRR_FAILURE";
+        case GET_TRR_FAILURE: return "GET_TRR_FAILURE";
+        case SET_DEBUG_LEVEL_FAILURE: return "SET_DEBUG_LEVEL_FAILURE";
         case MEMORY_MANAGER_FAILURE: return "MEMORY_MANAGER_FAILURE";
         case BFELF_ERROR_INVALID_ARG: return "BFELF_ERROR_INVALID_ARG";
         case BFELF_ERROR_INVALID_FILE: return "BFELF_ERROR_INVALID_FILE";
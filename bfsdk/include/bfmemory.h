@@ -52,6 +52,11 @@ extern "C" {
  * descriptor associated with it. The VMM will use this information to create
  * its resources, as well as generate page tables as needed.
  *
+ * A memory descriptor that is given to the VMM using BF_REQUEST_ADD_MDL can
+ * also describe an extent (i.e. a block of memory that is physically
+ * contiguous), in which case the size of the extent in bytes is provided
+ * with the request. A size of 0 describes a single page.
+ *
  * @var memory_descriptor::phys
  *     the starting physical address of the block of memory
  * @var memory_descriptor::virt
@@ -142,6 +142,11 @@ void platform_stop(void);
 /**
  * Get Number of CPUs
  *
+ * On platforms that support CPU hotplug, this includes the CPUs that are
+ * not online yet, as the driver allocates its per-CPU resources once, when
+ * the VMM is loaded. In other words, every CPU number is less than the
+ * number that is returned.
+ *
  * @expects none
  * @ensures none
  *
@@ -149,6 +154,18 @@ void platform_stop(void);
  */
 int64_t platform_num_cpus(void);
 
+/**
+ * CPU Online
+ *
+ * @expects none
+ * @ensures none
+ *
+ * @param cpuid the CPU number to check
+ * @return returns 1 if the CPU is online (i.e. platform_call_on_each_cpu()
+ *     will execute on it), 0 otherwise
+ */
+int64_t platform_cpu_online(int64_t cpuid);
+
 /**
  * Set CPU affinity
  *
@@ -170,6 +187,32 @@ int64_t platform_set_affinity(int64_t affinity);
  */
 void platform_restore_affinity(int64_t affinity);
 
+/**
+ * Call On Each CPU Function
+ *
+ * The signature of a function executed by platform_call_on_each_cpu()
+ */
+typedef void (*platform_cpu_func_t)(void *arg);
+
+/**
+ * Call On Each CPU
+ *
+ * Executes func on each CPU, from the CPU itself, and returns once func has
+ * completed on every CPU. Unlike platform_set_affinity(), the calling thread
+ * is never migrated. func is executed with preemption (and on some systems,
+ * interrupts) disabled, and must not sleep. func is executed on every CPU
+ * at the same time.
+ *
+ * @expects func != 0
+ * @ensures none
+ *
+ * @param func the function to execute on each CPU
+ * @param arg the argument that is passed to func
+ * @return BF_SUCCESS if func was executed on every CPU, negative error code
+ *     on failure
+ */
+int64_t platform_call_on_each_cpu(platform_cpu_func_t func, void *arg);
+
 /**
  * Get CPU Number
  *
@@ -0,0 +1,244 @@
+/*
+ * Bareflank Hypervisor
+ * Copyright (C) 2015 Assured Information Security, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/**
+ * @file bfstatusinterface.h
+ */
+
+#ifndef BFSTATUSINTERFACE_H
+#define BFSTATUSINTERFACE_H
+
+#include <bftypes.h>
+#include <bfconstants.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#pragma pack(push, 1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * VMM Status Page
+ *
+ * The driver allocates a set of pages that describe the state of the VMM,
+ * which is given to the VMM when it is loaded (see platform_info_t), and
+ * can be mapped read-only into user space (see VMM_STATUS_MMAP_OFFSET).
+ * This allows the health of the VMM to be polled without an ioctl, and
+ * without calling into the VMM.
+ *
+ * The version must be checked before anything else in the page is used,
+ * and is incremented whenever the layout of vmm_status_t changes.
+ */
+#define VMM_STATUS_VERSION 2ULL
+#define VMM_STATUS_SIZE 0x5000ULL
+
+#define VMM_STATUS_TAG1 0x5747A705747A7057ULL
+#define VMM_STATUS_TAG2 0x7057A7457A745705ULL
+
+/**
+ * VMM Status Read Retries
+ *
+ * The number of times vmm_status_read() will retry a read that raced with
+ * a writer before giving up.
+ */
+#define VMM_STATUS_READ_RETRIES 100
+
+/* @cond */
+
+#if defined(_MSC_VER)
+#define vmm_status_barrier() _ReadWriteBarrier()
+#else
+#define vmm_status_barrier() __sync_synchronize()
+#endif
+
+/* @endcond */
+
+/**
+ * @struct vmm_status_exits_t
+ *
+ * VMM Status Exits
+ *
+ * The exit counter of a single CPU. Each counter is padded to its own cache
+ * line, so that CPUs counting their exits do not share a cache line.
+ *
+ * @var vmm_status_exits_t::count
+ *     the number of VM exits that were handled by the CPU
+ * @var vmm_status_exits_t::pad
+ *     pads the counter to MAX_CACHE_LINE_SIZE
+ */
+struct vmm_status_exits_t {
+    uint64_t count;
+    uint64_t pad[(MAX_CACHE_LINE_SIZE / sizeof(uint64_t)) - 1];
+};
+
+/**
+ * @struct vmm_status_t
+ *
+ * VMM Status
+ *
+ * The fields between seq and exits are protected by a sequence lock. A
+ * writer increments seq before and after it writes, so seq is odd while a
+ * write is in progress, and a reader that sees the same, even seq before
+ * and after it reads has a consistent copy (see vmm_status_read()). The
+ * driver is the only writer of these fields, and only writes to them while
+ * no other request is being made, so writers do not need a lock.
+ *
+ * Each CPU counts its own exits, so exits[] is written by the VMM without
+ * a lock, and is not protected by seq. Each counter only ever grows, and
+ * is read as a single, aligned 64bit value. The status page is page
+ * aligned, and the fields before exits[] fill exactly one cache line, so
+ * each counter starts on a cache line of its own.
+ *
+ * @var vmm_status_t::tag1
+ *     used to identify the status page (VMM_STATUS_TAG1)
+ * @var vmm_status_t::version
+ *     the version of this struct (VMM_STATUS_VERSION)
+ * @var vmm_status_t::seq
+ *     the sequence count (odd while a write is in progress)
+ * @var vmm_status_t::state
+ *     the state of the VMM (VMM_UNLOADED, VMM_LOADED, etc...)
+ * @var vmm_status_t::num_cpus
+ *     the number of CPUs the VMM was loaded on
+ * @var vmm_status_t::num_cpus_started
+ *     the number of CPUs the VMM is currently running on
+ * @var vmm_status_t::memory
+ *     the number of bytes of memory that were given to the VMM
+ * @var vmm_status_t::reserved
+ *     pads the fields above to MAX_CACHE_LINE_SIZE
+ * @var vmm_status_t::exits
+ *     the number of VM exits that were handled by each CPU
+ * @var vmm_status_t::tag2
+ *     used to identify the status page (VMM_STATUS_TAG2)
+ */
+struct vmm_status_t {
+    uint64_t tag1;
+    uint64_t version;
+    uint64_t seq;
+
+    int64_t state;
+    uint64_t num_cpus;
+    uint64_t num_cpus_started;
+    uint64_t memory;
+    uint64_t reserved;
+
+    struct vmm_status_exits_t exits[MAX_VMM_STATUS_CPUS];
+    uint64_t tag2;
+};
+
+/**
+ * VMM Status Write Begin
+ *
+ * Must be called before any of the fields that are protected by seq are
+ * written.
+ *
+ * @expects status != 0
+ * @ensures none
+ *
+ * @param status the status page to write to
+ */
+static inline void
+vmm_status_write_begin(struct vmm_status_t *status)
+{
+    *(volatile uint64_t *)&status->seq = status->seq + 1;
+    vmm_status_barrier();
+}
+
+/**
+ * VMM Status Write End
+ *
+ * Must be called once the fields that are protected by seq have been
+ * written.
+ *
+ * @expects status != 0
+ * @ensures none
+ *
+ * @param status the status page to write to
+ */
+static inline void
+vmm_status_write_end(struct vmm_status_t *status)
+{
+    vmm_status_barrier();
+    *(volatile uint64_t *)&status->seq = status->seq + 1;
+}
+
+/**
+ * VMM Status Read
+ *
+ * Copies the status page. If the copy races with a writer, the copy is
+ * retried (up to VMM_STATUS_READ_RETRIES times).
+ *
+ * @expects none
+ * @ensures none
+ *
+ * @param status the status page to read from
+ * @param copy the vmm_status_t to copy the status page into
+ * @return 1 on success, 0 if the status page is invalid, or if a
+ *     consistent copy could not be made
+ */
+static inline int
+vmm_status_read(const struct vmm_status_t *status, struct vmm_status_t *copy)
+{
+    int retry;
+    uint64_t i;
+    uint64_t seq;
+
+    const volatile uint64_t *src = (const volatile uint64_t *)status;
+    uint64_t *dst = (uint64_t *)copy;
+
+    if (status == 0 || copy == 0) {
+        return 0;
+    }
+
+    if (status->tag1 != VMM_STATUS_TAG1 || status->version != VMM_STATUS_VERSION) {
+        return 0;
+    }
+
+    for (retry = 0; retry < VMM_STATUS_READ_RETRIES; retry++) {
+        seq = *(const volatile uint64_t *)&status->seq;
+        vmm_status_barrier();
+
+        if ((seq & 1) != 0) {
+            continue;
+        }
+
+        for (i = 0; i < sizeof(struct vmm_status_t) / sizeof(uint64_t); i++) {
+            dst[i] = src[i];
+        }
+
+        vmm_status_barrier();
+
+        if (*(const volatile uint64_t *)&status->seq == seq) {
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma pack(pop)
+
+#endif
@@ -106,6 +106,29 @@ struct section_info_t {
     uint64_t debug_ranges_size;
 };
 
+/**
+ * @struct tsc_info_t
+ *
+ * Provides what is needed to convert a TSC value (e.g. the stamp of a debug
+ * ring string) into a wall-clock time. The TSC and the wall-clock time are
+ * read together by bfdriver when the VMM is loaded, which means that a TSC
+ * value can be converted using:
+ *
+ *      ns = wallclock + (tsc - tsc_info_t::tsc) * 1000000 / freq
+ *
+ * @var tsc_info_t::freq
+ *      the frequency of the TSC in kHz (0 if unknown)
+ * @var tsc_info_t::tsc
+ *      the TSC at the time the wall-clock time was read
+ * @var tsc_info_t::wallclock
+ *      the wall-clock time in ns since the Unix epoch (UTC)
+ */
+struct tsc_info_t {
+    uint64_t freq;
+    uint64_t tsc;
+    uint64_t wallclock;
+};
+
 /**
  * @struct platform_info_t
  *
@@ -114,10 +137,21 @@ struct section_info_t {
  *
  * @var platform_info_t::_dummy
  *      dummy member to avoid an empty struct on platforms not needing platform info
+ * @var platform_info_t::debug_ring_size
+ *      the size of each debug ring's buffer (0 == DEBUG_RING_SIZE)
+ * @var platform_info_t::tsc_info
+ *      the TSC frequency, and a wall-clock anchor (0 if unknown)
+ * @var platform_info_t::status
+ *      the address of the driver's status page (see vmm_status_t), 0 if
+ *      there is no status page
  */
 struct platform_info_t {
     int _dummy;
 
+    uint64_t debug_ring_size;
+    struct tsc_info_t tsc_info;
+    uintptr_t status;
+
 #if defined(BF_AARCH64)
     /// Address of serial peripheral within kernel space
     uintptr_t serial_address;
@@ -195,6 +229,10 @@ struct crt_info_t {
 #define BF_REQUEST_VMM_FINI 3
 #define BF_REQUEST_ADD_MDL 4
 #define BF_REQUEST_GET_DRR 5
+#define BF_REQUEST_GET_TRR 6
+#define BF_REQUEST_SET_DEBUG_LEVEL 7
+#define BF_REQUEST_VMM_PREPARE 8
+#define BF_REQUEST_VMM_SUSPEND 9
 #define BF_REQUEST_END 0xFFFF
 
 /* @endcond */
@@ -0,0 +1,162 @@
+/*
+ * Bareflank Hypervisor
+ * Copyright (C) 2015 Assured Information Security, Inc.
+ *
+ * This library is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this library; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+/**
+ * @file bftraceringinterface.h
+ */
+
+#ifndef BFTRACERINGINTERFACE_H
+#define BFTRACERINGINTERFACE_H
+
+#include <bftypes.h>
+#include <bfconstants.h>
+#include <bferrorcodes.h>
+
+#pragma pack(push, 1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Trace Events
+ *
+ * The following defines the trace events that are generated by the VMM.
+ * Extensions are free to define their own events, starting at
+ * TRACE_EVENT_USER. The arguments of each event are as follows:
+ *
+ * - exit: exit reason, guest rip
+ * - rdmsr: msr, value
+ * - wrmsr: msr, value
+ * - map: virtual address, physical address, size in bytes
+ * - map_cr3: virtual address, guest virtual address, guest cr3, size in bytes
+ * - unmap: virtual address, size in bytes
+ *
+ * @cond
+ */
+
+#define TRACE_EVENT_EXIT 0x1
+#define TRACE_EVENT_RDMSR 0x2
+#define TRACE_EVENT_WRMSR 0x3
+#define TRACE_EVENT_MAP 0x4
+#define TRACE_EVENT_UNMAP 0x5
+#define TRACE_EVENT_MAP_CR3 0x6
+#define TRACE_EVENT_USER 0x1000
+
+/* @endcond */
+
+/**
+ * @struct trace_record_t
+ *
+ * Trace Record
+ *
+ * A single, fixed sized record in the trace ring. Unlike the debug ring,
+ * nothing is formatted by the VMM. It is up to the reader (i.e. bfm) to turn
+ * a record into something that is human readable.
+ *
+ * @var trace_record_t::id
+ *     the id of the event (i.e. TRACE_EVENT_xxx)
+ * @var trace_record_t::tsc
+ *     the TSC at the time the event was recorded
+ * @var trace_record_t::vcpuid
+ *     the id of the vCPU that was executing when the event was recorded
+ * @var trace_record_t::args
+ *     event specific arguments
+ */
+struct trace_record_t {
+    uint64_t id;
+    uint64_t tsc;
+    uint64_t vcpuid;
+    uint64_t args[4];
+};
+
+/**
+ * @struct trace_ring_resources_t
+ *
+ * Trace Ring Resources
+ *
+ * Each CPU owns one trace ring, and is the only writer of that ring, so no
+ * locks are needed. Records are written at epos % TRACE_RING_SIZE, and
+ * epos is only incremented once the record is complete. The ring never
+ * waits for the reader, so once the ring is full, the oldest record is
+ * overwritten.
+ *
+ * @var trace_ring_resources_t::epos
+ *     the total number of records that have been written to the ring
+ * @var trace_ring_resources_t::tag1
+ *     used to identify the trace ring from a memory dump
+ * @var trace_ring_resources_t::buf
+ *     the circular buffer that stores the records
+ * @var trace_ring_resources_t::tag2
+ *     used to identify the trace ring from a memory dump
+ */
+struct trace_ring_resources_t {
+    uint64_t epos;
+
+    uint64_t tag1;
+    struct trace_record_t buf[TRACE_RING_SIZE];
+    uint64_t tag2;
+};
+
+/**
+ * Trace Ring Read
+ *
+ * Reads the most recent records from the trace ring, oldest first.
+ *
+ * @expects none
+ * @ensures none
+ *
+ * @param trr the trace_ring_resource to read from
+ * @param records the buffer to read the records into
+ * @param num the number of records that will fit in records
+ * @return the number of records read, 0 on error
+ */
+static inline uint64_t
+trace_ring_read(
+    const struct trace_ring_resources_t *trr, struct trace_record_t *records, uint64_t num)
+{
+    uint64_t i;
+    uint64_t epos;
+    uint64_t count;
+
+    if (trr == 0 || records == 0 || num == 0) {
+        return 0;
+    }
+
+    epos = trr->epos;
+    count = epos < TRACE_RING_SIZE ? epos : TRACE_RING_SIZE;
+
+    if (count > num) {
+        count = num;
+    }
+
+    for (i = 0; i < count; i++) {
+        records[i] = trr->buf[(epos - count + i) & (TRACE_RING_SIZE - 1)];
+    }
+
+    return count;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#pragma pack(pop)
+
+#endif
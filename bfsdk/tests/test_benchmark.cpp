@@ -26,6 +26,13 @@ TEST_CASE("benchmark")
     }) != 0);
 }
 
+TEST_CASE("benchmark cycles")
+{
+    CHECK(benchmark_cycles([] {
+        std::cout << "the answer is 42\n";
+    }) != 0);
+}
+
 TEST_CASE("non-array new/delete")
 {
     std::make_unique<char>();
@@ -50,3 +57,24 @@ TEST_CASE("memory stats")
     print_memory_stats();
     clear_memory_stats();
 }
+
+TEST_CASE("debug line does not allocate")
+{
+    bfdebug_nhex(0, "warm up", 42);
+
+    clear_memory_stats();
+
+    auto cycles = benchmark_cycles([] {
+        bfdebug_nhex(0, "test", 42);
+        bfdebug_ndec(0, "test", 42);
+        bfdebug_text(0, "test", "value");
+    });
+
+    auto page_allocs = g_page_allocs;
+    auto nonpage_allocs = g_nonpage_allocs;
+
+    CHECK(page_allocs == 0);
+    CHECK(nonpage_allocs == 0);
+
+    bfdebug_ndec(0, "cycles for 3 lines", cycles);
+}
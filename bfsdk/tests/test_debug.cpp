@@ -237,7 +237,7 @@ TEST_CASE("transaction")
 {
     int i = 0;
 
-    bfdebug_transaction(0, [&](std::string * msg) {
+    bfdebug_transaction(0, [&](bfdebug_msg_t * msg) {
         bfdebug_lnbr(0, msg);
         bfdebug_brk1(0, msg);
         bfdebug_brk2(0, msg);
@@ -270,6 +270,82 @@ TEST_CASE("transaction")
     });
 }
 
+TEST_CASE("debug output")
+{
+    std::stringstream ss;
+    auto rdbuf = std::cout.rdbuf(ss.rdbuf());
+
+    bfdebug_nhex(0, "test", 42);
+    bfdebug_subndec(0, "test", 42);
+    bfdebug_subbool(0, nullptr, true);
+
+    std::cout.rdbuf(rdbuf);
+
+    std::string prefix =
+        bfcolor_cyan "[" bfcolor_yellow "0" bfcolor_cyan "] " bfcolor_end
+        bfcolor_debug "DEBUG" bfcolor_end ": ";
+
+    CHECK(ss.str() ==
+          prefix + "test" + std::string(48, ' ') + "0x000000000000002A\n" +
+          prefix + "  - test" + std::string(60, ' ') + "42\n" +
+          prefix + std::string(66, ' ') + "true\n");
+}
+
+TEST_CASE("debug output truncated")
+{
+    std::stringstream ss;
+    auto rdbuf = std::cout.rdbuf(ss.rdbuf());
+
+    bfdebug_info(0, std::string(DEBUG_LINE_SIZE * 2, 'x').c_str());
+
+    std::cout.rdbuf(rdbuf);
+    CHECK(ss.str().length() == DEBUG_LINE_SIZE);
+    CHECK(ss.str().back() == '\n');
+}
+
+TEST_CASE("debug output truncated transaction")
+{
+    std::stringstream ss;
+    auto rdbuf = std::cout.rdbuf(ss.rdbuf());
+
+    bfdebug_transaction(0, [&](bfdebug_msg_t * msg) {
+        bfdebug_info(0, std::string(DEBUG_LINE_SIZE * 2, 'x').c_str(), msg);
+        bfdebug_info(0, "test", msg);
+    });
+
+    std::cout.rdbuf(rdbuf);
+
+    auto str = ss.str();
+    REQUIRE(str.length() > DEBUG_LINE_SIZE);
+    CHECK(str.at(DEBUG_LINE_SIZE - 1) == '\n');
+    CHECK(str.back() == '\n');
+}
+
+TEST_CASE("debug output large transaction")
+{
+    std::stringstream ss;
+    auto rdbuf = std::cout.rdbuf(ss.rdbuf());
+
+    bfdebug_transaction(0, [&](bfdebug_msg_t * msg) {
+        for (auto i = 0; i < DEBUG_TRANSACTION_SIZE; i++) {
+            bfdebug_info(0, "the cow is blue", msg);
+        }
+    });
+
+    std::cout.rdbuf(rdbuf);
+
+    std::string line =
+        bfcolor_cyan "[" bfcolor_yellow "0" bfcolor_cyan "] " bfcolor_end
+        bfcolor_debug "DEBUG" bfcolor_end ": the cow is blue\n";
+
+    auto str = ss.str();
+    REQUIRE(str.length() == line.length() * DEBUG_TRANSACTION_SIZE);
+
+    for (size_t i = 0; i < str.length(); i += line.length()) {
+        CHECK(str.compare(i, line.length(), line) == 0);
+    }
+}
+
 TEST_CASE("debug facilities")
 {
     bfline;
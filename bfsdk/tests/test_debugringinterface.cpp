@@ -20,7 +20,38 @@
 #include <bfdebugringinterface.h>
 
 char g_buf[DEBUG_RING_SIZE] = {};
-debug_ring_resources_t g_drr{};
+
+struct test_drr_t {
+    debug_ring_resources_t hdr;
+    char buf[DEBUG_RING_SIZE];
+};
+
+test_drr_t g_test_drr{{0, 0, DEBUG_RING_TAG1, DEBUG_RING_SIZE, DEBUG_RING_TAG2}, {}};
+debug_ring_resources_t &g_drr = g_test_drr.hdr;
+
+TEST_CASE("debug_ring_buf")
+{
+    CHECK(debug_ring_buf(&g_drr) == static_cast<char *>(g_test_drr.buf));
+    CHECK(debug_ring_total_size(DEBUG_RING_SIZE) == sizeof(test_drr_t));
+}
+
+TEST_CASE("debug_ring_size_valid")
+{
+    CHECK(debug_ring_size_valid(DEBUG_RING_SIZE) == 1);
+    CHECK(debug_ring_size_valid(DEBUG_RING_MIN_SIZE) == 1);
+    CHECK(debug_ring_size_valid(DEBUG_RING_MAX_SIZE) == 1);
+    CHECK(debug_ring_size_valid(0) == 0);
+    CHECK(debug_ring_size_valid(DEBUG_RING_MIN_SIZE >> 1) == 0);
+    CHECK(debug_ring_size_valid(DEBUG_RING_MAX_SIZE << 1) == 0);
+    CHECK(debug_ring_size_valid(DEBUG_RING_SIZE + 1) == 0);
+}
+
+TEST_CASE("debug_ring_channel")
+{
+    CHECK(DEBUG_RING_CHANNEL(DEBUG_RING_CHANNEL_METRICS, 1) != DEBUG_RING_CPUID(1));
+    CHECK(DEBUG_RING_CHANNEL(DEBUG_RING_CHANNEL_METRICS, 1) != DEBUG_RING_CHANNEL(DEBUG_RING_CHANNEL_TRACE, 1));
+    CHECK(DEBUG_RING_CHANNEL(DEBUG_RING_CHANNEL_TRACE, MAX_DEBUG_RING_CPUS - 1) != DEBUG_RING_CPUID(MAX_DEBUG_RING_CPUS - 1));
+}
 
 TEST_CASE("debug_ring_read: invalid drr")
 {
@@ -37,6 +68,15 @@ TEST_CASE("debug_ring_read: invalid len")
     CHECK(debug_ring_read(&g_drr, static_cast<char *>(g_buf), 0) == 0);
 }
 
+TEST_CASE("debug_ring_read: invalid ring len")
+{
+    g_drr.spos = 0;
+    g_drr.epos = 42;
+    g_drr.len = DEBUG_RING_SIZE + 1;
+    CHECK(debug_ring_read(&g_drr, static_cast<char *>(g_buf), DEBUG_RING_SIZE) == 0);
+    g_drr.len = DEBUG_RING_SIZE;
+}
+
 TEST_CASE("debug_ring_read: invalid spos / epos")
 {
     g_drr.spos = 42;
@@ -63,7 +103,7 @@ TEST_CASE("debug_ring_read: all 0")
     g_drr.spos = DEBUG_RING_SIZE - 42;
     g_drr.epos = DEBUG_RING_SIZE + 42;
 
-    auto view = gsl::make_span(g_drr.buf);
+    auto view = gsl::make_span(g_test_drr.buf);
     for (auto &elem : view) {
         elem = 0;
     }
@@ -76,7 +116,7 @@ TEST_CASE("debug_ring_read: wrap")
     g_drr.spos = DEBUG_RING_SIZE - 42;
     g_drr.epos = DEBUG_RING_SIZE + 42;
 
-    auto view = gsl::make_span(g_drr.buf);
+    auto view = gsl::make_span(g_test_drr.buf);
     for (auto &elem : view) {
         elem = 'A';
     }
@@ -89,7 +129,7 @@ TEST_CASE("debug_ring_read: full")
     g_drr.spos = 0;
     g_drr.epos = DEBUG_RING_SIZE;
 
-    auto view = gsl::make_span(g_drr.buf);
+    auto view = gsl::make_span(g_test_drr.buf);
     for (auto &elem : view) {
         elem = 'A';
     }
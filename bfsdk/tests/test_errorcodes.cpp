@@ -32,6 +32,8 @@ TEST_CASE("ec_to_str: known")
     CHECK(ec_to_str(CRT_FAILURE) == "CRT_FAILURE"_s);
     CHECK(ec_to_str(REGISTER_EH_FRAME_FAILURE) == "REGISTER_EH_FRAME_FAILURE"_s);
     CHECK(ec_to_str(GET_DRR_FAILURE) == "GET_DRR_FAILURE"_s);
+    CHECK(ec_to_str(GET_TRR_FAILURE) == "GET_TRR_FAILURE"_s);
+    CHECK(ec_to_str(SET_DEBUG_LEVEL_FAILURE) == "SET_DEBUG_LEVEL_FAILURE"_s);
     CHECK(ec_to_str(MEMORY_MANAGER_FAILURE) == "MEMORY_MANAGER_FAILURE"_s);
     CHECK(ec_to_str(BFELF_ERROR_INVALID_ARG) == "BFELF_ERROR_INVALID_ARG"_s);
     CHECK(ec_to_str(BFELF_ERROR_INVALID_FILE) == "BFELF_ERROR_INVALID_FILE"_s);
@@ -0,0 +1,103 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include <catch/catch.hpp>
+#include <bfstatusinterface.h>
+
+#include <cstddef>
+
+vmm_status_t g_status{};
+vmm_status_t g_copy{};
+
+static void
+setup_status()
+{
+    g_status = {};
+    g_status.tag1 = VMM_STATUS_TAG1;
+    g_status.version = VMM_STATUS_VERSION;
+    g_status.tag2 = VMM_STATUS_TAG2;
+}
+
+TEST_CASE("vmm_status_t: fits in the status page")
+{
+    CHECK(sizeof(vmm_status_t) <= VMM_STATUS_SIZE);
+}
+
+TEST_CASE("vmm_status_t: exits are cache line aligned")
+{
+    CHECK(sizeof(vmm_status_exits_t) == MAX_CACHE_LINE_SIZE);
+    CHECK(offsetof(vmm_status_t, exits) % MAX_CACHE_LINE_SIZE == 0);
+}
+
+TEST_CASE("vmm_status_read: invalid status")
+{
+    CHECK(vmm_status_read(nullptr, &g_copy) == 0);
+}
+
+TEST_CASE("vmm_status_read: invalid copy")
+{
+    setup_status();
+    CHECK(vmm_status_read(&g_status, nullptr) == 0);
+}
+
+TEST_CASE("vmm_status_read: invalid tag")
+{
+    setup_status();
+    g_status.tag1 = 0;
+
+    CHECK(vmm_status_read(&g_status, &g_copy) == 0);
+}
+
+TEST_CASE("vmm_status_read: invalid version")
+{
+    setup_status();
+    g_status.version = VMM_STATUS_VERSION + 1;
+
+    CHECK(vmm_status_read(&g_status, &g_copy) == 0);
+}
+
+TEST_CASE("vmm_status_read: write in progress")
+{
+    setup_status();
+    vmm_status_write_begin(&g_status);
+
+    CHECK(vmm_status_read(&g_status, &g_copy) == 0);
+}
+
+TEST_CASE("vmm_status_read: success")
+{
+    setup_status();
+
+    vmm_status_write_begin(&g_status);
+    g_status.state = 12;
+    g_status.num_cpus = 4;
+    g_status.num_cpus_started = 3;
+    g_status.memory = 0x1000;
+    vmm_status_write_end(&g_status);
+
+    g_status.exits[1].count = 42;
+
+    CHECK(vmm_status_read(&g_status, &g_copy) == 1);
+    CHECK(g_copy.seq == 2);
+    CHECK(g_copy.state == 12);
+    CHECK(g_copy.num_cpus == 4);
+    CHECK(g_copy.num_cpus_started == 3);
+    CHECK(g_copy.memory == 0x1000);
+    CHECK(g_copy.exits[1].count == 42);
+    CHECK(g_copy.tag2 == VMM_STATUS_TAG2);
+}
@@ -0,0 +1,87 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include <catch/catch.hpp>
+#include <bftraceringinterface.h>
+
+trace_record_t g_records[TRACE_RING_SIZE] = {};
+trace_ring_resources_t g_trr{};
+
+static void
+write_records(uint64_t num)
+{
+    for (auto i = 0ULL; i < num; i++) {
+        auto &record = g_trr.buf[g_trr.epos & (TRACE_RING_SIZE - 1)];
+
+        record.id = TRACE_EVENT_USER;
+        record.tsc = g_trr.epos;
+
+        g_trr.epos++;
+    }
+}
+
+TEST_CASE("trace_ring_read: invalid trr")
+{
+    CHECK(trace_ring_read(nullptr, static_cast<trace_record_t *>(g_records), TRACE_RING_SIZE) == 0);
+}
+
+TEST_CASE("trace_ring_read: invalid records")
+{
+    CHECK(trace_ring_read(&g_trr, nullptr, TRACE_RING_SIZE) == 0);
+}
+
+TEST_CASE("trace_ring_read: invalid num")
+{
+    CHECK(trace_ring_read(&g_trr, static_cast<trace_record_t *>(g_records), 0) == 0);
+}
+
+TEST_CASE("trace_ring_read: no data")
+{
+    g_trr.epos = 0;
+    CHECK(trace_ring_read(&g_trr, static_cast<trace_record_t *>(g_records), TRACE_RING_SIZE) == 0);
+}
+
+TEST_CASE("trace_ring_read: some data")
+{
+    g_trr.epos = 0;
+    write_records(10);
+
+    CHECK(trace_ring_read(&g_trr, static_cast<trace_record_t *>(g_records), TRACE_RING_SIZE) == 10);
+    CHECK(g_records[0].tsc == 0);
+    CHECK(g_records[9].tsc == 9);
+}
+
+TEST_CASE("trace_ring_read: small read buffer")
+{
+    g_trr.epos = 0;
+    write_records(10);
+
+    CHECK(trace_ring_read(&g_trr, static_cast<trace_record_t *>(g_records), 2) == 2);
+    CHECK(g_records[0].tsc == 8);
+    CHECK(g_records[1].tsc == 9);
+}
+
+TEST_CASE("trace_ring_read: wrapped")
+{
+    g_trr.epos = 0;
+    write_records(TRACE_RING_SIZE + 10);
+
+    CHECK(trace_ring_read(&g_trr, static_cast<trace_record_t *>(g_records), TRACE_RING_SIZE) == TRACE_RING_SIZE);
+    CHECK(g_records[0].tsc == 10);
+    CHECK(g_records[TRACE_RING_SIZE - 1].tsc == TRACE_RING_SIZE + 9);
+}
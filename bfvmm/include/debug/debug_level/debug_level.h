@@ -0,0 +1,71 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#ifndef DEBUG_LEVEL_H
+#define DEBUG_LEVEL_H
+
+#include <bftypes.h>
+#include <bfconstants.h>
+#include <bferrorcodes.h>
+
+// -----------------------------------------------------------------------------
+// Exports
+// -----------------------------------------------------------------------------
+
+#include <bfexports.h>
+
+#ifndef STATIC_DEBUG
+#ifdef SHARED_DEBUG
+#define EXPORT_DEBUG EXPORT_SYM
+#else
+#define EXPORT_DEBUG IMPORT_SYM
+#endif
+#else
+#define EXPORT_DEBUG
+#endif
+
+// -----------------------------------------------------------------------------
+// Definitions
+// -----------------------------------------------------------------------------
+
+/// Debug Levels
+///
+/// The runtime debug level of each subsystem, indexed by BFDEBUG_SUBSYSTEM_xxx.
+/// The bfdebug_xxx macros read this table directly (inside the VMM), so it
+/// should only be changed using set_debug_level().
+///
+extern "C" EXPORT_DEBUG int64_t g_bfdebug_levels[BFDEBUG_SUBSYSTEM_NUM];
+
+/// Set Debug Level
+///
+/// Sets the debug level of a subsystem. Debug statements whose level is
+/// higher than the debug level of their subsystem are not printed.
+///
+/// @expects subsystem < BFDEBUG_SUBSYSTEM_NUM || subsystem == BFDEBUG_SUBSYSTEM_ALL
+/// @ensures none
+///
+/// @param subsystem the subsystem to change (BFDEBUG_SUBSYSTEM_xxx)
+/// @param level the new debug level of the subsystem
+/// @return SET_DEBUG_LEVEL_SUCCESS on success, SET_DEBUG_LEVEL_FAILURE if the
+///     subsystem is invalid
+///
+extern "C" EXPORT_DEBUG int64_t set_debug_level(
+    uint64_t subsystem, int64_t level) noexcept;
+
+#endif
@@ -61,6 +61,11 @@ namespace bfvmm
 /// the same buffer can read from the debug ring to extract the strings
 /// that are written to the buffer.
 ///
+/// The size of the debug ring's buffer is provided when the debug ring is
+/// created, and is stored in the debug ring's header so that the reader
+/// knows how large the buffer is. The debug ring (header and buffer) is
+/// allocated as whole pages, which means it comes from the page pool.
+///
 class EXPORT_DEBUG debug_ring
 {
 public:
@@ -71,8 +76,10 @@ public:
     /// @ensures none
     ///
     /// @param vcpuid the vcpuid of the debug ring
+    /// @param size the size of the debug ring's buffer. If this size is not
+    ///     valid (see debug_ring_size_valid()), DEBUG_RING_SIZE is used
     ///
-    debug_ring(vcpuid::type vcpuid) noexcept;
+    debug_ring(vcpuid::type vcpuid, uint64_t size = DEBUG_RING_SIZE) noexcept;
 
     /// Debug Ring Destructor
     ///
@@ -95,10 +102,43 @@ public:
     ///
     VIRTUAL void write(const std::string &str) noexcept;
 
+    /// Write to Debug Ring
+    ///
+    /// Same as write(const std::string &), but does not require the string
+    /// to be stored in a std::string.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @param str the string to write to the debug ring
+    /// @param len the length of str (not including the '\0')
+    ///
+    VIRTUAL void write(const char *str, size_t len) noexcept;
+
+    /// Write to Debug Ring (with Prefix)
+    ///
+    /// Writes the prefix, immediately followed by the string, to the debug
+    /// ring as a single string. This is how a stamp is added to a string
+    /// without having to first copy the string into a new buffer.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @param prefix the prefix to write to the debug ring
+    /// @param prefix_len the length of prefix
+    /// @param str the string to write to the debug ring
+    /// @param len the length of str (not including the '\0')
+    ///
+    VIRTUAL void write(
+        const char *prefix, size_t prefix_len, const char *str, size_t len) noexcept;
+
 private:
 
+    debug_ring_resources_t *drr() const noexcept
+    { return reinterpret_cast<debug_ring_resources_t *>(m_mem.get()); }
+
     vcpuid::type m_vcpuid;
-    std::unique_ptr<debug_ring_resources_t> m_drr;
+    std::unique_ptr<char[]> m_mem;
 
 public:
 
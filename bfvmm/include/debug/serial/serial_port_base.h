@@ -126,6 +126,61 @@ public:
     ///
     virtual void write(const char *str, size_t len) noexcept;
 
+    /// Drain
+    ///
+    /// Serial devices that buffer the characters that are written to them
+    /// transmit some of the buffered characters, without waiting on the
+    /// device. This is called on each VM exit. By default, nothing is
+    /// buffered, and this function does nothing.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    virtual void drain() noexcept
+    { }
+
+    /// Flush
+    ///
+    /// Serial devices that buffer the characters that are written to them
+    /// transmit all of the buffered characters, waiting on the device as
+    /// needed. This is called before the VMM stops running on a CPU, or is
+    /// unloaded, as there might not be another VM exit to drain what is
+    /// left. By default, nothing is buffered, and this function does
+    /// nothing.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    virtual void flush() noexcept
+    { }
+
+    /// Begin Synchronous
+    ///
+    /// Until the matching end_synchronous(), serial devices that buffer the
+    /// characters that are written to them flush them on each write. This
+    /// is used while the VMM handles a request from the driver, as there
+    /// are no VM exits to drain what is buffered, and a large dump would
+    /// otherwise overrun the buffer. Calls can be nested, and can be made
+    /// by more than one CPU at a time. By default, nothing is buffered, and
+    /// this function does nothing.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    virtual void begin_synchronous() noexcept
+    { }
+
+    /// End Synchronous
+    ///
+    /// Ends what was started by begin_synchronous(). By default, nothing is
+    /// buffered, and this function does nothing.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    virtual void end_synchronous() noexcept
+    { }
+
 protected:
 
     /// Read 8 bits from IO
@@ -19,6 +19,9 @@
 #ifndef SERIAL_PORT_NS16550A_H
 #define SERIAL_PORT_NS16550A_H
 
+#include <array>
+#include <mutex>
+#include <atomic>
 #include <string>
 #include <memory>
 
@@ -61,6 +64,7 @@ namespace serial_ns16550a
 {
 
 constexpr const serial_port_base::value_type_8 dlab = 1U << 7;
+constexpr const std::size_t fifo_size = 16U;
 
 constexpr const serial_port_base::port_type baud_rate_lo_reg = 0U;
 constexpr const serial_port_base::port_type baud_rate_hi_reg = 1U;
@@ -108,6 +112,15 @@ constexpr const serial_port_base::value_type_8 line_control_parity_mask = 0x38;
 /// Also note, that by default, a FIFO is used / required, and interrupts are
 /// disabled.
 ///
+/// Characters are not written to the device directly. Instead, they are
+/// queued in a TX ring, and drained into the device's FIFO, up to a full FIFO
+/// each time the transmitter is empty. Draining never waits on the device,
+/// and is done opportunistically on each write and on each VM exit. If the
+/// TX ring is full, the oldest characters are dropped, which means that
+/// writing to the serial port never stalls the CPU. The exceptions are
+/// flush(), which waits until the TX ring is empty, and synchronous writes
+/// (see begin_synchronous()), which flush the TX ring each time.
+///
 class EXPORT_DEBUG serial_port_ns16550a : public serial_port_base
 {
 public:
@@ -309,7 +322,7 @@ public:
 
     /// Write Character
     ///
-    /// Writes a character to the serial device.
+    /// Queues a character to be written to the serial device.
     ///
     /// @expects none
     /// @ensures none
@@ -318,7 +331,68 @@ public:
     ///
     virtual void write(char c) noexcept override;
 
-    using serial_port_base::write;
+    /// Write String
+    ///
+    /// Queues a string to be written to the serial device.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @param str string to write
+    ///
+    virtual void write(const std::string &str) noexcept override;
+
+    /// Write String
+    ///
+    /// Queues a string to be written to the serial device.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @param str string to write
+    /// @param len length of the string to write
+    ///
+    virtual void write(const char *str, size_t len) noexcept override;
+
+    /// Drain
+    ///
+    /// If the transmitter is empty, fills the device's FIFO with the oldest
+    /// characters in the TX ring. If the transmitter is busy, or another CPU
+    /// is already using the TX ring, this function returns immediately.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    virtual void drain() noexcept override;
+
+    /// Flush
+    ///
+    /// Writes every character in the TX ring to the device, waiting for
+    /// the transmitter to empty between each full FIFO.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    virtual void flush() noexcept override;
+
+    /// Begin Synchronous
+    ///
+    /// Until the matching end_synchronous(), each write flushes the TX ring
+    /// (see flush()) instead of draining it.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    virtual void begin_synchronous() noexcept override;
+
+    /// End Synchronous
+    ///
+    /// Ends what was started by begin_synchronous(), and flushes the TX ring.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    virtual void end_synchronous() noexcept override;
 
 private:
 
@@ -328,15 +402,26 @@ private:
     bool get_line_status_empty_transmitter() const noexcept;
 
     void init(port_type port) noexcept;
+    void queue(const char *str, size_t len) noexcept;
+    bool empty() const noexcept;
+    void fill_fifo() noexcept;
+    void transmit() noexcept;
 
     port_type m_port;
 
+    std::atomic<uint64_t> m_tx_spos{0};
+    std::atomic<uint64_t> m_tx_epos{0};
+
+    std::mutex m_tx_mutex;
+    std::atomic<uint64_t> m_synchronous{0};
+    std::array<char, SERIAL_TX_RING_SIZE> m_tx_buf{};
+
 public:
 
     /// @cond
 
-    serial_port_ns16550a(serial_port_ns16550a &&) noexcept = default;
-    serial_port_ns16550a &operator=(serial_port_ns16550a &&) noexcept = default;
+    serial_port_ns16550a(serial_port_ns16550a &&) noexcept = delete;
+    serial_port_ns16550a &operator=(serial_port_ns16550a &&) noexcept = delete;
 
     serial_port_ns16550a(const serial_port_ns16550a &) = delete;
     serial_port_ns16550a &operator=(const serial_port_ns16550a &) = delete;
@@ -0,0 +1,219 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+#ifndef TRACE_RING_H
+#define TRACE_RING_H
+
+#include <atomic>
+#include <memory>
+
+#include <bfgsl.h>
+#include <bftypes.h>
+#include <bfvcpuid.h>
+#include <bftraceringinterface.h>
+
+#include <intrinsics.h>
+
+// -----------------------------------------------------------------------------
+// Exports
+// -----------------------------------------------------------------------------
+
+#include <bfexports.h>
+
+#ifndef STATIC_DEBUG
+#ifdef SHARED_DEBUG
+#define EXPORT_DEBUG EXPORT_SYM
+#else
+#define EXPORT_DEBUG IMPORT_SYM
+#endif
+#else
+#define EXPORT_DEBUG
+#endif
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif
+
+// -----------------------------------------------------------------------------
+// Definitions
+// -----------------------------------------------------------------------------
+
+namespace bfvmm
+{
+
+/// Trace Ring
+///
+/// The trace ring is a binary alternative to the debug ring. Instead of
+/// formatting a string, each event is recorded as a fixed sized record
+/// (see trace_record_t), which only takes a handful of stores, making it
+/// cheap enough to leave enabled on hot paths like the exit handler. The
+/// records are formatted offline by bfm.
+///
+/// Each CPU has its own trace ring (see cpu_trace_ring()), and only that
+/// CPU writes to it, which is why no locks are needed.
+///
+class EXPORT_DEBUG trace_ring
+{
+public:
+
+    using cpuid_type = uint64_t;        ///< CPU id type
+    using id_type = uint64_t;           ///< Event id type
+    using arg_type = uint64_t;          ///< Event argument type
+
+    /// Default Constructor
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @param cpuid the id of the CPU that owns this trace ring
+    ///
+    trace_ring(cpuid_type cpuid);
+
+    /// Destructor
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    ~trace_ring() noexcept;
+
+    /// Set vCPU ID
+    ///
+    /// Sets the vCPU id that is stored in each record written after this
+    /// call. This should be set on each VM exit.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @param id the id of the vCPU that is executing on this CPU
+    ///
+    void set_vcpuid(vcpuid::type id) noexcept
+    { m_vcpuid = id; }
+
+    /// Write
+    ///
+    /// Records an event. If the trace ring is full, the oldest record is
+    /// overwritten.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @param id the id of the event (i.e. TRACE_EVENT_xxx)
+    /// @param arg0 event specific argument
+    /// @param arg1 event specific argument
+    /// @param arg2 event specific argument
+    /// @param arg3 event specific argument
+    ///
+    void write(
+        id_type id, arg_type arg0 = 0, arg_type arg1 = 0,
+        arg_type arg2 = 0, arg_type arg3 = 0) noexcept
+    {
+        auto &record =
+            gsl::at(m_trr->buf, static_cast<std::ptrdiff_t>(m_trr->epos & (TRACE_RING_SIZE - 1)));
+
+        record.id = id;
+        record.tsc = ::x64::read_tsc::get();
+        record.vcpuid = m_vcpuid;
+        record.args[0] = arg0;
+        record.args[1] = arg1;
+        record.args[2] = arg2;
+        record.args[3] = arg3;
+
+        std::atomic_thread_fence(std::memory_order_release);
+        m_trr->epos++;
+    }
+
+private:
+
+    cpuid_type m_cpuid;
+    vcpuid::type m_vcpuid{vcpuid::invalid};
+
+    std::unique_ptr<trace_ring_resources_t> m_trr;
+
+public:
+
+    /// @cond
+
+    trace_ring(trace_ring &&) noexcept = delete;
+    trace_ring &operator=(trace_ring &&) noexcept = delete;
+
+    trace_ring(const trace_ring &) = delete;
+    trace_ring &operator=(const trace_ring &) = delete;
+
+    /// @endcond
+};
+
+/// CPU Trace Ring
+///
+/// Returns the trace ring that belongs to the currently executing CPU,
+/// creating it if needed.
+///
+/// @expects none
+/// @ensures none
+///
+/// @return the trace ring for this CPU, or nullptr if this CPU does not
+///     have one (i.e. thread_context_cpuid() >= MAX_TRACE_RING_CPUS, or
+///     the trace ring could not be allocated)
+///
+EXPORT_DEBUG trace_ring *cpu_trace_ring() noexcept;
+
+/// Trace
+///
+/// Records an event in the current CPU's trace ring.
+///
+/// @expects none
+/// @ensures none
+///
+/// @param id the id of the event (i.e. TRACE_EVENT_xxx)
+/// @param arg0 event specific argument
+/// @param arg1 event specific argument
+/// @param arg2 event specific argument
+/// @param arg3 event specific argument
+///
+inline void
+trace(
+    trace_ring::id_type id, trace_ring::arg_type arg0 = 0, trace_ring::arg_type arg1 = 0,
+    trace_ring::arg_type arg2 = 0, trace_ring::arg_type arg3 = 0) noexcept
+{
+    if (auto tr = cpu_trace_ring()) {
+        tr->write(id, arg0, arg1, arg2, arg3);
+    }
+}
+
+}
+
+/// Get Trace Ring Resource
+///
+/// Returns a pointer to the trace_ring_resources_t for a given CPU.
+///
+/// @expects trr != nullptr
+/// @ensures none
+///
+/// @param cpuid defines which trace ring to return
+/// @param trr the resulting trace ring
+/// @return GET_TRR_SUCCESS on success, GET_TRR_FAILURE if the CPU does not
+///     have a trace ring
+///
+extern "C" EXPORT_DEBUG int64_t get_trr(
+    uint64_t cpuid, struct trace_ring_resources_t **trr) noexcept;
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif
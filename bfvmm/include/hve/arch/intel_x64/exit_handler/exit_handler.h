@@ -99,13 +99,21 @@ public:
 
     /// Default Constructor
     ///
+    /// Allocates the exit handler's stack, and its host GDT, IDT and TSS,
+    /// and then writes the VMCS (see write_state()). If deferred is true,
+    /// the VMCS is not touched, which means the exit handler can be
+    /// constructed on any CPU, before VMX operation is enabled, and
+    /// write_state() must be called before the VMCS is launched.
+    ///
     /// @expects none
     /// @ensures none
     ///
     /// @param vmcs The VMCS associated with this exit handler
+    /// @param deferred if true, the VMCS is not written
     ///
     exit_handler(
-        gsl::not_null<vmcs *> vmcs
+        gsl::not_null<vmcs *> vmcs,
+        bool deferred = false
     );
 
     /// Destructor
@@ -138,6 +146,46 @@ public:
         handler_delegate_t &&d
     );
 
+    /// Write State
+    ///
+    /// Loads the VMCS, and writes the host, control and (for the host VM)
+    /// guest state. The guest state is read from the CPU that this is
+    /// executed on, so this must be executed on the vCPU's CPU, with VMX
+    /// operation enabled.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    void write_state();
+
+    /// Enable Soft TLB
+    ///
+    /// By default, the guest is able to flush its TLB, and change how its
+    /// addresses are translated without trapping, so the soft TLB (see
+    /// soft_tlb.h) is flushed on every exit. An extension that traps all
+    /// of these operations (i.e. INVLPG and MOV to CR3 exiting, and the
+    /// paging bits of CR0 and CR4 in the guest/host masks) calls this
+    /// function once it has written these controls, which allows the soft
+    /// TLB to survive across exits. The controls are only read here, and
+    /// not on each exit. Writing the VMCS (see write_state()) disables the
+    /// soft TLB again.
+    ///
+    /// @expects INVLPG and MOV to CR3 exiting are enabled, and the paging
+    ///     bits of CR0 and CR4 are owned by the VMM
+    /// @ensures none
+    ///
+    void enable_soft_tlb();
+
+    /// Disable Soft TLB
+    ///
+    /// Must be called before any of the controls that are needed by
+    /// enable_soft_tlb() are disabled.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    void disable_soft_tlb() noexcept;
+
     /// Handle
     ///
     /// Handles a VM exit. This function should only be called by the exit
@@ -181,6 +229,7 @@ private:
     static ::intel_x64::msrs::value_type s_ia32_efer_msr;
 
     std::array<std::list<handler_delegate_t>, 128> m_handlers;
+    bool m_soft_tlb_enabled{false};
 
 public:
 
@@ -163,6 +163,19 @@ public:
     ///
     VIRTUAL void load();
 
+    /// Clear
+    ///
+    /// Executes VMCLEAR, which writes any VMCS data that is cached by the CPU
+    /// to memory, and sets the launch state of the VMCS to "clear". This is
+    /// needed before a VMCS that has been launched can be launched again
+    /// (e.g. after VMX operation was disabled when the system was suspended).
+    /// Note that if this VMCS is loaded, it is no longer loaded once cleared.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    VIRTUAL void clear();
+
     /// Save State
     ///
     /// Returns the VMCS's save state. This is state that is above and beyond
@@ -29,9 +29,14 @@
 #include <bfexception.h>
 #include <bfupperlower.h>
 
+#include "soft_tlb.h"
+#include "map_window.h"
+#include "tlb_shootdown.h"
 #include "root_page_table.h"
 #include "../../memory_manager.h"
 
+#include <debug/trace_ring/trace_ring.h>
+
 #include <intrinsics.h>
 
 // -----------------------------------------------------------------------------
@@ -65,7 +70,8 @@ class unique_map_ptr;
 /// Make Unique Map (Single Page)
 ///
 /// This function can be used to map a single virtual memory page to
-/// a single physical memory page.
+/// a single physical memory page. The map is placed in the current CPU's
+/// map window if a slot is free, otherwise the memory map pool is used.
 ///
 /// @b Example: @n
 /// @code
@@ -85,12 +91,19 @@ auto make_unique_map(
     typename unique_map_ptr<T>::pointer phys,
     ::x64::memory_attr::attr_type attr = ::x64::memory_attr::rw_wb)
 {
+    auto iphys = reinterpret_cast<typename unique_map_ptr<T>::integer_pointer>(phys);
+
+    if (auto wmap = map_window_4k(iphys, attr)) {
+        bfvmm::trace(TRACE_EVENT_MAP, wmap, iphys, ::x64::page_size);
+        return unique_map_ptr<T>(wmap, ::x64::page_size);
+    }
+
     auto vmap = g_mm->alloc_map(::x64::page_size);
 
     try {
         return unique_map_ptr<T>(
                    reinterpret_cast<typename unique_map_ptr<T>::integer_pointer>(vmap),
-                   reinterpret_cast<typename unique_map_ptr<T>::integer_pointer>(phys),
+                   iphys,
                    attr
                );
     }
@@ -103,7 +116,8 @@ auto make_unique_map(
 /// Make Unique Map (Single Page)
 ///
 /// This function can be used to map a single virtual memory page to
-/// a single physical memory page.
+/// a single physical memory page. The map is placed in the current CPU's
+/// map window if a slot is free, otherwise the memory map pool is used.
 ///
 /// @b Example: @n
 /// @code
@@ -123,6 +137,11 @@ auto make_unique_map(
     typename unique_map_ptr<T>::integer_pointer phys,
     ::x64::memory_attr::attr_type attr = ::x64::memory_attr::rw_wb)
 {
+    if (auto wmap = map_window_4k(phys, attr)) {
+        bfvmm::trace(TRACE_EVENT_MAP, wmap, phys, ::x64::page_size);
+        return unique_map_ptr<T>(wmap, ::x64::page_size);
+    }
+
     auto vmap = g_mm->alloc_map(::x64::page_size);
 
     try {
@@ -269,8 +288,10 @@ auto make_unique_map(
 /// Converts a virtual address to a physical address given the
 /// CR3 to locate the physical address from. Note that this function
 /// has to map / unmap the page table tree as it traverses the tree
-/// to locate the physical address. As a result, this is an expensive
-/// operation and should not be used in time sensitive operations.
+/// to locate the physical address. To limit this cost, the result of
+/// each walk is stored in the current CPU's soft_tlb, and subsequent
+/// translations for the same page (and CR3) are served from the TLB
+/// until the guest flushes its TLB.
 ///
 /// @note the provided virtual address should be present prior to running
 ///     this function.
@@ -432,6 +453,7 @@ public:
         expects(bfn::lower(phys) == 0);
 
         g_pt->map_4k(vmap, bfn::upper(phys), attr);
+        bfvmm::trace(TRACE_EVENT_MAP, vmap, phys, ::x64::page_size);
 
         flush();
     }
@@ -519,6 +541,8 @@ public:
             }
         }
 
+        bfvmm::trace(TRACE_EVENT_MAP, vmap, list.front().first, m_size);
+
         flush();
     }
 
@@ -576,6 +600,7 @@ public:
         m_unaligned_size += bfn::lower(virt);
 
         map_with_cr3(vmap, virt, cr3, m_unaligned_size, pat);
+        bfvmm::trace(TRACE_EVENT_MAP_CR3, vmap, virt, cr3, m_unaligned_size);
 
         flush();
     }
@@ -839,8 +864,8 @@ public:
     ///
     /// Flushes the TLB entries associated with the virtual address ranges
     /// this unique_map_ptr holds. This is done automatically when
-    /// mapping memory, but might be needed if this map is shared with
-    /// another core whose TLB has not been properly flushed.
+    /// mapping memory. When the memory is unmapped, the range is flushed
+    /// on every core (on each core's next VM exit) using tlb_shootdown().
     ///
     /// @expects none
     /// @ensures none
@@ -855,31 +880,83 @@ public:
 
     /// Cache Flush
     ///
-    /// Flushes the Cache associated with the virtual address ranges
-    /// this unique_map_ptr holds. This is done automatically when
-    /// unmapping memory, but might be needed manually by users
+    /// Flushes (writes back and invalidates) the Cache associated with the
+    /// virtual address ranges this unique_map_ptr holds. If the CPU supports
+    /// CLFLUSHOPT, the lines are flushed without serializing on each line,
+    /// followed by a single fence. Note that this is not done when
+    /// unmapping memory, as WB memory (the default) is coherent and does
+    /// not need to be flushed. Users that map memory with a different memory
+    /// type, and share that memory with a device, should flush manually.
     ///
     /// @expects none
     /// @ensures none
     ///
     void cache_flush() noexcept
     {
+        using namespace ::intel_x64::cpuid::extended_feature_flags::subleaf0::ebx;
+        static const auto s_clflushopt = clflushopt::is_enabled();
+
         auto vmap = bfn::upper(m_virt);
+
+        if (s_clflushopt) {
+            for (auto vadr = vmap; vadr < vmap + m_unaligned_size; vadr += ::x64::cache_line_size) {
+                ::x64::cache::clflushopt(reinterpret_cast<pointer>(vadr));
+            }
+
+            ::x64::cache::sfence();
+            return;
+        }
+
         for (auto vadr = vmap; vadr < vmap + m_unaligned_size; vadr += ::x64::cache_line_size) {
             ::x64::cache::clflush(reinterpret_cast<pointer>(vadr));
         }
     }
 
+    /// Cache Write Back
+    ///
+    /// Writes back the Cache associated with the virtual address ranges
+    /// this unique_map_ptr holds, without invalidating it (if the CPU
+    /// supports CLWB), followed by a single fence. If CLWB is not supported,
+    /// this is the same as cache_flush().
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    void cache_write_back() noexcept
+    {
+        using namespace ::intel_x64::cpuid::extended_feature_flags::subleaf0::ebx;
+        static const auto s_clwb = clwb::is_enabled();
+
+        if (!s_clwb) {
+            this->cache_flush();
+            return;
+        }
+
+        auto vmap = bfn::upper(m_virt);
+        for (auto vadr = vmap; vadr < vmap + m_unaligned_size; vadr += ::x64::cache_line_size) {
+            ::x64::cache::clwb(reinterpret_cast<pointer>(vadr));
+        }
+
+        ::x64::cache::sfence();
+    }
+
 private:
 
     void cleanup(integer_pointer virt, size_type size) noexcept
     {
         if (virt != 0 && size != 0) {
             auto vmap = bfn::upper(virt);
+            bfvmm::trace(TRACE_EVENT_UNMAP, vmap, size);
+
+            if (unmap_window_4k(vmap)) {
+                return;
+            }
+
             for (auto vadr = vmap; vadr < vmap + size; vadr += ::x64::page_size) {
                 g_pt->unmap(vadr);
             }
 
+            tlb_shootdown(vmap, size);
             g_mm->free_map(reinterpret_cast<pointer>(vmap));
         }
     }
@@ -957,6 +1034,22 @@ virt_to_phys_with_cr3(uintptr_t virt, uintptr_t cr3)
     expects(bfn::lower(cr3) == 0);
     expects(virt != 0);
 
+    auto stlb = cpu_soft_tlb();
+
+    if (stlb != nullptr) {
+        if (auto phys = stlb->lookup(virt, cr3)) {
+            return phys;
+        }
+    }
+
+    auto cache = [&](uintptr_t phys, uintptr_t phys_from) -> uintptr_t {
+        if (stlb != nullptr) {
+            return stlb->insert(virt, cr3, phys, phys_from);
+        }
+
+        return bfn::upper(phys, phys_from) | bfn::lower(virt, phys_from);
+    };
+
     from = ::x64::page_table::pml4::from;
     auto pml4_idx = ::x64::page_table::index(virt, from);
     auto pml4_map = bfvmm::x64::make_unique_map<uintptr_t>(cr3);
@@ -974,7 +1067,7 @@ virt_to_phys_with_cr3(uintptr_t virt, uintptr_t cr3)
     expects(pdpt_pte.phys_addr() != 0);
 
     if (pdpt_pte.ps()) {
-        return bfn::upper(pdpt_pte.phys_addr(), from) | bfn::lower(virt, from);
+        return cache(pdpt_pte.phys_addr(), from);
     }
 
     from = ::x64::page_table::pd::from;
@@ -986,7 +1079,7 @@ virt_to_phys_with_cr3(uintptr_t virt, uintptr_t cr3)
     expects(pd_pte.phys_addr() != 0);
 
     if (pd_pte.ps()) {
-        return bfn::upper(pd_pte.phys_addr(), from) | bfn::lower(virt, from);
+        return cache(pd_pte.phys_addr(), from);
     }
 
     from = ::x64::page_table::pt::from;
@@ -997,7 +1090,7 @@ virt_to_phys_with_cr3(uintptr_t virt, uintptr_t cr3)
     expects(pt_pte.present());
     expects(pt_pte.phys_addr() != 0);
 
-    return bfn::upper(pt_pte.phys_addr(), from) | bfn::lower(virt, from);
+    return cache(pt_pte.phys_addr(), from);
 }
 
 }
@@ -0,0 +1,224 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+#ifndef MAP_WINDOW_X64_H
+#define MAP_WINDOW_X64_H
+
+#include <atomic>
+#include <vector>
+#include <cstdint>
+
+#include <bfgsl.h>
+#include <bfconstants.h>
+
+#include "page_table_entry.h"
+#include "root_page_table.h"
+
+#include <intrinsics.h>
+
+// -----------------------------------------------------------------------------
+// Exports
+// -----------------------------------------------------------------------------
+
+#include <bfexports.h>
+
+#ifndef STATIC_MEMORY_MANAGER
+#ifdef SHARED_MEMORY_MANAGER
+#define EXPORT_MEMORY_MANAGER EXPORT_SYM
+#else
+#define EXPORT_MEMORY_MANAGER IMPORT_SYM
+#endif
+#else
+#define EXPORT_MEMORY_MANAGER
+#endif
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif
+
+// -----------------------------------------------------------------------------
+// Definitions
+// -----------------------------------------------------------------------------
+
+namespace bfvmm
+{
+namespace x64
+{
+
+/// Map Window
+///
+/// A map window is a small, CPU private range of virtual memory (similar to
+/// kmap_atomic in Linux) that is used for short lived, single page maps such
+/// as reading a guest's page tables, or a guest instruction in an exit
+/// handler. The page tables for each slot in the window are created up
+/// front, which means that mapping / unmapping a page only needs to write
+/// the PTE and flush the local TLB. No locks are taken, and the global
+/// memory map pool is not used.
+///
+/// Since a window is only ever used by the CPU that owns it, a stale TLB
+/// entry can only exist on the owning CPU, which is why a local invlpg is
+/// all that is needed. Note that maps in a window are not added to the
+/// memory manager, so virt / phys conversions are not supported for these
+/// addresses.
+///
+/// In general, this class should not be used directly, but instead mapping
+/// should be done via make_unique_map, which uses the current CPU's window
+/// for single page maps, and falls back to the memory map pool for larger
+/// ranges, or when the window is full.
+///
+class EXPORT_MEMORY_MANAGER map_window
+{
+public:
+
+    using integer_pointer = uintptr_t;                          ///< Integer pointer type
+    using size_type = std::size_t;                              ///< Size type
+    using attr_type = ::x64::memory_attr::attr_type;            ///< Attribute type
+
+    /// Size of a window in bytes
+    ///
+    static constexpr const size_type size_bytes = MAP_WINDOW_SLOTS * ::x64::page_size;
+
+    /// Default Constructor
+    ///
+    /// Reserves the page table entries for each slot in the window.
+    ///
+    /// @expects base & (page_size - 1) == 0
+    /// @ensures none
+    ///
+    /// @param base the starting virtual address of the window
+    ///
+    map_window(integer_pointer base);
+
+    /// Destructor
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    virtual ~map_window() = default;
+
+    /// Map
+    ///
+    /// Maps a single physical page into a free slot in the window, and
+    /// flushes the local TLB entry for that slot.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @param phys the physical address to map
+    /// @param attr defines how to map the memory
+    /// @return the virtual address of the map, or 0 if the window is full or
+    ///     the physical address is not page aligned
+    ///
+    virtual integer_pointer map(
+        integer_pointer phys, attr_type attr) noexcept;
+
+    /// Unmap
+    ///
+    /// Unmaps a page previously mapped using map(), and releases the slot.
+    /// If the provided virtual address is not in this window, the call is
+    /// ignored.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @param virt the virtual address returned by map()
+    ///
+    virtual void unmap(integer_pointer virt) noexcept;
+
+    /// Contains
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @param virt the virtual address to check
+    /// @return true if virt is in this window, false otherwise
+    ///
+    bool contains(integer_pointer virt) const noexcept
+    { return virt >= m_base && virt < m_base + size_bytes; }
+
+private:
+
+    integer_pointer m_base;
+    std::atomic<uint64_t> m_used{0};
+    std::vector<page_table_entry> m_ptes;
+
+public:
+
+    /// @cond
+
+    map_window(map_window &&) noexcept = delete;
+    map_window &operator=(map_window &&) noexcept = delete;
+
+    map_window(const map_window &) = delete;
+    map_window &operator=(const map_window &) = delete;
+
+    /// @endcond
+};
+
+/// CPU Map Window
+///
+/// Returns the map window that belongs to the currently executing CPU. The
+/// window is created the first time a CPU asks for it.
+///
+/// @expects none
+/// @ensures none
+///
+/// @return the current CPU's map window, or nullptr if this CPU does not
+///     have a window (i.e. thread_context_cpuid() >= MAX_MAP_WINDOW_CPUS)
+///
+EXPORT_MEMORY_MANAGER map_window *cpu_map_window() noexcept;
+
+/// Map (Window)
+///
+/// Maps a single page using the current CPU's map window.
+///
+/// @expects none
+/// @ensures none
+///
+/// @param phys the physical address to map
+/// @param attr defines how to map the memory
+/// @return the resulting virtual address, or 0 if the caller should fall
+///     back to the memory map pool
+///
+EXPORT_MEMORY_MANAGER uintptr_t map_window_4k(
+    uintptr_t phys, ::x64::memory_attr::attr_type attr) noexcept;
+
+/// Unmap (Window)
+///
+/// Unmaps a page that was mapped using map_window_4k. The page is returned
+/// to the window that owns it, even if the caller is executing on a
+/// different CPU.
+///
+/// @expects none
+/// @ensures none
+///
+/// @param virt the virtual address to unmap
+/// @return true if virt belongs to a map window and was unmapped, false
+///     otherwise
+///
+EXPORT_MEMORY_MANAGER bool unmap_window_4k(uintptr_t virt) noexcept;
+
+}
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif
@@ -64,8 +64,10 @@ namespace x64
 /// for itself, but also from other guests. This class represents the root
 /// page tables that the VMM will use.
 ///
-/// Note that this class does not flush the TLB when modifications are made.
-/// This needs to be done manually. In general, this class should not be used
+/// Note that this class does not flush the TLB when individual pages are
+/// unmapped. This needs to be done manually, preferably using a single
+/// tlb_shootdown() for the entire range that was unmapped (the unmap_identity
+/// functions do this for you). In general, this class should not be used
 /// directly, but instead mapping should be done via a unique_map_ptr_x64.
 ///
 class EXPORT_MEMORY_MANAGER root_page_table
@@ -164,6 +166,38 @@ public:
     ///
     virtual void unmap(integer_pointer virt) noexcept;
 
+    /// Reserve (4 Kilobytes)
+    ///
+    /// Creates the page tables needed to map a 4 kilobyte page at the
+    /// provided virtual address, and returns the resulting (non-present)
+    /// entry. Unlike map_4k, the entry is not added to the memory manager,
+    /// and the caller owns the entry until unmap() is called, which means
+    /// it can be populated / cleared using set_entry_4k() without taking
+    /// the page table lock. This is used by the per-CPU map windows.
+    ///
+    /// @expects virt & (page_size - 1) == 0
+    /// @ensures none
+    ///
+    /// @param virt the virtual address to reserve
+    /// @return the resulting PTE
+    ///
+    virtual page_table_entry reserve_4k(integer_pointer virt);
+
+    /// Set Entry (4 Kilobytes)
+    ///
+    /// Populates a 4 kilobyte page table entry given the physical address
+    /// and a set of attributes. Note that this does not flush the TLB.
+    ///
+    /// @expects
+    /// @ensures
+    ///
+    /// @param entry the entry to populate
+    /// @param phys the physical address to map
+    /// @param attr describes how to map the physical address
+    ///
+    static void set_entry_4k(
+        page_table_entry &entry, integer_pointer phys, attr_type attr);
+
     /// Setup Identify Map (1g Granularity)
     ///
     /// Sets up an identify map in the page tables using 1 gigabyte
@@ -287,6 +321,8 @@ private:
     void map_page(integer_pointer virt, integer_pointer phys, attr_type attr, size_type size);
     void unmap_page(integer_pointer virt) noexcept;
 
+    static void set_entry_perms(page_table_entry &entry, attr_type attr);
+
 private:
 
     bool m_is_vmm{false};
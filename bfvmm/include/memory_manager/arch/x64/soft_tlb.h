@@ -0,0 +1,210 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+#ifndef SOFT_TLB_X64_H
+#define SOFT_TLB_X64_H
+
+#include <array>
+#include <cstdint>
+
+#include <bfconstants.h>
+
+// -----------------------------------------------------------------------------
+// Exports
+// -----------------------------------------------------------------------------
+
+#include <bfexports.h>
+
+#ifndef STATIC_MEMORY_MANAGER
+#ifdef SHARED_MEMORY_MANAGER
+#define EXPORT_MEMORY_MANAGER EXPORT_SYM
+#else
+#define EXPORT_MEMORY_MANAGER IMPORT_SYM
+#endif
+#else
+#define EXPORT_MEMORY_MANAGER
+#endif
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4251)
+#endif
+
+// -----------------------------------------------------------------------------
+// Definitions
+// -----------------------------------------------------------------------------
+
+namespace bfvmm
+{
+namespace x64
+{
+
+/// Software TLB
+///
+/// Caches the results of virt_to_phys_with_cr3() so that exit handlers that
+/// decode guest instructions, or follow guest pointers, do not have to map
+/// in all four levels of the guest's page tables for each translation. The
+/// TLB is direct mapped and keyed by CR3 and the virtual page number. Large
+/// pages are cached as a single entry, indexed using their own page size.
+///
+/// Like a hardware TLB, the contents of this cache are only valid until the
+/// guest flushes its TLB (i.e. MOV to CR3, INVLPG and INVPCID). The exit
+/// handler is responsible for calling invalidate() when it sees one of these
+/// operations, and for flushing the TLB on every exit if the guest is able
+/// to perform these operations without trapping. The TLB is also flushed
+/// whenever a CPU switches to a different vCPU.
+///
+class EXPORT_MEMORY_MANAGER soft_tlb
+{
+public:
+
+    using integer_pointer = uintptr_t;      ///< Integer pointer type
+    using size_type = std::size_t;          ///< Size type
+    using vcpuid_type = uint64_t;           ///< vCPU id type
+
+    /// Default Constructor
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    soft_tlb() noexcept = default;
+
+    /// Destructor
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    ~soft_tlb() = default;
+
+    /// Lookup
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @param virt the virtual address to translate
+    /// @param cr3 the CR3 the virtual address originates from
+    /// @return the physical address mapped to virt, or 0 on a miss
+    ///
+    integer_pointer lookup(
+        integer_pointer virt, integer_pointer cr3) const noexcept;
+
+    /// Insert
+    ///
+    /// Adds a translation to the TLB, replacing any existing translation
+    /// that occupies the same entry.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @param virt the virtual address that was translated
+    /// @param cr3 the CR3 the virtual address originates from
+    /// @param phys the physical address of the page (4k, 2m or 1g)
+    /// @param from the page shift of the page (i.e. pt::from, pd::from or
+    ///     pdpt::from)
+    /// @return the physical address mapped to virt
+    ///
+    integer_pointer insert(
+        integer_pointer virt, integer_pointer cr3,
+        integer_pointer phys, integer_pointer from) noexcept;
+
+    /// Invalidate (All)
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    void invalidate() noexcept
+    { m_gen++; }
+
+    /// Invalidate (Single Address)
+    ///
+    /// Removes any translation for the provided virtual address, regardless
+    /// of the CR3 it was inserted with.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @param virt the virtual address to invalidate
+    ///
+    void invalidate(integer_pointer virt) noexcept;
+
+    /// Set vCPU ID
+    ///
+    /// Tells the TLB which vCPU is currently executing on this CPU. If the
+    /// vCPU differs from the last vCPU that used this TLB, the TLB is
+    /// invalidated.
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @param id the id of the current vCPU
+    ///
+    void set_vcpuid(vcpuid_type id) noexcept
+    {
+        if (m_vcpuid != id) {
+            m_vcpuid = id;
+            this->invalidate();
+        }
+    }
+
+private:
+
+    struct entry_t {
+        integer_pointer cr3;
+        integer_pointer virt;
+        integer_pointer phys;
+        integer_pointer from;
+        uint64_t gen;
+    };
+
+    uint64_t m_gen{1};
+    vcpuid_type m_vcpuid{0};
+
+    std::array<entry_t, SOFT_TLB_ENTRIES> m_entries{};
+
+public:
+
+    /// @cond
+
+    soft_tlb(soft_tlb &&) noexcept = delete;
+    soft_tlb &operator=(soft_tlb &&) noexcept = delete;
+
+    soft_tlb(const soft_tlb &) = delete;
+    soft_tlb &operator=(const soft_tlb &) = delete;
+
+    /// @endcond
+};
+
+/// CPU Software TLB
+///
+/// @expects none
+/// @ensures none
+///
+/// @return the software TLB that belongs to the currently executing CPU, or
+///     nullptr if this CPU does not have one (i.e. thread_context_cpuid() >=
+///     MAX_SOFT_TLB_CPUS)
+///
+EXPORT_MEMORY_MANAGER soft_tlb *cpu_soft_tlb() noexcept;
+
+}
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+#endif
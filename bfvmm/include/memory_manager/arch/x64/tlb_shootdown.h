@@ -0,0 +1,96 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+#ifndef TLB_SHOOTDOWN_X64_H
+#define TLB_SHOOTDOWN_X64_H
+
+#include <cstdint>
+#include <cstddef>
+
+#include <bfconstants.h>
+
+// -----------------------------------------------------------------------------
+// Exports
+// -----------------------------------------------------------------------------
+
+#include <bfexports.h>
+
+#ifndef STATIC_MEMORY_MANAGER
+#ifdef SHARED_MEMORY_MANAGER
+#define EXPORT_MEMORY_MANAGER EXPORT_SYM
+#else
+#define EXPORT_MEMORY_MANAGER IMPORT_SYM
+#endif
+#else
+#define EXPORT_MEMORY_MANAGER
+#endif
+
+// -----------------------------------------------------------------------------
+// Definitions
+// -----------------------------------------------------------------------------
+
+//
+// TLB Shootdown
+//
+// The VMM cannot send IPIs / NMIs to other CPUs to flush their TLBs as the
+// other CPUs are executing the guest, and interrupting them is expensive
+// (and in some cases, not possible). Instead, when a virtual address range
+// is unmapped, the range is published to a global queue, and each CPU
+// drains this queue (i.e. flushes its own TLB) on its next VM exit, before
+// any exit handlers are executed. Since a CPU does not touch the VMM's
+// mappings while the guest is executing, this is all that is needed to
+// ensure a stale TLB entry is never used.
+//
+// Each range is published once (i.e. invalidations are batched per unmap,
+// not per page). A CPU that has fallen too far behind, or that has a large
+// range to invalidate, flushes its entire TLB instead.
+//
+
+namespace bfvmm
+{
+namespace x64
+{
+
+/// TLB Shootdown
+///
+/// Publishes a virtual address range whose mappings have been removed so
+/// that every CPU flushes it from its TLB on its next VM exit. Note that the
+/// local TLB is also flushed by this function.
+///
+/// @expects none
+/// @ensures none
+///
+/// @param virt the starting virtual address of the range
+/// @param size the size of the range in bytes
+///
+EXPORT_MEMORY_MANAGER void tlb_shootdown(uintptr_t virt, std::size_t size) noexcept;
+
+/// TLB Shootdown Drain
+///
+/// Flushes any ranges that have been published since the last time the
+/// current CPU drained the queue. This should be called on each VM exit.
+///
+/// @expects none
+/// @ensures none
+///
+EXPORT_MEMORY_MANAGER void tlb_shootdown_drain() noexcept;
+
+}
+}
+
+#endif
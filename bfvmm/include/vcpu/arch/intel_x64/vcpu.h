@@ -41,6 +41,11 @@ public:
 
     /// Default Constructor
     ///
+    /// Allocates the vCPU's VMCS and exit handler. Nothing is written to the
+    /// VMCS, and VMX operation is not enabled until the vCPU is run, which
+    /// means a vCPU can be created (i.e. prepared) before the VMM is started,
+    /// and on a different CPU than the one it will run on.
+    ///
     /// @expects none
     /// @ensures none
     ///
@@ -49,16 +54,20 @@ public:
     vcpu(vcpuid::type id) :
         bfvmm::vcpu{id}
     {
-        if (this->is_host_vm_vcpu()) {
-            m_vmx = std::make_unique<intel_x64::vmx>();
+        if (::intel_x64::cpuid::feature_information::ecx::vmx::is_disabled()) {
+            throw std::runtime_error("VMX extensions not supported");
         }
 
         m_vmcs = std::make_unique<bfvmm::intel_x64::vmcs>(id);
-        m_exit_handler = std::make_unique<bfvmm::intel_x64::exit_handler>(m_vmcs.get());
+        m_exit_handler = std::make_unique<bfvmm::intel_x64::exit_handler>(m_vmcs.get(), true);
 
         this->add_run_delegate(
             run_delegate_t::create<intel_x64::vcpu, &intel_x64::vcpu::run_delegate>(this)
         );
+
+        this->add_hlt_delegate(
+            hlt_delegate_t::create<intel_x64::vcpu, &intel_x64::vcpu::hlt_delegate>(this)
+        );
     }
 
     /// Destructor
@@ -74,6 +83,11 @@ public:
     /// does not "resume" a vCPU as the base implementation does not support
     /// guest VMs.
     ///
+    /// VMX operation is enabled (for the host VM), and the VMCS is written
+    /// here, and not when the vCPU is created, as both depend on the state of
+    /// the CPU that the vCPU is run on. The VMCS is cleared first so that a
+    /// vCPU that was halted (e.g. suspended) can be launched again.
+    ///
     /// @expects none
     /// @ensures none
     ///
@@ -83,10 +97,35 @@ public:
     {
         bfignored(obj);
 
+        if (this->is_host_vm_vcpu() && !m_vmx) {
+            m_vmx = std::make_unique<intel_x64::vmx>();
+        }
+
+        m_vmcs->clear();
+        m_exit_handler->write_state();
+
         m_vmcs->load();
         m_vmcs->launch();
     }
 
+    /// Halt Delegate
+    ///
+    /// Disables VMX operation (for the host VM), which promotes the host OS
+    /// out of the VM (see handle_vmxoff). The VMCS and exit handler are kept,
+    /// which means a halted vCPU can be run again without being recreated
+    /// (e.g. when the system is suspended and then resumed).
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @param obj ignored
+    ///
+    void hlt_delegate(bfobject *obj)
+    {
+        bfignored(obj);
+        m_vmx.reset();
+    }
+
     /// Get VMCS
     ///
     /// @expects none
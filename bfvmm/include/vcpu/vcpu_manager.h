@@ -133,6 +133,17 @@ public:
     virtual void hlt_vcpu(
         vcpuid::type vcpuid, bfobject *obj = nullptr);
 
+    /// vCPU Exists
+    ///
+    /// @expects none
+    /// @ensures none
+    ///
+    /// @param vcpuid the vcpu to look for
+    /// @return true if the vCPU has been created (and has not been deleted),
+    ///     false otherwise
+    ///
+    virtual bool vcpu_exists(vcpuid::type vcpuid);
+
     /// Set Factory
     ///
     /// Should only be used by unit tests
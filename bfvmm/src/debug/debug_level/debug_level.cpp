@@ -0,0 +1,62 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#include <debug/debug_level/debug_level.h>
+
+// -----------------------------------------------------------------------------
+// Global
+// -----------------------------------------------------------------------------
+
+/// \cond
+
+// Each entry is naturally aligned, and is written with a single store, which
+// means a CPU reading its subsystem's debug level will either see the old
+// level or the new level. No lock is needed as there is nothing else to keep
+// consistent with the debug level.
+
+int64_t g_bfdebug_levels[BFDEBUG_SUBSYSTEM_NUM] = {
+    DEBUG_LEVEL,
+    DEBUG_LEVEL,
+    DEBUG_LEVEL,
+    DEBUG_LEVEL,
+    DEBUG_LEVEL
+};
+
+/// \endcond
+
+static_assert(BFDEBUG_SUBSYSTEM_NUM == 5, "g_bfdebug_levels must be initialized for each subsystem");
+
+extern "C" int64_t
+set_debug_level(uint64_t subsystem, int64_t level) noexcept
+{
+    if (subsystem == BFDEBUG_SUBSYSTEM_ALL) {
+        for (auto &entry : g_bfdebug_levels) {
+            entry = level;
+        }
+
+        return SET_DEBUG_LEVEL_SUCCESS;
+    }
+
+    if (subsystem >= BFDEBUG_SUBSYSTEM_NUM) {
+        return SET_DEBUG_LEVEL_FAILURE;
+    }
+
+    g_bfdebug_levels[subsystem] = level;
+    return SET_DEBUG_LEVEL_SUCCESS;
+}
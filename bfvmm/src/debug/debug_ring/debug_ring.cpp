@@ -19,6 +19,10 @@
 #include <bfgsl.h>
 
 #include <map>
+#include <atomic>
+#include <cstring>
+#include <algorithm>
+
 #include <debug/debug_ring/debug_ring.h>
 
 // -----------------------------------------------------------------------------
@@ -46,12 +50,15 @@ get_drr(uint64_t vcpuid, struct debug_ring_resources_t **drr) noexcept
         return GET_DRR_FAILURE;
     }
 
-    if (auto found_drr = drr_map()[vcpuid]) {
-        *drr = found_drr;
-        return GET_DRR_SUCCESS;
+    std::lock_guard<std::mutex> guard(g_debug_mutex);
+
+    auto iter = drr_map().find(vcpuid);
+    if (iter == drr_map().end() || iter->second == nullptr) {
+        return GET_DRR_FAILURE;
     }
 
-    return GET_DRR_FAILURE;
+    *drr = iter->second;
+    return GET_DRR_SUCCESS;
 }
 
 // -----------------------------------------------------------------------------
@@ -61,19 +68,30 @@ get_drr(uint64_t vcpuid, struct debug_ring_resources_t **drr) noexcept
 namespace bfvmm
 {
 
-debug_ring::debug_ring(vcpuid::type vcpuid) noexcept
+debug_ring::debug_ring(vcpuid::type vcpuid, uint64_t size) noexcept
 {
     try {
         m_vcpuid = vcpuid;
-        m_drr = std::make_unique<debug_ring_resources_t>();
 
-        m_drr->epos = 0;
-        m_drr->spos = 0;
-        m_drr->tag1 = 0xDB60DB60DB60DB60;
-        m_drr->tag2 = 0x06BD06BD06BD06BD;
+        if (debug_ring_size_valid(size) == 0) {
+            size = DEBUG_RING_SIZE;
+        }
+
+        // The header and the buffer are allocated together, rounded up to
+        // whole pages so that the allocation comes from the page pool and
+        // is page aligned (i.e. it can be mapped by the driver).
+        //
+
+        auto total = (debug_ring_total_size(size) + MAX_PAGE_SIZE - 1) & ~(MAX_PAGE_SIZE - 1);
+        m_mem = std::make_unique<char[]>(total);
+
+        auto drr = this->drr();
+        drr->tag1 = DEBUG_RING_TAG1;
+        drr->len = size;
+        drr->tag2 = DEBUG_RING_TAG2;
 
         std::lock_guard<std::mutex> guard(g_debug_mutex);
-        drr_map()[vcpuid] = m_drr.get();
+        drr_map()[vcpuid] = drr;
     }
     catch (...)
     { }
@@ -87,71 +105,100 @@ debug_ring::~debug_ring() noexcept
 
 void
 debug_ring::write(const std::string &str) noexcept
+{ this->write(nullptr, 0, str.data(), str.length()); }
+
+void
+debug_ring::write(const char *str, size_t len) noexcept
+{ this->write(nullptr, 0, str, len); }
+
+void
+debug_ring::write(
+    const char *prefix, size_t prefix_len, const char *str, size_t len) noexcept
 {
     try {
 
-        // TODO: A more interesting implementation would use an optimized
-        //       memcpy to implement this code. Doing so would increase it's
-        //       performance, but would require some better math, and an
-        //       optimized memcpy that used both rep string instructions and
-        //       SIMD instructions
-
-        expects(m_drr);
-        expects(str.length() > 0);
-        expects(str.length() < DEBUG_RING_SIZE);
-
-        // The length that we were given is equivalent to strlen, which does not
-        // include the '\0', so we add one to the length to account for that.
-        auto len = str.length() + 1;
-
-        auto epos = m_drr->epos & (DEBUG_RING_SIZE - 1);
-        auto cpos = m_drr->spos & (DEBUG_RING_SIZE - 1);
-        auto space = DEBUG_RING_SIZE - (m_drr->epos - m_drr->spos);
-
-        if (space < len) {
-
-            // Make room for the write. Normally, with a circular buffer, you
-            // would just move the start position when a read occurs, but in
-            // this case, the vmm needs to be able to write as it wishes to the
-            // buffer. If we just move the start position based on the amount
-            // of space we need, you would end up with the first string being
-            // cropped once the ring wraps. The following code makes sure that
-            // we are making room by removing complete strings.
-            //
-            // Note: There is still a race condition with this code. If the
-            //       reader reads at the same time we are writing, you could
-            //       end up with a cropped string for the first string, but
-            //       that's fine, as this is just debug text, and if we add
-            //       locks, we would greatly increase the complexity of this
-            //       code, while serializing the code, which is not a good idea.
-            //
-
-            while (space <= DEBUG_RING_SIZE) {
-                if (cpos >= DEBUG_RING_SIZE) {
-                    cpos = 0;
-                }
-
-                space++;
-                m_drr->spos++;
-
-                if (gsl::at(m_drr->buf, cpos) == '\0' && space >= len) {
-                    break;
-                }
-
-                gsl::at(m_drr->buf, cpos++) = '\0';
+        expects(m_mem);
+        expects(str != nullptr);
+        expects(prefix != nullptr || prefix_len == 0);
+        expects(prefix_len + len > 0);
+
+        auto drr = this->drr();
+        auto buf = debug_ring_buf(drr);
+        auto ring = drr->len;
+
+        expects(prefix_len + len < ring);
+
+        // The lengths that we were given are equivalent to strlen, which do
+        // not include the '\0', so we add one to the length to account for that.
+        auto total = prefix_len + len + 1;
+        auto space = ring - (drr->epos - drr->spos);
+
+        // Make room for the write. Normally, with a circular buffer, you
+        // would just move the start position when a read occurs, but in
+        // this case, the vmm needs to be able to write as it wishes to the
+        // buffer. If we just move the start position based on the amount
+        // of space we need, you would end up with the first string being
+        // cropped once the ring wraps. The following code makes sure that
+        // we are making room by removing complete strings, searching for
+        // the end of each string using memchr, one contiguous region of the
+        // ring at a time.
+        //
+        // Note: There is still a race condition with this code. If the
+        //       reader reads at the same time we are writing, you could
+        //       end up with a cropped string for the first string, but
+        //       that's fine, as this is just debug text, and if we add
+        //       locks, we would greatly increase the complexity of this
+        //       code, while serializing the code, which is not a good idea.
+        //
+
+        while (space < total) {
+            auto cpos = drr->spos & (ring - 1);
+            auto size = std::min<uint64_t>(ring - cpos, ring - space);
+
+            auto region = buf + cpos;
+            auto found = static_cast<const char *>(std::memchr(region, '\0', size));
+
+            if (found != nullptr) {
+                size = static_cast<decltype(size)>(found - region) + 1;
             }
+
+            space += size;
+            drr->spos += size;
         }
 
-        for (auto i = 0U; i < len; i++) {
-            if (epos >= DEBUG_RING_SIZE) {
-                epos = 0;
+        // The prefix and the string (including its '\0') are each copied
+        // using at most two copies, one up to the end of the ring, and one
+        // from the start of the ring if they wrap. The fences ensure that the
+        // reader never sees a start position that is older than the data
+        // that has been overwritten, or an end position that is newer than
+        // the data that has been written.
+        //
+
+        std::atomic_thread_fence(std::memory_order_release);
+
+        auto epos = drr->epos;
+        auto copy = [&](const char *src, size_t size) {
+            auto pos = epos & (ring - 1);
+            auto head = std::min<uint64_t>(size, ring - pos);
+
+            std::memcpy(buf + pos, src, head);
+
+            if (head < size) {
+                std::memcpy(buf, src + head, size - head);
             }
 
-            gsl::at(m_drr->buf, epos) = str[i];
+            epos += size;
+        };
 
-            epos++;
-            m_drr->epos++;
+        if (prefix_len > 0) {
+            copy(prefix, prefix_len);
         }
+
+        copy(str, len);
+        copy("", 1);
+
+        std::atomic_thread_fence(std::memory_order_release);
+        drr->epos += total;
     }
     catch (...) { }
 }
@@ -21,6 +21,8 @@
 #include <bfsupport.h>
 #include <debug/serial/serial_port_ns16550a.h>
 
+static_assert((SERIAL_TX_RING_SIZE & (SERIAL_TX_RING_SIZE - 1)) == 0, "SERIAL_TX_RING_SIZE must be a power of 2");
+
 namespace bfvmm
 {
 
@@ -219,10 +221,134 @@ serial_port_ns16550a::parity_bits() const noexcept
 void
 serial_port_ns16550a::write(char c) noexcept
 {
-    while (!get_line_status_empty_transmitter())
-    { }
+    this->queue(&c, 1);
+    this->transmit();
+}
+
+void
+serial_port_ns16550a::write(const std::string &str) noexcept
+{
+    this->queue(str.data(), str.length());
+    this->transmit();
+}
+
+void
+serial_port_ns16550a::write(const char *str, size_t len) noexcept
+{
+    this->queue(str, len);
+    this->transmit();
+}
+
+// drain() is called on every VM exit, so the TX ring is checked before the
+// lock is taken. Only the CPU that holds the lock changes the positions, and
+// the check is repeated once the lock is held, so a stale read only means
+// that the drain is skipped, or attempted for nothing.
+//
+
+void
+serial_port_ns16550a::drain() noexcept
+{
+    if (this->empty()) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(m_tx_mutex, std::try_to_lock);
+
+    if (!lock.owns_lock() || this->empty()) {
+        return;
+    }
+
+    if (!get_line_status_empty_transmitter()) {
+        return;
+    }
+
+    this->fill_fifo();
+}
+
+void
+serial_port_ns16550a::flush() noexcept
+{
+    std::lock_guard<std::mutex> guard(m_tx_mutex);
+
+    while (!this->empty()) {
+        while (!get_line_status_empty_transmitter())
+        { }
+
+        this->fill_fifo();
+    }
+}
+
+void
+serial_port_ns16550a::begin_synchronous() noexcept
+{ m_synchronous++; }
+
+void
+serial_port_ns16550a::end_synchronous() noexcept
+{
+    m_synchronous--;
+    this->flush();
+}
+
+void
+serial_port_ns16550a::transmit() noexcept
+{
+    if (m_synchronous != 0) {
+        this->flush();
+        return;
+    }
+
+    this->drain();
+}
+
+bool
+serial_port_ns16550a::empty() const noexcept
+{
+    return m_tx_spos.load(std::memory_order_relaxed) ==
+           m_tx_epos.load(std::memory_order_relaxed);
+}
+
+void
+serial_port_ns16550a::fill_fifo() noexcept
+{
+    auto spos = m_tx_spos.load(std::memory_order_relaxed);
+    auto epos = m_tx_epos.load(std::memory_order_relaxed);
+
+    for (auto i = 0ULL; i < fifo_size && spos != epos; i++, spos++) {
+        auto c = gsl::at(m_tx_buf, spos & (SERIAL_TX_RING_SIZE - 1));
+        offset_outb(0, gsl::narrow_cast<value_type_8>(c));
+    }
+
+    m_tx_spos.store(spos, std::memory_order_relaxed);
+}
+
+void
+serial_port_ns16550a::queue(const char *str, size_t len) noexcept
+{
+    if (str == nullptr || len == 0) {
+        return;
+    }
+
+    if (len > SERIAL_TX_RING_SIZE) {
+        str += len - SERIAL_TX_RING_SIZE;
+        len = SERIAL_TX_RING_SIZE;
+    }
+
+    std::lock_guard<std::mutex> guard(m_tx_mutex);
+    auto epos = m_tx_epos.load(std::memory_order_relaxed);
+
+    gsl::cstring_span<> span(str, gsl::narrow_cast<std::ptrdiff_t>(len));
+    for (auto c : span) {
+        gsl::at(m_tx_buf, epos++ & (SERIAL_TX_RING_SIZE - 1)) = c;
+    }
+
+    // Drop the oldest characters if the TX ring overflowed. Logging must
+    // never wait on the UART.
+
+    if (epos - m_tx_spos.load(std::memory_order_relaxed) > SERIAL_TX_RING_SIZE) {
+        m_tx_spos.store(epos - SERIAL_TX_RING_SIZE, std::memory_order_relaxed);
+    }
 
-    offset_outb(0, gsl::narrow_cast<value_type_8>(c));
+    m_tx_epos.store(epos, std::memory_order_relaxed);
 }
 
 void
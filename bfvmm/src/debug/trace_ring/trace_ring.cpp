@@ -0,0 +1,114 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include <map>
+#include <array>
+#include <mutex>
+
+#include <bfexception.h>
+#include <bfthreadcontext.h>
+#include <debug/trace_ring/trace_ring.h>
+
+// -----------------------------------------------------------------------------
+// Mutex
+// -----------------------------------------------------------------------------
+
+std::mutex g_trace_mutex;
+
+// -----------------------------------------------------------------------------
+// Global
+// -----------------------------------------------------------------------------
+
+/// \cond
+
+// Note that the trace rings are only ever created at runtime, so unlike the
+// debug rings, the list of registered trace rings does not need to be a
+// function-local static. It just needs to be defined before (and therefore
+// destroyed after) the trace rings that unregister from it.
+
+std::map<uint64_t, trace_ring_resources_t *> g_trrs;
+std::array<std::unique_ptr<bfvmm::trace_ring>, MAX_TRACE_RING_CPUS> g_trace_rings;
+
+/// \endcond
+
+static_assert((TRACE_RING_SIZE & (TRACE_RING_SIZE - 1)) == 0, "TRACE_RING_SIZE must be a power of 2");
+
+extern "C" int64_t
+get_trr(uint64_t cpuid, struct trace_ring_resources_t **trr) noexcept
+{
+    if (trr == nullptr) {
+        return GET_TRR_FAILURE;
+    }
+
+    std::lock_guard<std::mutex> guard(g_trace_mutex);
+
+    auto iter = g_trrs.find(cpuid);
+    if (iter == g_trrs.end()) {
+        return GET_TRR_FAILURE;
+    }
+
+    *trr = iter->second;
+    return GET_TRR_SUCCESS;
+}
+
+// -----------------------------------------------------------------------------
+// Trace Ring Implementation
+// -----------------------------------------------------------------------------
+
+namespace bfvmm
+{
+
+trace_ring::trace_ring(cpuid_type cpuid) :
+    m_cpuid(cpuid),
+    m_trr(std::make_unique<trace_ring_resources_t>())
+{
+    m_trr->epos = 0;
+    m_trr->tag1 = 0x7ACE7ACE7ACE7ACE;
+    m_trr->tag2 = 0xECA7ECA7ECA7ECA7;
+
+    std::lock_guard<std::mutex> guard(g_trace_mutex);
+    g_trrs[cpuid] = m_trr.get();
+}
+
+trace_ring::~trace_ring() noexcept
+{
+    std::lock_guard<std::mutex> guard(g_trace_mutex);
+    g_trrs.erase(m_cpuid);
+}
+
+trace_ring *
+cpu_trace_ring() noexcept
+{
+    auto cpuid = thread_context_cpuid();
+
+    if (cpuid >= MAX_TRACE_RING_CPUS) {
+        return nullptr;
+    }
+
+    auto &tr = g_trace_rings[cpuid];
+
+    if (!tr) {
+        guard_exceptions([&] {
+            tr = std::make_unique<trace_ring>(cpuid);
+        });
+    }
+
+    return tr.get();
+}
+
+}
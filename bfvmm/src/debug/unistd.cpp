@@ -18,11 +18,18 @@
 
 #include <bfgsl.h>
 #include <bfexports.h>
+#include <bfsupport.h>
+#include <bfthreadcontext.h>
+
+#include <intrinsics.h>
 
 #include <debug/debug_ring/debug_ring.h>
 #include <debug/serial/serial_port_ns16550a.h>
 #include <debug/serial/serial_port_pl011.h>
 
+#include <array>
+#include <memory>
+
 #include <mutex>
 std::mutex g_write_mutex;
 
@@ -30,29 +37,164 @@ extern "C" EXPORT_SYM void
 unlock_write(void)
 { g_write_mutex.unlock(); }
 
+// -----------------------------------------------------------------------------
+// Debug Rings
+// -----------------------------------------------------------------------------
+
+// Each CPU writes to its own debug ring, which means that writing to the
+// debug ring does not require a lock. CPUs that do not have their own debug
+// ring (i.e. thread_context_cpuid() >= MAX_DEBUG_RING_CPUS) share the
+// original, global debug ring and must hold g_write_mutex to use it. Note
+// that the serial port is still shared by all of the CPUs.
+//
+
+// The size of the debug rings is provided by the driver when the VMM is
+// loaded. The platform info is copied before any global constructors are
+// executed, so it is available the first time a debug ring is created.
+//
+
+static uint64_t
+debug_ring_size() noexcept
+{
+    auto size = get_platform_info()->debug_ring_size;
+    return debug_ring_size_valid(size) != 0 ? size : DEBUG_RING_SIZE;
+}
+
 static auto
 g_debug_ring() noexcept
 {
-    static bfvmm::debug_ring dr{vcpuid::invalid};
+    static bfvmm::debug_ring dr{vcpuid::invalid, debug_ring_size()};
     return &dr;
 }
 
+static auto &
+g_debug_rings() noexcept
+{
+    // The global debug ring is created first, which ensures the list of
+    // registered debug rings is created before (and therefore destroyed
+    // after) the per-CPU debug rings, as they unregister when destroyed.
+
+    g_debug_ring();
+
+    static std::array<std::unique_ptr<bfvmm::debug_ring>, MAX_DEBUG_RING_CPUS> drs;
+    return drs;
+}
+
+static auto &
+g_channel_rings() noexcept
+{
+    g_debug_ring();
+
+    using rings_type = std::array<std::unique_ptr<bfvmm::debug_ring>, MAX_DEBUG_RING_CPUS>;
+    static std::array<rings_type, DEBUG_RING_NUM_CHANNELS> drs;
+
+    return drs;
+}
+
+static bfvmm::debug_ring *
+lazy_debug_ring(std::unique_ptr<bfvmm::debug_ring> &dr, vcpuid::type id) noexcept
+{
+    if (!dr) {
+        try {
+            dr = std::make_unique<bfvmm::debug_ring>(id, debug_ring_size());
+        }
+        catch (...)
+        { }
+    }
+
+    return dr.get();
+}
+
+static bfvmm::debug_ring *
+cpu_debug_ring() noexcept
+{
+    auto cpuid = thread_context_cpuid();
+
+    if (cpuid >= MAX_DEBUG_RING_CPUS) {
+        return nullptr;
+    }
+
+    return lazy_debug_ring(g_debug_rings()[cpuid], DEBUG_RING_CPUID(cpuid));
+}
+
+// Channels (see DEBUG_RING_CHANNEL) only have per-CPU debug rings. A CPU
+// without its own debug ring has nowhere to write, and its channel output
+// is dropped, as there is no reader that expects it to be serialized.
+//
+
+static bfvmm::debug_ring *
+cpu_channel_ring(int file) noexcept
+{
+    auto cpuid = thread_context_cpuid();
+
+    if (cpuid >= MAX_DEBUG_RING_CPUS) {
+        return nullptr;
+    }
+
+    auto &drs = g_channel_rings()[static_cast<std::size_t>(file - DEBUG_RING_CHANNEL_FIRST)];
+    return lazy_debug_ring(drs[cpuid], DEBUG_RING_CHANNEL(file, cpuid));
+}
+
+static auto
+stamp() noexcept
+{
+    constexpr const auto digits = "0123456789abcdef";
+
+    std::array<char, DEBUG_RING_STAMP_SIZE> stamped;
+    stamped.front() = DEBUG_RING_STAMP_MARKER;
+
+    auto tsc = ::x64::read_tsc::get();
+    for (auto i = DEBUG_RING_STAMP_DIGITS; i > 0; i--, tsc >>= 4) {
+        stamped.at(i) = digits[tsc & 0xF];
+    }
+
+    return stamped;
+}
+
 extern "C" EXPORT_SYM uint64_t
-write_str(const std::string &str)
+write_buf(const char *str, uint64_t len)
 {
+    if (str == nullptr || len == 0) {
+        return 0;
+    }
+
     try {
-        std::lock_guard<std::mutex> guard(g_write_mutex);
+        if (auto dr = cpu_debug_ring()) {
+            auto stamped = stamp();
+            dr->write(stamped.data(), stamped.size(), str, len);
+        }
+        else {
+            std::lock_guard<std::mutex> guard(g_write_mutex);
+            g_debug_ring()->write(str, len);
+        }
 
-        g_debug_ring()->write(str);
-        bfvmm::DEFAULT_COM_DRIVER::instance()->write(str);
+        std::lock_guard<std::mutex> guard(g_write_mutex);
+        bfvmm::DEFAULT_COM_DRIVER::instance()->write(str, len);
 
-        return str.length();
+        return len;
     }
     catch (...) {
         return 0;
     }
 }
 
+static uint64_t
+write_channel(int file, const char *str, uint64_t len) noexcept
+{
+    if (auto dr = cpu_channel_ring(file)) {
+        auto stamped = stamp();
+        dr->write(stamped.data(), stamped.size(), str, len);
+
+        return len;
+    }
+
+    return 0;
+}
+
+extern "C" EXPORT_SYM uint64_t
+write_str(const std::string &str)
+{ return write_buf(str.data(), str.length()); }
+
 extern "C" EXPORT_SYM int
 write(int file, const void *buffer, size_t count)
 {
@@ -60,9 +202,15 @@ write(int file, const void *buffer, size_t count)
         return 0;
     }
 
-    if (file != 1 && file != 2) {
-        return 0;
+    auto str = static_cast<const char *>(buffer);
+
+    if (file == 1 || file == 2) {
+        return gsl::narrow_cast<int>(write_buf(str, count));
+    }
+
+    if (file >= DEBUG_RING_CHANNEL_FIRST && file < DEBUG_RING_CHANNEL_FIRST + DEBUG_RING_NUM_CHANNELS) {
+        return gsl::narrow_cast<int>(write_channel(file, str, count));
     }
 
-    return gsl::narrow_cast<int>(write_str(std::string(static_cast<const char *>(buffer), count)));
+    return 0;
 }
@@ -26,10 +26,13 @@
 
 #include <vcpu/vcpu_manager.h>
 #include <debug/debug_ring/debug_ring.h>
+#include <debug/debug_level/debug_level.h>
+#include <debug/trace_ring/trace_ring.h>
+#include <debug/serial/serial_port_ns16550a.h>
 #include <memory_manager/memory_manager.h>
 
 extern "C" int64_t
-private_add_md(struct memory_descriptor *md) noexcept
+private_add_md(struct memory_descriptor *md, uint64_t size) noexcept
 {
     return guard_exceptions(MEMORY_MANAGER_FAILURE, [&] {
 
@@ -37,7 +40,13 @@ private_add_md(struct memory_descriptor *md) noexcept
         auto phys = static_cast<bfvmm::memory_manager::integer_pointer>(md->phys);
         auto type = static_cast<bfvmm::memory_manager::attr_type>(md->type);
 
-        g_mm->add_md(virt, phys, type);
+        auto offset = 0ULL;
+
+        do {
+            g_mm->add_md(virt + offset, phys + offset, type);
+            offset += MAX_PAGE_SIZE;
+        }
+        while (offset < size);
     });
 }
 
@@ -49,12 +58,36 @@ bfobject *
 WEAK_SYM pre_run_vcpu(vcpuid::type id)
 { (void) id; return nullptr; }
 
+// vCPUs are prepared (i.e. created) by the driver when the VMM is loaded,
+// on all of the CPUs at the same time, so that starting the VMM only has to
+// run each vCPU. If a vCPU was not prepared (e.g. its CPU was offline when
+// the VMM was loaded, or the VMM was stopped, which deletes the vCPUs), it
+// is created when the VMM is started, as it was before. Note that a vCPU
+// that is prepared, but never run, only holds memory from the VMM's heap,
+// which is released when the VMM is unloaded.
+//
+
+extern "C" int64_t
+private_prepare_vmm(uint64_t arg) noexcept
+{
+    return guard_exceptions(ENTRY_ERROR_VMM_INIT_FAILED, [&]() {
+
+        if (!g_vcm->vcpu_exists(arg)) {
+            g_vcm->create_vcpu(arg, pre_create_vcpu(arg));
+        }
+
+        return ENTRY_SUCCESS;
+    });
+}
+
 extern "C" int64_t
 private_init_vmm(uint64_t arg) noexcept
 {
     return guard_exceptions(ENTRY_ERROR_VMM_START_FAILED, [&]() {
 
-        g_vcm->create_vcpu(arg, pre_create_vcpu(arg));
+        if (!g_vcm->vcpu_exists(arg)) {
+            g_vcm->create_vcpu(arg, pre_create_vcpu(arg));
+        }
 
         auto ___ = gsl::on_failure([&]
         { g_vcm->delete_vcpu(arg); });
@@ -85,29 +118,74 @@ private_fini_vmm(uint64_t arg) noexcept
     });
 }
 
+// Suspending a vCPU halts it, which disables VMX operation (see the intel_x64
+// vCPU's hlt delegate), but does not delete it. The driver resumes a vCPU
+// using BF_REQUEST_VMM_INIT, which runs the vCPU that already exists.
+//
+
+extern "C" int64_t
+private_suspend_vmm(uint64_t arg) noexcept
+{
+    return guard_exceptions(ENTRY_ERROR_VMM_STOP_FAILED, [&]() {
+
+        g_vcm->hlt_vcpu(arg, pre_hlt_vcpu(arg));
+
+        return ENTRY_SUCCESS;
+    });
+}
+
+// Serial output is drained on VM exits (see serial_port_ns16550a). While a
+// request from the driver is handled, the CPU is not running a guest, so
+// there might not be another VM exit to drain what is written (e.g. when a
+// vCPU fails to launch, or the VMM stops or is unloaded), and a large dump
+// would overrun the serial port's TX ring. Serial output is therefore
+// written synchronously until the request is complete.
+//
+
+static void
+end_synchronous_serial() noexcept
+{ bfvmm::DEFAULT_COM_DRIVER::instance()->end_synchronous(); }
+
 extern "C" int64_t
 bfmain(uintptr_t request, uintptr_t arg1, uintptr_t arg2, uintptr_t arg3)
 {
     bfignored(arg2);
     bfignored(arg3);
 
+    bfvmm::DEFAULT_COM_DRIVER::instance()->begin_synchronous();
+    auto ___ = gsl::finally(end_synchronous_serial);
+
     switch (request) {
         case BF_REQUEST_INIT:
+            return ENTRY_SUCCESS;
+
         case BF_REQUEST_FINI:
             return ENTRY_SUCCESS;
 
         case BF_REQUEST_ADD_MDL:
-            return private_add_md(reinterpret_cast<memory_descriptor *>(arg1));
+            return private_add_md(reinterpret_cast<memory_descriptor *>(arg1), arg2);
 
         case BF_REQUEST_GET_DRR:
             return get_drr(arg1, reinterpret_cast<debug_ring_resources_t **>(arg2));
 
+        case BF_REQUEST_GET_TRR:
+            return get_trr(arg1, reinterpret_cast<trace_ring_resources_t **>(arg2));
+
+        case BF_REQUEST_SET_DEBUG_LEVEL:
+            return set_debug_level(arg1, static_cast<int64_t>(arg2));
+
         case BF_REQUEST_VMM_INIT:
             return private_init_vmm(arg1);
 
         case BF_REQUEST_VMM_FINI:
             return private_fini_vmm(arg1);
 
+        case BF_REQUEST_VMM_PREPARE:
+            return private_prepare_vmm(arg1);
+
+        case BF_REQUEST_VMM_SUSPEND:
+            return private_suspend_vmm(arg1);
+
         default:
             break;
     }
@@ -24,6 +24,9 @@
 #include <intrinsics.h>
 #include <memory_manager/memory_manager.h>
 
+#undef BFDEBUG_SUBSYSTEM
+#define BFDEBUG_SUBSYSTEM BFDEBUG_SUBSYSTEM_VMCS
+
 /// Intel x86_64 VMCS Check Controls
 ///
 /// This namespace implements the control checks found in
@@ -50,7 +53,7 @@ control_reserved_properly_set(
     ctls &= 0x00000000FFFFFFFFULL;
 
     if ((allowed0 & ctls) != allowed0) {
-        bfdebug_transaction(0, [&](std::string * msg) {
+        bfdebug_transaction(0, [&](bfdebug_msg_t * msg) {
             bferror_info(0, "failed: controls_reserved_properly_set", msg);
             bferror_subnhex(0, "allowed0", allowed0, msg);
             bferror_subnhex(0, "bad ctls", ctls, msg);
@@ -66,7 +69,7 @@ control_reserved_properly_set(
     }
 
     if (allowed1_failed) {
-        bfdebug_transaction(0, [&](std::string * msg) {
+        bfdebug_transaction(0, [&](bfdebug_msg_t * msg) {
             bferror_info(0, "failed: controls_reserved_properly_set", msg);
             bferror_subnhex(0, "allowed1", allowed1, msg);
             bferror_subnhex(0, "bad ctls", ctls, msg);
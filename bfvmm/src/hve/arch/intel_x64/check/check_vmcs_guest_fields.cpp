@@ -24,6 +24,9 @@
 #include <intrinsics.h>
 #include <memory_manager/memory_manager.h>
 
+#undef BFDEBUG_SUBSYSTEM
+#define BFDEBUG_SUBSYSTEM BFDEBUG_SUBSYSTEM_VMCS
+
 /// Intel x86_64 VMCS Check Guest
 ///
 /// This namespace implements the guest checks found in
@@ -49,7 +52,7 @@ guest_cr0_for_unsupported_bits()
     }
 
     if (0 != ((~cr0 & ia32_vmx_cr0_fixed0) | (cr0 & ~ia32_vmx_cr0_fixed1))) {
-        bfdebug_transaction(0, [&](std::string * msg) {
+        bfdebug_transaction(0, [&](bfdebug_msg_t * msg) {
             bferror_info(0, "failed: check_guest_cr0_for_unsupported_bits", msg);
             bferror_subnhex(0, "ia32_vmx_cr0_fixed0", ia32_vmx_cr0_fixed0, msg);
             bferror_subnhex(0, "ia32_vmx_cr0_fixed1", ia32_vmx_cr0_fixed1, msg);
@@ -80,7 +83,7 @@ guest_cr4_for_unsupported_bits()
     auto ia32_vmx_cr4_fixed1 = ::intel_x64::msrs::ia32_vmx_cr4_fixed1::get();
 
     if (0 != ((~cr4 & ia32_vmx_cr4_fixed0) | (cr4 & ~ia32_vmx_cr4_fixed1))) {
-        bfdebug_transaction(0, [&](std::string * msg) {
+        bfdebug_transaction(0, [&](bfdebug_msg_t * msg) {
             bferror_info(0, "failed: check_guest_cr4_for_unsupported_bits", msg);
             bferror_subnhex(0, "ia32_vmx_cr4_fixed0", ia32_vmx_cr4_fixed0, msg);
             bferror_subnhex(0, "ia32_vmx_cr4_fixed1", ia32_vmx_cr4_fixed1, msg);
@@ -19,16 +19,26 @@
 #include <bfgsl.h>
 #include <bfdebug.h>
 #include <bfconstants.h>
+#include <bfsupport.h>
 #include <bfexception.h>
 #include <bferrorcodes.h>
 #include <bfthreadcontext.h>
+#include <bfstatusinterface.h>
+
+#include <debug/trace_ring/trace_ring.h>
+#include <debug/serial/serial_port_ns16550a.h>
 
 #include <hve/arch/intel_x64/check/check.h>
 #include <hve/arch/intel_x64/exit_handler/exit_handler.h>
 
 #include <memory_manager/memory_manager.h>
+#include <memory_manager/arch/x64/soft_tlb.h>
+#include <memory_manager/arch/x64/tlb_shootdown.h>
 #include <memory_manager/arch/x64/root_page_table.h>
 
+#undef BFDEBUG_SUBSYSTEM
+#define BFDEBUG_SUBSYSTEM BFDEBUG_SUBSYSTEM_EXIT_HANDLER
+
 // -----------------------------------------------------------------------------
 // C Prototypes
 // -----------------------------------------------------------------------------
@@ -74,9 +84,120 @@ halt(gsl::not_null<bfvmm::intel_x64::vmcs *> vmcs) noexcept
     bferror_subnhex(0, "rip", vmcs->save_state()->rip);
     bferror_subnhex(0, "rsp", vmcs->save_state()->rsp);
 
+    // There are no more VM exits on this CPU to drain the serial port
+
+    bfvmm::DEFAULT_COM_DRIVER::instance()->flush();
     ::x64::pm::stop();
 }
 
+// Each CPU only counts its own exits, which is why the counters in the
+// driver's status page can be incremented without a lock.
+//
+
+void
+count_exit() noexcept
+{
+    auto status = reinterpret_cast<vmm_status_t *>(get_platform_info()->status);
+    auto cpuid = thread_context_cpuid();
+
+    if (status == nullptr || cpuid >= MAX_VMM_STATUS_CPUS) {
+        return;
+    }
+
+    status->exits[cpuid].count++;
+}
+
+void
+trace_exit(
+    gsl::not_null<bfvmm::intel_x64::vmcs *> vmcs, ::intel_x64::vmcs::value_type reason)
+{
+    auto tr = bfvmm::cpu_trace_ring();
+    if (tr == nullptr) {
+        return;
+    }
+
+    tr->set_vcpuid(vmcs->save_state()->vcpuid);
+    tr->write(TRACE_EVENT_EXIT, reason, vmcs->save_state()->rip);
+}
+
+// The paging bits of CR0 and CR4 (i.e. the bits that change how the guest's
+// addresses are translated) that must be owned by the VMM for the soft TLB
+// to survive across exits (see exit_handler::enable_soft_tlb()).
+//
+
+constexpr const auto soft_tlb_cr0_paging_bits =
+    ::intel_x64::cr0::paging::mask |
+    ::intel_x64::cr0::write_protect::mask;
+
+constexpr const auto soft_tlb_cr4_paging_bits =
+    ::intel_x64::cr4::page_size_extensions::mask |
+    ::intel_x64::cr4::physical_address_extensions::mask |
+    ::intel_x64::cr4::page_global_enable::mask |
+    ::intel_x64::cr4::pcid_enable_bit::mask |
+    ::intel_x64::cr4::smep_enable_bit::mask |
+    ::intel_x64::cr4::smap_enable_bit::mask;
+
+void
+invalidate_soft_tlb(
+    gsl::not_null<bfvmm::intel_x64::vmcs *> vmcs, ::intel_x64::vmcs::value_type reason,
+    bool enabled)
+{
+    using namespace ::intel_x64::vmcs;
+    using namespace exit_qualification::control_register_access;
+
+    auto stlb = bfvmm::x64::cpu_soft_tlb();
+    if (stlb == nullptr) {
+        return;
+    }
+
+    stlb->set_vcpuid(vmcs->save_state()->vcpuid);
+
+    // Unless the soft TLB was enabled, the guest is able to flush its TLB,
+    // or change how its addresses are translated without trapping, so we
+    // have no way of knowing when the soft TLB is stale, and it only lives
+    // for the duration of a single exit.
+    //
+
+    if (!enabled) {
+        stlb->invalidate();
+        return;
+    }
+
+    switch (reason) {
+        case exit_reason::basic_exit_reason::control_register_accesses: {
+            auto qual = exit_qualification::control_register_access::get();
+
+            if (access_type::get(qual) != access_type::mov_to_cr) {
+                break;
+            }
+
+            switch (control_register_number::get(qual)) {
+                case 0:
+                case 3:
+                case 4:
+                    stlb->invalidate();
+                    break;
+
+                default:
+                    break;
+            }
+
+            break;
+        }
+
+        case exit_reason::basic_exit_reason::invlpg:
+            stlb->invalidate(exit_qualification::get());
+            break;
+
+        case exit_reason::basic_exit_reason::invpcid:
+            stlb->invalidate();
+            break;
+
+        default:
+            break;
+    }
+}
+
 bool
 advance(gsl::not_null<bfvmm::intel_x64::vmcs *> vmcs) noexcept
 {
@@ -230,6 +351,7 @@ handle_rdmsr(gsl::not_null<bfvmm::intel_x64::vmcs *> vmcs)
     vmcs->save_state()->rax = ((val >> 0x00) & 0x00000000FFFFFFFF);
     vmcs->save_state()->rdx = ((val >> 0x20) & 0x00000000FFFFFFFF);
 
+    bfvmm::trace(TRACE_EVENT_RDMSR, vmcs->save_state()->rcx, val);
     return advance(vmcs);
 }
 
@@ -246,6 +368,7 @@ handle_wrmsr(gsl::not_null<bfvmm::intel_x64::vmcs *> vmcs)
         val
     );
 
+    bfvmm::trace(TRACE_EVENT_WRMSR, vmcs->save_state()->rcx, val);
     return advance(vmcs);
 }
 
@@ -259,24 +382,59 @@ namespace intel_x64
 {
 
 exit_handler::exit_handler(
-    gsl::not_null<vmcs *> vmcs
+    gsl::not_null<vmcs *> vmcs,
+    bool deferred
 ) :
     m_vmcs{vmcs},
     m_stack{std::make_unique<gsl::byte[]>(STACK_SIZE * 2)}
 {
     using namespace ::intel_x64::vmcs;
 
-    m_vmcs->load();
     m_vmcs->save_state()->exit_handler_ptr = reinterpret_cast<uintptr_t>(this);
 
-    auto id = m_vmcs->save_state()->vcpuid;
-
     m_host_gdt.set(1, nullptr, 0xFFFFFFFF, ::x64::access_rights::ring0_cs_descriptor);
     m_host_gdt.set(2, nullptr, 0xFFFFFFFF, ::x64::access_rights::ring0_ss_descriptor);
     m_host_gdt.set(3, nullptr, 0xFFFFFFFF, ::x64::access_rights::ring0_fs_descriptor);
     m_host_gdt.set(4, nullptr, 0xFFFFFFFF, ::x64::access_rights::ring0_gs_descriptor);
     m_host_gdt.set(5, &m_host_tss, sizeof(m_host_tss), ::x64::access_rights::ring0_tr_descriptor);
 
+    add_handler(
+        exit_reason::basic_exit_reason::cpuid,
+        handler_delegate_t::create<handle_cpuid>()
+    );
+
+    add_handler(
+        exit_reason::basic_exit_reason::invd,
+        handler_delegate_t::create<handle_invd>()
+    );
+
+    add_handler(
+        exit_reason::basic_exit_reason::vmxoff,
+        handler_delegate_t::create<handle_vmxoff>()
+    );
+
+    add_handler(
+        exit_reason::basic_exit_reason::rdmsr,
+        handler_delegate_t::create<handle_rdmsr>()
+    );
+
+    add_handler(
+        exit_reason::basic_exit_reason::wrmsr,
+        handler_delegate_t::create<handle_wrmsr>()
+    );
+
+    if (!deferred) {
+        this->write_state();
+    }
+}
+
+void
+exit_handler::write_state()
+{
+    m_vmcs->load();
+
+    auto id = m_vmcs->save_state()->vcpuid;
+
     if (vcpuid::is_bootstrap_vcpu(id)) {
         s_ia32_pat_msr |= ::x64::pat::pat_value;
 
@@ -317,6 +475,11 @@ exit_handler::exit_handler(
         if (::intel_x64::cpuid::extended_feature_flags::subleaf0::ebx::smap::is_enabled()) {
             s_cr4 |= ::intel_x64::cr4::smap_enable_bit::mask;
         }
+
+        if (VMM_PCID != 0 && ::intel_x64::cpuid::feature_information::ecx::pcid::is_enabled()) {
+            s_cr3 |= VMM_PCID & 0xFFFULL;
+            s_cr4 |= ::intel_x64::cr4::pcid_enable_bit::mask;
+        }
     }
 
     this->write_host_state();
@@ -325,38 +488,34 @@ exit_handler::exit_handler(
     if (vcpuid::is_hvm_vcpu(id)) {
         this->write_guest_state();
     }
+}
 
-    add_handler(
-        exit_reason::basic_exit_reason::cpuid,
-        handler_delegate_t::create<handle_cpuid>()
-    );
+void
+exit_handler::add_handler(
+    ::intel_x64::vmcs::value_type reason,
+    handler_delegate_t &&d)
+{ m_handlers.at(reason).push_front(std::move(d)); }
 
-    add_handler(
-        exit_reason::basic_exit_reason::invd,
-        handler_delegate_t::create<handle_invd>()
-    );
+void
+exit_handler::enable_soft_tlb()
+{
+    using namespace ::intel_x64::vmcs;
+    using namespace primary_processor_based_vm_execution_controls;
 
-    add_handler(
-        exit_reason::basic_exit_reason::vmxoff,
-        handler_delegate_t::create<handle_vmxoff>()
-    );
+    // Note that INVPCID traps when INVLPG exiting is enabled.
+    //
 
-    add_handler(
-        exit_reason::basic_exit_reason::rdmsr,
-        handler_delegate_t::create<handle_rdmsr>()
-    );
+    expects(invlpg_exiting::is_enabled());
+    expects(cr3_load_exiting::is_enabled());
+    expects((cr0_guest_host_mask::get() & soft_tlb_cr0_paging_bits) == soft_tlb_cr0_paging_bits);
+    expects((cr4_guest_host_mask::get() & soft_tlb_cr4_paging_bits) == soft_tlb_cr4_paging_bits);
 
-    add_handler(
-        exit_reason::basic_exit_reason::wrmsr,
-        handler_delegate_t::create<handle_wrmsr>()
-    );
+    m_soft_tlb_enabled = true;
 }
 
 void
-exit_handler::add_handler(
-    ::intel_x64::vmcs::value_type reason,
-    handler_delegate_t &&d)
-{ m_handlers.at(reason).push_front(std::move(d)); }
+exit_handler::disable_soft_tlb() noexcept
+{ m_soft_tlb_enabled = false; }
 
 void
 exit_handler::write_host_state()
@@ -485,6 +644,8 @@ exit_handler::write_control_state()
 {
     using namespace ::intel_x64::vmcs;
 
+    m_soft_tlb_enabled = false;
+
     auto ia32_vmx_pinbased_ctls_msr =
         ::intel_x64::msrs::ia32_vmx_true_pinbased_ctls::get();
     auto ia32_vmx_procbased_ctls_msr =
@@ -539,9 +700,16 @@ exit_handler::handle(
     bfvmm::intel_x64::exit_handler *exit_handler) noexcept
 {
     guard_exceptions([&]() {
-        const auto &handlers = exit_handler->m_handlers.at(
-            ::intel_x64::vmcs::exit_reason::basic_exit_reason::get()
-        );
+        bfvmm::x64::tlb_shootdown_drain();
+        bfvmm::DEFAULT_COM_DRIVER::instance()->drain();
+
+        auto reason = ::intel_x64::vmcs::exit_reason::basic_exit_reason::get();
+
+        count_exit();
+        trace_exit(exit_handler->m_vmcs, reason);
+        invalidate_soft_tlb(exit_handler->m_vmcs, reason, exit_handler->m_soft_tlb_enabled);
+
+        const auto &handlers = exit_handler->m_handlers.at(reason);
 
         for (const auto &d : handlers) {
             if (d(exit_handler->m_vmcs)) {
@@ -549,7 +717,7 @@ exit_handler::handle(
             }
         }
 
-        bfdebug_transaction(0, [&](std::string * msg) {
+        bfdebug_transaction(0, [&](bfdebug_msg_t * msg) {
             bferror_lnbr(0, msg);
             bferror_info(0, "unhandled exit reason", msg);
             bferror_brk1(0, msg);
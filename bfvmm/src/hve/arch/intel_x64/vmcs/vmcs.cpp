@@ -28,6 +28,9 @@
 
 #include <intrinsics.h>
 
+#undef BFDEBUG_SUBSYSTEM
+#define BFDEBUG_SUBSYSTEM BFDEBUG_SUBSYSTEM_VMCS
+
 // -----------------------------------------------------------------------------
 // Prototypes
 // -----------------------------------------------------------------------------
@@ -60,7 +63,7 @@ vmcs::vmcs(vcpuid::type vcpuid) :
 
     m_save_state->vcpuid = vcpuid;
 
-    bfdebug_transaction(1, [&](std::string * msg) {
+    bfdebug_transaction(1, [&](bfdebug_msg_t * msg) {
         bfdebug_pass(1, "vmcs region", msg);
         bfdebug_subnhex(1, "virt address", m_vmcs_region.get(), msg);
         bfdebug_subnhex(1, "phys address", m_vmcs_region_phys, msg);
@@ -114,5 +117,9 @@ void
 vmcs::load()
 { ::intel_x64::vm::load(&m_vmcs_region_phys); }
 
+void
+vmcs::clear()
+{ ::intel_x64::vm::clear(&m_vmcs_region_phys); }
+
 }
 }
@@ -109,7 +109,7 @@ vmx::check_ia32_vmx_cr0_fixed_msr()
         throw std::runtime_error("invalid cr0");
     }
 
-    bfdebug_transaction(1, [&](std::string * msg) {
+    bfdebug_transaction(1, [&](bfdebug_msg_t * msg) {
         bfdebug_pass(1, "check cr0 is valid", msg);
         bfdebug_subnhex(1, "cr0", cr0, msg);
         bfdebug_subnhex(1, "ia32_vmx_cr0_fixed0", ia32_vmx_cr0_fixed0, msg);
@@ -128,7 +128,7 @@ vmx::check_ia32_vmx_cr4_fixed_msr()
         throw std::runtime_error("invalid cr4");
     }
 
-    bfdebug_transaction(1, [&](std::string * msg) {
+    bfdebug_transaction(1, [&](bfdebug_msg_t * msg) {
         bfdebug_pass(1, "check cr4 is valid", msg);
         bfdebug_subnhex(1, "cr4", cr4, msg);
         bfdebug_subnhex(1, "ia32_vmx_cr4_fixed0", ia32_vmx_cr4_fixed0, msg);
@@ -147,7 +147,7 @@ vmx::check_ia32_feature_control_msr()
     ::intel_x64::msrs::ia32_feature_control::enable_vmx_outside_smx::enable();
     ::intel_x64::msrs::ia32_feature_control::lock_bit::enable();
 
-    bfdebug_transaction(1, [&](std::string * msg) {
+    bfdebug_transaction(1, [&](bfdebug_msg_t * msg) {
         bfdebug_pass(1, "vmx feature controls enable vmx outside smx enabled", msg);
         bfdebug_pass(1, "vmx feature controls lock bit enabled", msg);
     });
@@ -169,7 +169,7 @@ vmx::setup_vmx_region()
     gsl::span<uint32_t> id{m_vmx_region.get(), 1024};
     id[0] = gsl::narrow<uint32_t>(::intel_x64::msrs::ia32_vmx_basic::revision_id::get());
 
-    bfdebug_transaction(1, [&](std::string * msg) {
+    bfdebug_transaction(1, [&](bfdebug_msg_t * msg) {
         bfdebug_pass(1, "vmx region", msg);
         bfdebug_subnhex(1, "virt address", m_vmx_region.get(), msg);
         bfdebug_subnhex(1, "phys address", m_vmx_region_phys, msg);
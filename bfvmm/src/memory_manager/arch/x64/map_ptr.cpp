@@ -16,6 +16,8 @@
 // License along with this library; if not, write to the Free Software
 // Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
 
+#include <array>
+
 #include <memory_manager/arch/x64/map_ptr.h>
 #include <memory_manager/arch/x64/root_page_table.h>
 
@@ -40,35 +42,61 @@ WEAK_SYM map_with_cr3(
     expects(pml4_addr != 0);
     expects(size != 0);
 
-    for (auto offset = 0UL; offset < size; offset += ::x64::page_size) {
+    // Decoding the guest's PAT is done once per PAT index, instead of once
+    // per page. Note that entries are only decoded when they are used, as a
+    // guest is free to leave reserved memory types in unused entries.
+    //
+
+    std::array<::x64::memory_attr::attr_type, 8> attrs{};
+
+    auto pat_to_attr = [&](uintptr_t pati) {
+        auto &attr = attrs.at(pati);
+
+        if (attr == ::x64::memory_attr::invalid) {
+            attr = ::x64::memory_attr::mem_type_to_attr(
+                       ::x64::memory_attr::rw, ::x64::msrs::ia32_pat::pa(pat, pati)
+                   );
+        }
+
+        return attr;
+    };
+
+    // Each walk of the guest's page tables maps every page in the range
+    // that shares the same leaf page table (for 4k pages), or the same
+    // large page (for 2m / 1g pages), instead of walking the guest's page
+    // tables for each page.
+    //
+
+    auto offset = 0UL;
+
+    while (offset < size) {
         uintptr_t from;
-        uintptr_t phys;
-        uintptr_t pati;
         uintptr_t current_virt = virt + offset;
 
-        while (true) {
-            from = ::x64::page_table::pml4::from;
-            auto pml4_idx = ::x64::page_table::index(current_virt, from);
-            auto pml4_map = bfvmm::x64::make_unique_map<uintptr_t>(pml4_addr);
-            auto pml4_pte = bfvmm::x64::page_table_entry{&pml4_map.get()[pml4_idx]};
+        from = ::x64::page_table::pml4::from;
+        auto pml4_idx = ::x64::page_table::index(current_virt, from);
+        auto pml4_map = bfvmm::x64::make_unique_map<uintptr_t>(pml4_addr);
+        auto pml4_pte = bfvmm::x64::page_table_entry{&pml4_map.get()[pml4_idx]};
 
-            expects(pml4_pte.present());
-            expects(pml4_pte.phys_addr() != 0);
+        expects(pml4_pte.present());
+        expects(pml4_pte.phys_addr() != 0);
 
-            from = ::x64::page_table::pdpt::from;
-            auto pdpt_idx = ::x64::page_table::index(current_virt, from);
-            auto pdpt_map = bfvmm::x64::make_unique_map<uintptr_t>(pml4_pte.phys_addr());
-            auto pdpt_pte = bfvmm::x64::page_table_entry{&pdpt_map.get()[pdpt_idx]};
+        from = ::x64::page_table::pdpt::from;
+        auto pdpt_idx = ::x64::page_table::index(current_virt, from);
+        auto pdpt_map = bfvmm::x64::make_unique_map<uintptr_t>(pml4_pte.phys_addr());
+        auto pdpt_pte = bfvmm::x64::page_table_entry{&pdpt_map.get()[pdpt_idx]};
 
-            expects(pdpt_pte.present());
-            expects(pdpt_pte.phys_addr() != 0);
+        expects(pdpt_pte.present());
+        expects(pdpt_pte.phys_addr() != 0);
 
-            if (pdpt_pte.ps()) {
-                phys = pdpt_pte.phys_addr();
-                pati = pdpt_pte.pat_index_large();
-                break;
-            }
+        uintptr_t phys = 0;
+        uintptr_t pati = 0;
 
+        if (pdpt_pte.ps()) {
+            phys = pdpt_pte.phys_addr();
+            pati = pdpt_pte.pat_index_large();
+        }
+        else {
             from = ::x64::page_table::pd::from;
             auto pd_idx = ::x64::page_table::index(current_virt, from);
             auto pd_map = bfvmm::x64::make_unique_map<uintptr_t>(pdpt_pte.phys_addr());
@@ -80,29 +108,33 @@ WEAK_SYM map_with_cr3(
             if (pd_pte.ps()) {
                 phys = pd_pte.phys_addr();
                 pati = pd_pte.pat_index_large();
-                break;
             }
+            else {
+                from = ::x64::page_table::pt::from;
+                auto pt_idx = ::x64::page_table::index(current_virt, from);
+                auto pt_map = bfvmm::x64::make_unique_map<uintptr_t>(pd_pte.phys_addr());
 
-            from = ::x64::page_table::pt::from;
-            auto pt_idx = ::x64::page_table::index(current_virt, from);
-            auto pt_map = bfvmm::x64::make_unique_map<uintptr_t>(pd_pte.phys_addr());
-            auto pt_pte = bfvmm::x64::page_table_entry{&pt_map.get()[pt_idx]};
+                for (; pt_idx < ::x64::page_table::num_entries && offset < size; pt_idx++) {
+                    auto pt_pte = bfvmm::x64::page_table_entry{&pt_map.get()[pt_idx]};
 
-            expects(pt_pte.present());
-            expects(pt_pte.phys_addr() != 0);
+                    expects(pt_pte.present());
+                    expects(pt_pte.phys_addr() != 0);
 
-            phys = pt_pte.phys_addr();
-            pati = pt_pte.pat_index_4k();
-            break;
-        }
+                    g_pt->map_4k(vmap + offset, pt_pte.phys_addr(), pat_to_attr(pt_pte.pat_index_4k()));
+                    offset += ::x64::page_size;
+                }
 
-        auto vadr = vmap + offset;
-        auto padr = bfn::upper(phys, from) | bfn::lower(current_virt, from);
+                continue;
+            }
+        }
 
-        auto perm = ::x64::memory_attr::rw;
-        auto type = ::x64::msrs::ia32_pat::pa(pat, pati);
+        auto attr = pat_to_attr(pati);
+        auto page_end = bfn::upper(current_virt, from) + (1ULL << from);
 
-        g_pt->map_4k(vadr, bfn::upper(padr), ::x64::memory_attr::mem_type_to_attr(perm, type));
+        for (; offset < size && virt + offset < page_end; offset += ::x64::page_size) {
+            auto padr = bfn::upper(phys, from) | bfn::lower(virt + offset, from);
+            g_pt->map_4k(vmap + offset, bfn::upper(padr), attr);
+        }
     }
 }
 
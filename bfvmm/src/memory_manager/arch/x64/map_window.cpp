@@ -0,0 +1,161 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include <array>
+#include <memory>
+
+#include <bfexception.h>
+#include <bfupperlower.h>
+#include <bfthreadcontext.h>
+
+#include <memory_manager/arch/x64/map_window.h>
+
+// -----------------------------------------------------------------------------
+// Global Memory
+// -----------------------------------------------------------------------------
+
+/// \cond
+
+std::array<std::unique_ptr<bfvmm::x64::map_window>, MAX_MAP_WINDOW_CPUS> g_map_windows;
+
+/// \endcond
+
+static_assert(MAP_WINDOW_SLOTS <= 64, "MAP_WINDOW_SLOTS must fit in a 64bit bitmap");
+
+// -----------------------------------------------------------------------------
+// Implementation
+// -----------------------------------------------------------------------------
+
+namespace bfvmm
+{
+namespace x64
+{
+
+map_window::map_window(integer_pointer base) :
+    m_base(base)
+{
+    expects(bfn::lower(base) == 0);
+
+    m_ptes.reserve(MAP_WINDOW_SLOTS);
+    for (auto slot = 0ULL; slot < MAP_WINDOW_SLOTS; slot++) {
+        m_ptes.push_back(g_pt->reserve_4k(m_base + (slot * ::x64::page_size)));
+    }
+}
+
+map_window::integer_pointer
+map_window::map(integer_pointer phys, attr_type attr) noexcept
+{
+    if (phys == 0 || bfn::lower(phys) != 0) {
+        return 0;
+    }
+
+    for (auto slot = 0ULL; slot < MAP_WINDOW_SLOTS; slot++) {
+        auto mask = 1ULL << slot;
+
+        if ((m_used.fetch_or(mask) & mask) != 0) {
+            continue;
+        }
+
+        auto virt = m_base + (slot * ::x64::page_size);
+
+        auto ret = guard_exceptions(MEMORY_MANAGER_FAILURE, [&]
+        { root_page_table::set_entry_4k(m_ptes.at(slot), phys, attr); });
+
+        if (ret != MEMORY_MANAGER_SUCCESS) {
+            m_used.fetch_and(~mask);
+            return 0;
+        }
+
+        ::x64::tlb::invlpg(virt);
+        return virt;
+    }
+
+    return 0;
+}
+
+void
+map_window::unmap(integer_pointer virt) noexcept
+{
+    if (!contains(virt)) {
+        return;
+    }
+
+    auto slot = (virt - m_base) >> ::x64::page_shift;
+    auto mask = 1ULL << slot;
+
+    m_ptes[slot].clear();
+    ::x64::tlb::invlpg(bfn::upper(virt));
+
+    m_used.fetch_and(~mask);
+}
+
+map_window *
+cpu_map_window() noexcept
+{
+    auto cpuid = thread_context_cpuid();
+
+    if (cpuid >= MAX_MAP_WINDOW_CPUS) {
+        return nullptr;
+    }
+
+    auto &window = g_map_windows[cpuid];
+
+    if (!window) {
+        guard_exceptions([&] {
+            window = std::make_unique<map_window>(
+                         MAP_WINDOW_START + (cpuid * map_window::size_bytes)
+                     );
+        });
+    }
+
+    return window.get();
+}
+
+uintptr_t
+map_window_4k(uintptr_t phys, ::x64::memory_attr::attr_type attr) noexcept
+{
+    if (auto window = cpu_map_window()) {
+        return window->map(phys, attr);
+    }
+
+    return 0;
+}
+
+bool
+unmap_window_4k(uintptr_t virt) noexcept
+{
+    if (virt < MAP_WINDOW_START) {
+        return false;
+    }
+
+    auto index = (virt - MAP_WINDOW_START) / map_window::size_bytes;
+
+    if (index >= MAX_MAP_WINDOW_CPUS) {
+        return false;
+    }
+
+    if (auto &window = g_map_windows[index]) {
+        window->unmap(virt);
+        return true;
+    }
+
+    return false;
+}
+
+}
+}
@@ -20,8 +20,12 @@
 #include <bfexception.h>
 
 #include <memory_manager/memory_manager.h>
+#include <memory_manager/arch/x64/tlb_shootdown.h>
 #include <memory_manager/arch/x64/root_page_table.h>
 
+#undef BFDEBUG_SUBSYSTEM
+#define BFDEBUG_SUBSYSTEM BFDEBUG_SUBSYSTEM_MEMORY_MANAGER
+
 // -----------------------------------------------------------------------------
 // Testing Seem
 // -----------------------------------------------------------------------------
@@ -65,6 +69,31 @@ root_page_table::unmap(integer_pointer virt) noexcept
     unmap_page(virt);
 }
 
+page_table_entry
+root_page_table::reserve_4k(integer_pointer virt)
+{
+    expects((virt & (::x64::page_table::pt::size_bytes - 1)) == 0);
+
+    std::lock_guard<std::mutex> guard(m_mutex);
+
+    auto entry = m_pt->add_page_4k(virt);
+    entry.clear();
+
+    return entry;
+}
+
+void
+root_page_table::set_entry_4k(
+    page_table_entry &entry, integer_pointer phys, attr_type attr)
+{
+    entry.clear();
+    entry.set_phys_addr(phys & ~(::x64::page_table::pt::size_bytes - 1));
+    entry.set_pat_index_4k(::x64::pat::mem_attr_to_pat_index(attr));
+
+    set_entry_perms(entry, attr);
+    entry.set_present(true);
+}
+
 void
 root_page_table::setup_identity_map_1g(
     integer_pointer saddr, integer_pointer eaddr)
@@ -111,6 +140,8 @@ root_page_table::unmap_identity_map_1g(
     for (auto virt = saddr; virt < eaddr; virt += ::x64::page_table::pdpt::size_bytes) {
         this->unmap(virt);
     }
+
+    tlb_shootdown(saddr, eaddr - saddr);
 }
 
 void
@@ -123,6 +154,8 @@ root_page_table::unmap_identity_map_2m(
     for (auto virt = saddr; virt < eaddr; virt += ::x64::page_table::pd::size_bytes) {
         this->unmap(virt);
     }
+
+    tlb_shootdown(saddr, eaddr - saddr);
 }
 
 void
@@ -135,6 +168,8 @@ root_page_table::unmap_identity_map_4k(
     for (auto virt = saddr; virt < eaddr; virt += ::x64::page_table::pt::size_bytes) {
         this->unmap(virt);
     }
+
+    tlb_shootdown(saddr, eaddr - saddr);
 }
 
 page_table_entry
@@ -205,6 +240,28 @@ root_page_table::map_page(integer_pointer virt, integer_pointer phys, attr_type
             break;
     }
 
+    set_entry_perms(entry, attr);
+
+    if (m_is_vmm) {
+        g_mm->add_md(virt, phys, attr);
+    }
+}
+
+void
+root_page_table::unmap_page(integer_pointer virt) noexcept
+{
+    guard_exceptions([&]
+    { m_pt->remove_page(virt); });
+
+    if (m_is_vmm) {
+        guard_exceptions([&]
+        { g_mm->remove_md(virt); });
+    }
+}
+
+void
+root_page_table::set_entry_perms(page_table_entry &entry, attr_type attr)
+{
     switch (attr) {
         case ::x64::memory_attr::rw_uc:
         case ::x64::memory_attr::rw_wc:
@@ -239,22 +296,6 @@ root_page_table::map_page(integer_pointer virt, integer_pointer phys, attr_type
         default:
             throw std::logic_error("unsupported memory permissions");
     }
-
-    if (m_is_vmm) {
-        g_mm->add_md(virt, phys, attr);
-    }
-}
-
-void
-root_page_table::unmap_page(integer_pointer virt) noexcept
-{
-    guard_exceptions([&]
-    { m_pt->remove_page(virt); });
-
-    if (m_is_vmm) {
-        guard_exceptions([&]
-        { g_mm->remove_md(virt); });
-    }
 }
 
 root_page_table *
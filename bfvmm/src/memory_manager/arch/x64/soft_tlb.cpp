@@ -0,0 +1,116 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include <bfupperlower.h>
+#include <bfthreadcontext.h>
+
+#include <intrinsics.h>
+#include <memory_manager/arch/x64/soft_tlb.h>
+
+// -----------------------------------------------------------------------------
+// Global Memory
+// -----------------------------------------------------------------------------
+
+/// \cond
+
+std::array<bfvmm::x64::soft_tlb, MAX_SOFT_TLB_CPUS> g_soft_tlbs;
+
+/// \endcond
+
+static_assert((SOFT_TLB_ENTRIES & (SOFT_TLB_ENTRIES - 1)) == 0, "SOFT_TLB_ENTRIES must be a power of 2");
+
+// -----------------------------------------------------------------------------
+// Implementation
+// -----------------------------------------------------------------------------
+
+namespace bfvmm
+{
+namespace x64
+{
+
+constexpr const std::array<uintptr_t, 3> g_page_froms = {{
+        ::x64::page_table::pt::from,
+        ::x64::page_table::pd::from,
+        ::x64::page_table::pdpt::from
+    }
+};
+
+inline auto
+soft_tlb_index(uintptr_t virt, uintptr_t from) noexcept
+{ return (virt >> from) & (SOFT_TLB_ENTRIES - 1); }
+
+soft_tlb::integer_pointer
+soft_tlb::lookup(integer_pointer virt, integer_pointer cr3) const noexcept
+{
+    for (const auto &from : g_page_froms) {
+        const auto &entry = m_entries[soft_tlb_index(virt, from)];
+
+        if (entry.gen != m_gen || entry.cr3 != cr3 || entry.from != from) {
+            continue;
+        }
+
+        if (entry.virt == bfn::upper(virt, from)) {
+            return entry.phys | bfn::lower(virt, from);
+        }
+    }
+
+    return 0;
+}
+
+soft_tlb::integer_pointer
+soft_tlb::insert(
+    integer_pointer virt, integer_pointer cr3,
+    integer_pointer phys, integer_pointer from) noexcept
+{
+    auto &entry = m_entries[soft_tlb_index(virt, from)];
+
+    entry.cr3 = cr3;
+    entry.virt = bfn::upper(virt, from);
+    entry.phys = bfn::upper(phys, from);
+    entry.from = from;
+    entry.gen = m_gen;
+
+    return entry.phys | bfn::lower(virt, from);
+}
+
+void
+soft_tlb::invalidate(integer_pointer virt) noexcept
+{
+    for (const auto &from : g_page_froms) {
+        auto &entry = m_entries[soft_tlb_index(virt, from)];
+
+        if (entry.from == from && entry.virt == bfn::upper(virt, from)) {
+            entry.gen = 0;
+        }
+    }
+}
+
+soft_tlb *
+cpu_soft_tlb() noexcept
+{
+    auto cpuid = thread_context_cpuid();
+
+    if (cpuid >= MAX_SOFT_TLB_CPUS) {
+        return nullptr;
+    }
+
+    return &g_soft_tlbs[cpuid];
+}
+
+}
+}
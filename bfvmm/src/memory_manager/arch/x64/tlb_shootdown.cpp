@@ -0,0 +1,151 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include <array>
+#include <mutex>
+#include <atomic>
+
+#include <bfupperlower.h>
+#include <bfthreadcontext.h>
+
+#include <intrinsics.h>
+#include <memory_manager/arch/x64/tlb_shootdown.h>
+
+// -----------------------------------------------------------------------------
+// Global Memory
+// -----------------------------------------------------------------------------
+
+/// \cond
+
+struct shootdown_t {
+    std::atomic<uintptr_t> virt;
+    std::atomic<std::size_t> size;
+};
+
+std::array<shootdown_t, TLB_SHOOTDOWN_QUEUE_SIZE> g_shootdown_queue;
+std::array<uint64_t, MAX_TLB_SHOOTDOWN_CPUS> g_shootdown_tail = {};
+
+std::atomic<uint64_t> g_shootdown_head{0};
+
+/// \endcond
+
+// -----------------------------------------------------------------------------
+// Mutexes
+// -----------------------------------------------------------------------------
+
+std::mutex g_shootdown_mutex;
+
+// -----------------------------------------------------------------------------
+// Implementation
+// -----------------------------------------------------------------------------
+
+namespace bfvmm
+{
+namespace x64
+{
+
+static void
+flush_all() noexcept
+{ ::intel_x64::cr3::set(::intel_x64::cr3::get()); }
+
+static bool
+flush_range(uintptr_t virt, std::size_t size) noexcept
+{
+    auto vmap = bfn::upper(virt);
+    auto pages = (bfn::lower(virt) + size + ::x64::page_size - 1) >> ::x64::page_shift;
+
+    if (pages > TLB_SHOOTDOWN_MAX_PAGES) {
+        return false;
+    }
+
+    for (auto i = 0ULL; i < pages; i++) {
+        ::x64::tlb::invlpg(vmap + (i * ::x64::page_size));
+    }
+
+    return true;
+}
+
+void
+tlb_shootdown(uintptr_t virt, std::size_t size) noexcept
+{
+    if (size == 0) {
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(g_shootdown_mutex);
+
+        auto head = g_shootdown_head.load();
+        auto &entry = g_shootdown_queue[head % TLB_SHOOTDOWN_QUEUE_SIZE];
+
+        entry.virt = virt;
+        entry.size = size;
+
+        g_shootdown_head = head + 1;
+    }
+
+    if (!flush_range(virt, size)) {
+        flush_all();
+    }
+}
+
+void
+tlb_shootdown_drain() noexcept
+{
+    auto head = g_shootdown_head.load();
+    auto cpuid = thread_context_cpuid();
+
+    if (cpuid >= MAX_TLB_SHOOTDOWN_CPUS) {
+        if (head != 0) {
+            flush_all();
+        }
+
+        return;
+    }
+
+    auto &tail = g_shootdown_tail[cpuid];
+
+    if (tail == head) {
+        return;
+    }
+
+    auto full_flush = (head - tail) >= TLB_SHOOTDOWN_QUEUE_SIZE;
+
+    for (auto i = tail; !full_flush && i < head; i++) {
+        const auto &entry = g_shootdown_queue[i % TLB_SHOOTDOWN_QUEUE_SIZE];
+        full_flush = !flush_range(entry.virt, entry.size);
+    }
+
+    // The queue is only locked by writers, which means an entry could have
+    // been overwritten while it was being read. If this might have happened,
+    // the entries that were read cannot be trusted.
+    //
+
+    if ((g_shootdown_head.load() - tail) >= TLB_SHOOTDOWN_QUEUE_SIZE) {
+        full_flush = true;
+    }
+
+    if (full_flush) {
+        flush_all();
+    }
+
+    tail = head;
+}
+
+}
+}
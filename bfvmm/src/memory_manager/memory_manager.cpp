@@ -25,6 +25,9 @@
 #include <memory_manager/arch/x64/map_ptr.h>
 #include <memory_manager/arch/x64/page_table.h>
 
+#undef BFDEBUG_SUBSYSTEM
+#define BFDEBUG_SUBSYSTEM BFDEBUG_SUBSYSTEM_MEMORY_MANAGER
+
 namespace bfvmm
 {
 
@@ -21,6 +21,9 @@
 
 #include <vcpu/vcpu.h>
 
+#undef BFDEBUG_SUBSYSTEM
+#define BFDEBUG_SUBSYSTEM BFDEBUG_SUBSYSTEM_VCPU
+
 namespace bfvmm
 {
 
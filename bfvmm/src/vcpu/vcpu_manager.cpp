@@ -82,6 +82,15 @@ vcpu_manager::hlt_vcpu(vcpuid::type vcpuid, bfobject *obj)
     }
 }
 
+bool
+vcpu_manager::vcpu_exists(vcpuid::type vcpuid)
+{
+    std::lock_guard<std::mutex> guard(g_vcpu_manager_mutex);
+
+    auto iter = m_vcpus.find(vcpuid);
+    return iter != m_vcpus.end() && iter->second != nullptr;
+}
+
 vcpu_manager::vcpu_manager() noexcept :
     m_vcpu_factory(std::make_unique<vcpu_factory>())
 { }
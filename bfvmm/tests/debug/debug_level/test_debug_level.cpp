@@ -0,0 +1,48 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+
+#include <catch/catch.hpp>
+
+#include <debug/debug_level/debug_level.h>
+
+TEST_CASE("set_debug_level: invalid subsystem")
+{
+    CHECK(set_debug_level(BFDEBUG_SUBSYSTEM_NUM, 1) == SET_DEBUG_LEVEL_FAILURE);
+    CHECK(g_bfdebug_levels[BFDEBUG_SUBSYSTEM_DEFAULT] == DEBUG_LEVEL);
+}
+
+TEST_CASE("set_debug_level: single subsystem")
+{
+    CHECK(set_debug_level(BFDEBUG_SUBSYSTEM_VMCS, 3) == SET_DEBUG_LEVEL_SUCCESS);
+    CHECK(g_bfdebug_levels[BFDEBUG_SUBSYSTEM_VMCS] == 3);
+    CHECK(g_bfdebug_levels[BFDEBUG_SUBSYSTEM_VCPU] == DEBUG_LEVEL);
+
+    CHECK(set_debug_level(BFDEBUG_SUBSYSTEM_VMCS, DEBUG_LEVEL) == SET_DEBUG_LEVEL_SUCCESS);
+}
+
+TEST_CASE("set_debug_level: all subsystems")
+{
+    CHECK(set_debug_level(BFDEBUG_SUBSYSTEM_ALL, 2) == SET_DEBUG_LEVEL_SUCCESS);
+
+    for (const auto &level : g_bfdebug_levels) {
+        CHECK(level == 2);
+    }
+
+    CHECK(set_debug_level(BFDEBUG_SUBSYSTEM_ALL, DEBUG_LEVEL) == SET_DEBUG_LEVEL_SUCCESS);
+}
@@ -55,8 +55,55 @@ TEST_CASE("debug_ring: constructor_out_of_memory")
         g_new_throws_bad_alloc = 0;
     });
 
-    g_new_throws_bad_alloc = sizeof(debug_ring_resources_t);
+    g_new_throws_bad_alloc =
+        (debug_ring_total_size(DEBUG_RING_SIZE) + MAX_PAGE_SIZE - 1) & ~(MAX_PAGE_SIZE - 1);
+
+    debug_ring dr(0);
+    CHECK(get_drr(0, &drr) == GET_DRR_FAILURE);
+}
+
+TEST_CASE("debug_ring: constructor_default_size")
+{
     debug_ring dr(0);
+    REQUIRE(get_drr(0, &drr) == GET_DRR_SUCCESS);
+
+    CHECK(drr->len == DEBUG_RING_SIZE);
+    CHECK(drr->tag1 == DEBUG_RING_TAG1);
+    CHECK(drr->tag2 == DEBUG_RING_TAG2);
+}
+
+TEST_CASE("debug_ring: constructor_custom_size")
+{
+    debug_ring dr(0, DEBUG_RING_MAX_SIZE);
+    REQUIRE(get_drr(0, &drr) == GET_DRR_SUCCESS);
+
+    CHECK(drr->len == DEBUG_RING_MAX_SIZE);
+}
+
+TEST_CASE("debug_ring: constructor_invalid_size")
+{
+    debug_ring dr(0, DEBUG_RING_SIZE + 1);
+    REQUIRE(get_drr(0, &drr) == GET_DRR_SUCCESS);
+
+    CHECK(drr->len == DEBUG_RING_SIZE);
+}
+
+TEST_CASE("write: write_to_small_dr")
+{
+    debug_ring dr(0, DEBUG_RING_MIN_SIZE);
+    get_drr(0, &drr);
+
+    auto small_wb = "012";
+
+    for (auto i = 0U; i < DEBUG_RING_MIN_SIZE; i++) {
+        dr.write(static_cast<const char *>(small_wb));
+    }
+
+    auto num = DEBUG_RING_MIN_SIZE / (strlen(static_cast<const char *>(small_wb)) + 1);
+    auto total = num * strlen(static_cast<const char *>(small_wb));
+
+    CHECK(drr->epos - drr->spos <= DEBUG_RING_MIN_SIZE);
+    CHECK(debug_ring_read(drr, static_cast<char *>(rb), DEBUG_RING_SIZE) == total);
 }
 
 TEST_CASE("debug_ring: write_out_of_memory")
@@ -128,6 +175,65 @@ TEST_CASE("write: write_one_small_string_to_dr")
     CHECK(debug_ring_read(drr, static_cast<char *>(rb), DEBUG_RING_SIZE) == 5);
 }
 
+TEST_CASE("write: write_stamped_string_to_dr")
+{
+    debug_ring dr(0);
+    get_drr(0, &drr);
+
+    auto stamped_wb = "\x01" "0123456789abcdef" "01234";
+
+    CHECK_NOTHROW(dr.write(static_cast<const char *>(stamped_wb)));
+    CHECK(debug_ring_read(drr, static_cast<char *>(rb), DEBUG_RING_SIZE) == 5);
+    CHECK(strcmp(static_cast<char *>(rb), "01234") == 0);
+}
+
+TEST_CASE("write: write_buffer_to_dr")
+{
+    debug_ring dr(0);
+    get_drr(0, &drr);
+
+    CHECK_NOTHROW(dr.write("0123456789", 5));
+    CHECK(debug_ring_read(drr, static_cast<char *>(rb), DEBUG_RING_SIZE) == 5);
+    CHECK(strcmp(static_cast<char *>(rb), "01234") == 0);
+}
+
+TEST_CASE("write: write_prefixed_string_to_dr")
+{
+    debug_ring dr(0);
+    get_drr(0, &drr);
+
+    auto stamp = "\x01" "0123456789abcdef";
+
+    CHECK_NOTHROW(dr.write(stamp, DEBUG_RING_STAMP_SIZE, "01234", 5));
+    CHECK(drr->epos == DEBUG_RING_STAMP_SIZE + 6);
+    CHECK(debug_ring_read(drr, static_cast<char *>(rb), DEBUG_RING_SIZE) == 5);
+    CHECK(strcmp(static_cast<char *>(rb), "01234") == 0);
+}
+
+TEST_CASE("write: write_prefixed_string_that_wraps")
+{
+    debug_ring dr(0);
+    get_drr(0, &drr);
+
+    init_wb(DEBUG_RING_SIZE - 10);
+    CHECK_NOTHROW(dr.write(static_cast<const char *>(wb)));
+
+    CHECK_NOTHROW(dr.write("0123456789", 10, "abcdefghij", 10));
+    CHECK(debug_ring_read(drr, static_cast<char *>(rb), DEBUG_RING_SIZE) == 20);
+    CHECK(strcmp(static_cast<char *>(rb), "0123456789abcdefghij") == 0);
+}
+
+TEST_CASE("write: write_prefixed_string_too_large")
+{
+    debug_ring dr(0);
+    get_drr(0, &drr);
+
+    init_wb(DEBUG_RING_SIZE - 10);
+
+    CHECK_NOTHROW(dr.write("0123456789", 10, static_cast<const char *>(wb), DEBUG_RING_SIZE - 10));
+    CHECK(debug_ring_read(drr, static_cast<char *>(rb), DEBUG_RING_SIZE) == 0);
+}
+
 TEST_CASE("write: fill_dr")
 {
     debug_ring dr(0);
@@ -173,6 +279,40 @@ TEST_CASE("write: overcommit_dr_more_than_once")
     CHECK(rb[0] == 'C');
 }
 
+TEST_CASE("write: wrap_dr")
+{
+    debug_ring dr(0);
+    get_drr(0, &drr);
+
+    init_wb(DEBUG_RING_SIZE - 10, 'A');
+    CHECK_NOTHROW(dr.write(static_cast<const char *>(wb)));
+
+    init_wb(20, 'B');
+    CHECK_NOTHROW(dr.write(static_cast<const char *>(wb)));
+
+    CHECK(debug_ring_read(drr, static_cast<char *>(rb), DEBUG_RING_SIZE) == 20);
+    CHECK(strcmp(static_cast<char *>(rb), static_cast<char *>(wb)) == 0);
+}
+
+TEST_CASE("write: wrap_only_terminator")
+{
+    debug_ring dr(0);
+    get_drr(0, &drr);
+
+    init_wb(DEBUG_RING_SIZE - 20, 'A');
+    CHECK_NOTHROW(dr.write(static_cast<const char *>(wb)));
+
+    init_wb(19, 'B');
+    CHECK_NOTHROW(dr.write(static_cast<const char *>(wb)));
+
+    init_wb(10, 'C');
+    CHECK_NOTHROW(dr.write(static_cast<const char *>(wb)));
+
+    CHECK(debug_ring_read(drr, static_cast<char *>(rb), DEBUG_RING_SIZE) == 29);
+    CHECK(rb[0] == 'B');
+    CHECK(rb[19] == 'C');
+}
+
 TEST_CASE("debug_ring_read: read_with_empty_dr")
 {
     debug_ring dr(0);
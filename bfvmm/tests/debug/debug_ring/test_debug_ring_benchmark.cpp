@@ -0,0 +1,63 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include <catch/catch.hpp>
+
+#include <iomanip>
+#include <bfbenchmark.h>
+#include <debug/debug_ring/debug_ring.h>
+
+using namespace bfvmm;
+
+constexpr const auto iterations = 0x10000ULL;
+
+static uint64_t
+benchmark_write(std::size_t size)
+{
+    debug_ring dr(0);
+    std::string str(size - 1, 'A');
+
+    auto cycles = benchmark_cycles([&] {
+        for (auto i = 0ULL; i < iterations; i++) {
+            dr.write(str);
+        }
+    });
+
+    auto bytes = static_cast<double>(iterations * size);
+
+    std::cout << std::setw(4) << size << " byte writes: "
+              << std::fixed << std::setprecision(3)
+              << bytes / static_cast<double>(cycles) << " bytes/cycle\n";
+
+    return cycles;
+}
+
+TEST_CASE("debug_ring benchmark: 64 byte writes")
+{
+    CHECK(benchmark_write(64) != 0);
+}
+
+TEST_CASE("debug_ring benchmark: 256 byte writes")
+{
+    CHECK(benchmark_write(256) != 0);
+}
+
+TEST_CASE("debug_ring benchmark: 4k byte writes")
+{
+    CHECK(benchmark_write(0x1000) != 0);
+}
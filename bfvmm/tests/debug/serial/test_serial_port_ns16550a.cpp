@@ -235,3 +235,109 @@ TEST_CASE("serial: write char buffer")
     auto serial = std::make_unique<serial_port_ns16550a>();
     serial->write("hello world", 12);
 }
+
+TEST_CASE("serial: write busy transmitter")
+{
+    g_ports[DEFAULT_COM_PORT + serial_ns16550a::line_status_reg] = 0x00;
+
+    auto serial = std::make_unique<serial_port_ns16550a>();
+    g_ports[DEFAULT_COM_PORT] = 0;
+
+    serial->write('c');
+    CHECK(g_ports[DEFAULT_COM_PORT] == 0);
+
+    g_ports[DEFAULT_COM_PORT + serial_ns16550a::line_status_reg] = 0xFF;
+
+    serial->drain();
+    CHECK(g_ports[DEFAULT_COM_PORT] == 'c');
+}
+
+TEST_CASE("serial: drain fills fifo")
+{
+    g_ports[DEFAULT_COM_PORT + serial_ns16550a::line_status_reg] = 0x00;
+
+    auto serial = std::make_unique<serial_port_ns16550a>();
+    serial->write("0123456789abcdefghij");
+
+    g_ports[DEFAULT_COM_PORT + serial_ns16550a::line_status_reg] = 0xFF;
+
+    serial->drain();
+    CHECK(g_ports[DEFAULT_COM_PORT] == 'f');
+
+    serial->drain();
+    CHECK(g_ports[DEFAULT_COM_PORT] == 'j');
+}
+
+TEST_CASE("serial: write drops oldest when full")
+{
+    g_ports[DEFAULT_COM_PORT + serial_ns16550a::line_status_reg] = 0x00;
+
+    auto serial = std::make_unique<serial_port_ns16550a>();
+
+    serial->write(std::string(serial_ns16550a::fifo_size, 'a'));
+    serial->write(std::string(SERIAL_TX_RING_SIZE - serial_ns16550a::fifo_size, 'b'));
+    serial->write(std::string(serial_ns16550a::fifo_size, 'c'));
+
+    g_ports[DEFAULT_COM_PORT + serial_ns16550a::line_status_reg] = 0xFF;
+
+    serial->drain();
+    CHECK(g_ports[DEFAULT_COM_PORT] == 'b');
+
+    for (auto i = 0ULL; i < SERIAL_TX_RING_SIZE; i += serial_ns16550a::fifo_size) {
+        serial->drain();
+    }
+
+    CHECK(g_ports[DEFAULT_COM_PORT] == 'c');
+}
+
+TEST_CASE("serial: flush")
+{
+    g_ports[DEFAULT_COM_PORT + serial_ns16550a::line_status_reg] = 0x00;
+
+    auto serial = std::make_unique<serial_port_ns16550a>();
+    serial->write("0123456789abcdefghijklmnopqrstuvwxyz");
+
+    g_ports[DEFAULT_COM_PORT + serial_ns16550a::line_status_reg] = 0xFF;
+
+    serial->flush();
+    CHECK(g_ports[DEFAULT_COM_PORT] == 'z');
+
+    g_ports[DEFAULT_COM_PORT] = 0;
+
+    serial->drain();
+    CHECK(g_ports[DEFAULT_COM_PORT] == 0);
+}
+
+TEST_CASE("serial: synchronous")
+{
+    g_ports[DEFAULT_COM_PORT + serial_ns16550a::line_status_reg] = 0xFF;
+
+    auto serial = std::make_unique<serial_port_ns16550a>();
+    g_ports[DEFAULT_COM_PORT] = 0;
+
+    serial->begin_synchronous();
+    serial->write("0123456789abcdefghijklmnopqrstuvwxyz");
+    CHECK(g_ports[DEFAULT_COM_PORT] == 'z');
+
+    g_ports[DEFAULT_COM_PORT] = 0;
+    serial->end_synchronous();
+    CHECK(g_ports[DEFAULT_COM_PORT] == 0);
+
+    g_ports[DEFAULT_COM_PORT + serial_ns16550a::line_status_reg] = 0x00;
+    serial->write("0123456789abcdefghijklmnopqrstuvwxyz");
+
+    g_ports[DEFAULT_COM_PORT + serial_ns16550a::line_status_reg] = 0xFF;
+    serial->drain();
+    CHECK(g_ports[DEFAULT_COM_PORT] == 'f');
+}
+
+TEST_CASE("serial: flush empty")
+{
+    g_ports[DEFAULT_COM_PORT + serial_ns16550a::line_status_reg] = 0x00;
+
+    auto serial = std::make_unique<serial_port_ns16550a>();
+    g_ports[DEFAULT_COM_PORT] = 0;
+
+    serial->flush();
+    CHECK(g_ports[DEFAULT_COM_PORT] == 0);
+}
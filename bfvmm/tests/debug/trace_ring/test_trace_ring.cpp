@@ -0,0 +1,117 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include <catch/catch.hpp>
+
+#include <bfgsl.h>
+#include <debug/trace_ring/trace_ring.h>
+
+using namespace bfvmm;
+
+uint64_t g_tsc = 0;
+uint64_t g_cpuid = 0;
+
+extern "C" uint64_t
+_read_tsc(void) noexcept
+{ return g_tsc++; }
+
+extern "C" uint64_t
+thread_context_cpuid(void)
+{ return g_cpuid; }
+
+trace_ring_resources_t *trr;
+trace_record_t records[TRACE_RING_SIZE];
+
+TEST_CASE("get_trr: invalid trr")
+{
+    CHECK(get_trr(0, nullptr) == GET_TRR_FAILURE);
+}
+
+TEST_CASE("get_trr: invalid cpuid")
+{
+    CHECK(get_trr(0x1000, &trr) == GET_TRR_FAILURE);
+}
+
+TEST_CASE("trace_ring: constructor / destructor")
+{
+    {
+        trace_ring tr(0x10);
+        CHECK(get_trr(0x10, &trr) == GET_TRR_SUCCESS);
+        CHECK(trr->epos == 0);
+    }
+
+    CHECK(get_trr(0x10, &trr) == GET_TRR_FAILURE);
+}
+
+TEST_CASE("trace_ring: write")
+{
+    trace_ring tr(0x10);
+    get_trr(0x10, &trr);
+
+    tr.set_vcpuid(42);
+    tr.write(TRACE_EVENT_USER, 1, 2, 3, 4);
+
+    CHECK(trace_ring_read(trr, static_cast<trace_record_t *>(records), TRACE_RING_SIZE) == 1);
+    CHECK(records[0].id == TRACE_EVENT_USER);
+    CHECK(records[0].vcpuid == 42);
+    CHECK(records[0].args[0] == 1);
+    CHECK(records[0].args[1] == 2);
+    CHECK(records[0].args[2] == 3);
+    CHECK(records[0].args[3] == 4);
+}
+
+TEST_CASE("trace_ring: overwrite oldest")
+{
+    trace_ring tr(0x10);
+    get_trr(0x10, &trr);
+
+    for (auto i = 0ULL; i < TRACE_RING_SIZE + 1; i++) {
+        tr.write(TRACE_EVENT_USER, i);
+    }
+
+    CHECK(trace_ring_read(trr, static_cast<trace_record_t *>(records), TRACE_RING_SIZE) == TRACE_RING_SIZE);
+    CHECK(records[0].args[0] == 1);
+    CHECK(records[TRACE_RING_SIZE - 1].args[0] == TRACE_RING_SIZE);
+}
+
+TEST_CASE("cpu_trace_ring: invalid cpuid")
+{
+    auto ___ = gsl::finally([&]
+    { g_cpuid = 0; });
+
+    g_cpuid = MAX_TRACE_RING_CPUS;
+    CHECK(cpu_trace_ring() == nullptr);
+}
+
+TEST_CASE("cpu_trace_ring: success")
+{
+    auto tr = cpu_trace_ring();
+
+    CHECK(tr != nullptr);
+    CHECK(tr == cpu_trace_ring());
+}
+
+TEST_CASE("trace: success")
+{
+    trace(TRACE_EVENT_USER, 42);
+
+    CHECK(get_trr(0, &trr) == GET_TRR_SUCCESS);
+    CHECK(trace_ring_read(trr, static_cast<trace_record_t *>(records), TRACE_RING_SIZE) == 1);
+    CHECK(records[0].args[0] == 42);
+    CHECK(records[0].vcpuid == vcpuid::invalid);
+}
@@ -75,6 +75,31 @@ TEST_CASE("exit_handler: construct / destruct")
     CHECK_NOTHROW(bfvmm::intel_x64::exit_handler{vmcs});
 }
 
+TEST_CASE("exit_handler: host pcid")
+{
+    MockRepository mocks;
+    auto &&vmcs = setup_vmcs(mocks, 0x0);
+    auto &&ehlr = bfvmm::intel_x64::exit_handler{vmcs};
+
+    bfignored(ehlr);
+
+    CHECK((::intel_x64::vmcs::host_cr3::get() & 0xFFFULL) == VMM_PCID);
+    CHECK(::intel_x64::vmcs::host_cr4::pcid_enable_bit::is_enabled());
+}
+
+TEST_CASE("exit_handler: deferred")
+{
+    MockRepository mocks;
+    auto &&vmcs = setup_vmcs(mocks, 0x0);
+    auto &&ehlr = bfvmm::intel_x64::exit_handler{vmcs, true};
+
+    ::intel_x64::vmcs::host_cr3::set(0);
+    CHECK_NOTHROW(ehlr.write_state());
+
+    CHECK((::intel_x64::vmcs::host_cr3::get() & 0xFFFULL) == VMM_PCID);
+    CHECK(::intel_x64::vmcs::host_cr4::pcid_enable_bit::is_enabled());
+}
+
 TEST_CASE("exit_handler: add_handler")
 {
     MockRepository mocks;
@@ -486,4 +511,249 @@ TEST_CASE("exit_handler: vm_exit_reason_wrmsr_default")
     CHECK(g_msrs[0x10] == 0x0000000A00000009);
 }
 
+auto
+setup_soft_tlb(bool trapping)
+{
+    using namespace ::intel_x64::vmcs::primary_processor_based_vm_execution_controls;
+
+    g_vmcs_fields[addr] = trapping ? (invlpg_exiting::mask | cr3_load_exiting::mask) : 0;
+    g_vmcs_fields[::intel_x64::vmcs::cr0_guest_host_mask::addr] = trapping ? 0xFFFFFFFFFFFFFFFF : 0;
+    g_vmcs_fields[::intel_x64::vmcs::cr4_guest_host_mask::addr] = trapping ? 0xFFFFFFFFFFFFFFFF : 0;
+
+    auto stlb = bfvmm::x64::cpu_soft_tlb();
+    stlb->set_vcpuid(g_save_state.vcpuid);
+    stlb->invalidate();
+
+    stlb->insert(0x10000, 0x20000, 0x30000, ::x64::page_table::pt::from);
+    stlb->insert(0x40000000, 0x20000, 0x80000000, ::x64::page_table::pdpt::from);
+
+    return stlb;
+}
+
+TEST_CASE("exit_handler: soft tlb lookup")
+{
+    auto stlb = setup_soft_tlb(true);
+
+    CHECK(stlb->lookup(0x10123, 0x20000) == 0x30123);
+    CHECK(stlb->lookup(0x10123, 0x21000) == 0);
+    CHECK(stlb->lookup(0x11123, 0x20000) == 0);
+    CHECK(stlb->lookup(0x40123456, 0x20000) == 0x80123456);
+}
+
+TEST_CASE("exit_handler: soft tlb not trapping")
+{
+    MockRepository mocks;
+    auto &&vmcs = setup_vmcs(mocks, ::intel_x64::vmcs::exit_reason::basic_exit_reason::cpuid);
+    auto &&ehlr = bfvmm::intel_x64::exit_handler{vmcs};
+    auto stlb = setup_soft_tlb(false);
+
+    CHECK_NOTHROW(ehlr.handle(&ehlr));
+    CHECK(stlb->lookup(0x10000, 0x20000) == 0);
+}
+
+TEST_CASE("exit_handler: soft tlb trapping but not enabled")
+{
+    MockRepository mocks;
+    auto &&vmcs = setup_vmcs(mocks, ::intel_x64::vmcs::exit_reason::basic_exit_reason::cpuid);
+    auto &&ehlr = bfvmm::intel_x64::exit_handler{vmcs};
+    auto stlb = setup_soft_tlb(true);
+
+    CHECK_NOTHROW(ehlr.handle(&ehlr));
+    CHECK(stlb->lookup(0x10000, 0x20000) == 0);
+}
+
+TEST_CASE("exit_handler: soft tlb enable not trapping")
+{
+    MockRepository mocks;
+    auto &&vmcs = setup_vmcs(mocks, ::intel_x64::vmcs::exit_reason::basic_exit_reason::cpuid);
+    auto &&ehlr = bfvmm::intel_x64::exit_handler{vmcs};
+    auto stlb = setup_soft_tlb(false);
+
+    CHECK_THROWS(ehlr.enable_soft_tlb());
+    CHECK_NOTHROW(ehlr.handle(&ehlr));
+    CHECK(stlb->lookup(0x10000, 0x20000) == 0);
+}
+
+TEST_CASE("exit_handler: soft tlb disabled")
+{
+    MockRepository mocks;
+    auto &&vmcs = setup_vmcs(mocks, ::intel_x64::vmcs::exit_reason::basic_exit_reason::cpuid);
+    auto &&ehlr = bfvmm::intel_x64::exit_handler{vmcs};
+    auto stlb = setup_soft_tlb(true);
+
+    ehlr.enable_soft_tlb();
+    ehlr.disable_soft_tlb();
+
+    CHECK_NOTHROW(ehlr.handle(&ehlr));
+    CHECK(stlb->lookup(0x10000, 0x20000) == 0);
+}
+
+TEST_CASE("exit_handler: soft tlb disabled by write state")
+{
+    MockRepository mocks;
+    auto &&vmcs = setup_vmcs(mocks, ::intel_x64::vmcs::exit_reason::basic_exit_reason::cpuid);
+    auto &&ehlr = bfvmm::intel_x64::exit_handler{vmcs};
+    auto stlb = setup_soft_tlb(true);
+
+    ehlr.enable_soft_tlb();
+    CHECK_NOTHROW(ehlr.write_state());
+
+    setup_soft_tlb(true);
+
+    CHECK_NOTHROW(ehlr.handle(&ehlr));
+    CHECK(stlb->lookup(0x10000, 0x20000) == 0);
+}
+
+TEST_CASE("exit_handler: soft tlb trapping")
+{
+    MockRepository mocks;
+    auto &&vmcs = setup_vmcs(mocks, ::intel_x64::vmcs::exit_reason::basic_exit_reason::cpuid);
+    auto &&ehlr = bfvmm::intel_x64::exit_handler{vmcs};
+    auto stlb = setup_soft_tlb(true);
+
+    ehlr.enable_soft_tlb();
+
+    CHECK_NOTHROW(ehlr.handle(&ehlr));
+    CHECK(stlb->lookup(0x10000, 0x20000) == 0x30000);
+}
+
+TEST_CASE("exit_handler: soft tlb mov to cr3")
+{
+    MockRepository mocks;
+    auto &&vmcs = setup_vmcs(mocks, ::intel_x64::vmcs::exit_reason::basic_exit_reason::control_register_accesses);
+    auto &&ehlr = bfvmm::intel_x64::exit_handler{vmcs};
+    auto stlb = setup_soft_tlb(true);
+
+    ehlr.enable_soft_tlb();
+
+    g_vmcs_fields[::intel_x64::vmcs::exit_qualification::addr] = 3;
+
+    CHECK_NOTHROW(ehlr.handle(&ehlr));
+    CHECK(stlb->lookup(0x10000, 0x20000) == 0);
+}
+
+TEST_CASE("exit_handler: soft tlb mov to cr0")
+{
+    MockRepository mocks;
+    auto &&vmcs = setup_vmcs(mocks, ::intel_x64::vmcs::exit_reason::basic_exit_reason::control_register_accesses);
+    auto &&ehlr = bfvmm::intel_x64::exit_handler{vmcs};
+    auto stlb = setup_soft_tlb(true);
+
+    ehlr.enable_soft_tlb();
+
+    g_vmcs_fields[::intel_x64::vmcs::exit_qualification::addr] = 0;
+
+    CHECK_NOTHROW(ehlr.handle(&ehlr));
+    CHECK(stlb->lookup(0x10000, 0x20000) == 0);
+}
+
+TEST_CASE("exit_handler: soft tlb mov to cr4")
+{
+    MockRepository mocks;
+    auto &&vmcs = setup_vmcs(mocks, ::intel_x64::vmcs::exit_reason::basic_exit_reason::control_register_accesses);
+    auto &&ehlr = bfvmm::intel_x64::exit_handler{vmcs};
+    auto stlb = setup_soft_tlb(true);
+
+    ehlr.enable_soft_tlb();
+
+    g_vmcs_fields[::intel_x64::vmcs::exit_qualification::addr] = 4;
+
+    CHECK_NOTHROW(ehlr.handle(&ehlr));
+    CHECK(stlb->lookup(0x10000, 0x20000) == 0);
+}
+
+TEST_CASE("exit_handler: soft tlb cr0 paging bits not trapping")
+{
+    MockRepository mocks;
+    auto &&vmcs = setup_vmcs(mocks, ::intel_x64::vmcs::exit_reason::basic_exit_reason::cpuid);
+    auto &&ehlr = bfvmm::intel_x64::exit_handler{vmcs};
+    auto stlb = setup_soft_tlb(true);
+
+    g_vmcs_fields[::intel_x64::vmcs::cr0_guest_host_mask::addr] = ::intel_x64::cr0::paging::mask;
+
+    CHECK_THROWS(ehlr.enable_soft_tlb());
+    CHECK_NOTHROW(ehlr.handle(&ehlr));
+    CHECK(stlb->lookup(0x10000, 0x20000) == 0);
+}
+
+TEST_CASE("exit_handler: soft tlb cr4 paging bits not trapping")
+{
+    MockRepository mocks;
+    auto &&vmcs = setup_vmcs(mocks, ::intel_x64::vmcs::exit_reason::basic_exit_reason::cpuid);
+    auto &&ehlr = bfvmm::intel_x64::exit_handler{vmcs};
+    auto stlb = setup_soft_tlb(true);
+
+    g_vmcs_fields[::intel_x64::vmcs::cr4_guest_host_mask::addr] = ::intel_x64::cr4::page_global_enable::mask;
+
+    CHECK_THROWS(ehlr.enable_soft_tlb());
+    CHECK_NOTHROW(ehlr.handle(&ehlr));
+    CHECK(stlb->lookup(0x10000, 0x20000) == 0);
+}
+
+TEST_CASE("exit_handler: soft tlb mov from cr3")
+{
+    MockRepository mocks;
+    auto &&vmcs = setup_vmcs(mocks, ::intel_x64::vmcs::exit_reason::basic_exit_reason::control_register_accesses);
+    auto &&ehlr = bfvmm::intel_x64::exit_handler{vmcs};
+    auto stlb = setup_soft_tlb(true);
+
+    ehlr.enable_soft_tlb();
+
+    g_vmcs_fields[::intel_x64::vmcs::exit_qualification::addr] = 0x13;
+
+    CHECK_NOTHROW(ehlr.handle(&ehlr));
+    CHECK(stlb->lookup(0x10000, 0x20000) == 0x30000);
+}
+
+TEST_CASE("exit_handler: soft tlb invlpg")
+{
+    MockRepository mocks;
+    auto &&vmcs = setup_vmcs(mocks, ::intel_x64::vmcs::exit_reason::basic_exit_reason::invlpg);
+    auto &&ehlr = bfvmm::intel_x64::exit_handler{vmcs};
+    auto stlb = setup_soft_tlb(true);
+
+    ehlr.enable_soft_tlb();
+
+    g_vmcs_fields[::intel_x64::vmcs::exit_qualification::addr] = 0x10000;
+
+    CHECK_NOTHROW(ehlr.handle(&ehlr));
+    CHECK(stlb->lookup(0x10000, 0x20000) == 0);
+    CHECK(stlb->lookup(0x40000000, 0x20000) == 0x80000000);
+}
+
+TEST_CASE("exit_handler: soft tlb invpcid")
+{
+    MockRepository mocks;
+    auto &&vmcs = setup_vmcs(mocks, ::intel_x64::vmcs::exit_reason::basic_exit_reason::invpcid);
+    auto &&ehlr = bfvmm::intel_x64::exit_handler{vmcs};
+    auto stlb = setup_soft_tlb(true);
+
+    ehlr.enable_soft_tlb();
+
+    CHECK_NOTHROW(ehlr.handle(&ehlr));
+    CHECK(stlb->lookup(0x40000000, 0x20000) == 0);
+}
+
+TEST_CASE("exit_handler: tlb shootdown drained on exit")
+{
+    MockRepository mocks;
+    auto &&vmcs = setup_vmcs(mocks, ::intel_x64::vmcs::exit_reason::basic_exit_reason::cpuid);
+    auto &&ehlr = bfvmm::intel_x64::exit_handler{vmcs};
+
+    CHECK_NOTHROW(ehlr.handle(&ehlr));
+
+    bfvmm::x64::tlb_shootdown(0x10000, 0x2000);
+    g_invlpgs.clear();
+
+    CHECK_NOTHROW(ehlr.handle(&ehlr));
+    REQUIRE(g_invlpgs.size() == 2);
+    CHECK(g_invlpgs[0] == 0x10000);
+    CHECK(g_invlpgs[1] == 0x11000);
+
+    g_invlpgs.clear();
+
+    CHECK_NOTHROW(ehlr.handle(&ehlr));
+    CHECK(g_invlpgs.empty());
+}
+
 #endif
@@ -87,6 +87,19 @@ TEST_CASE("vmcs: load failure")
     CHECK_THROWS(vmcs.load());
 }
 
+TEST_CASE("vmcs: clear failure")
+{
+    MockRepository mocks;
+    auto vmcs = setup_vmcs(mocks);
+
+    g_vmclear_fails = true;
+    auto ___ = gsl::finally([&] {
+        g_vmclear_fails = false;
+    });
+
+    CHECK_THROWS(vmcs.clear());
+}
+
 TEST_CASE("vmcs: promote failure")
 {
     MockRepository mocks;
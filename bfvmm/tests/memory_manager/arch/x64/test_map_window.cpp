@@ -0,0 +1,265 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include <catch/catch.hpp>
+#include <hippomocks.h>
+
+#include <array>
+#include <vector>
+#include <intrinsics.h>
+
+#include <memory_manager/arch/x64/map_window.h>
+
+using namespace bfvmm::x64;
+
+uint64_t g_cpuid = 0;
+std::vector<uintptr_t> g_invlpgs;
+
+// The page table entries of every window. The root page table is mocked,
+// and reserve_4k() hands out the entry of the virtual address it is given,
+// which allows the tests to check what each slot is mapped to.
+//
+
+std::array<uintptr_t, MAX_MAP_WINDOW_CPUS * MAP_WINDOW_SLOTS> g_ptes{};
+
+extern "C" void
+_invlpg(const void *virt) noexcept
+{ g_invlpgs.push_back(reinterpret_cast<uintptr_t>(virt)); }
+
+extern "C" uint64_t
+thread_context_cpuid(void)
+{ return g_cpuid; }
+
+#ifdef _HIPPOMOCKS__ENABLE_CFUNC_MOCKING_SUPPORT
+
+constexpr const auto phys = 0x0000000ABCDEF000ULL;
+constexpr const auto attr = ::x64::memory_attr::rw_wb;
+
+static page_table_entry
+reserve_4k(uintptr_t virt)
+{ return page_table_entry(&g_ptes.at((virt - MAP_WINDOW_START) >> ::x64::page_shift)); }
+
+static page_table_entry
+pte(uintptr_t virt)
+{ return reserve_4k(virt); }
+
+static void
+setup_pt(MockRepository &mocks)
+{
+    auto pt = mocks.Mock<root_page_table>();
+    mocks.OnCallFunc(root_pt).Return(pt);
+
+    mocks.OnCall(pt, root_page_table::reserve_4k).Do(reserve_4k);
+
+    g_cpuid = 0;
+    g_invlpgs.clear();
+}
+
+// The windows that are returned by cpu_map_window() are global, so a test
+// that uses them must give back every slot that it maps.
+//
+
+TEST_CASE("map_window: map")
+{
+    MockRepository mocks;
+    setup_pt(mocks);
+
+    map_window window(MAP_WINDOW_START);
+    auto virt = window.map(phys, attr);
+
+    CHECK(virt == MAP_WINDOW_START);
+    CHECK(window.contains(virt));
+    CHECK(pte(virt).present());
+    CHECK(pte(virt).phys_addr() == phys);
+
+    REQUIRE(g_invlpgs.size() == 1);
+    CHECK(g_invlpgs.at(0) == virt);
+
+    window.unmap(virt);
+}
+
+TEST_CASE("map_window: map invalid phys")
+{
+    MockRepository mocks;
+    setup_pt(mocks);
+
+    map_window window(MAP_WINDOW_START);
+
+    CHECK(window.map(0, attr) == 0);
+    CHECK(window.map(phys + 0x10, attr) == 0);
+    CHECK(g_invlpgs.empty());
+}
+
+TEST_CASE("map_window: unmap invalidates the entry")
+{
+    MockRepository mocks;
+    setup_pt(mocks);
+
+    map_window window(MAP_WINDOW_START);
+    auto virt = window.map(phys, attr);
+    g_invlpgs.clear();
+
+    window.unmap(virt + 0x10);
+
+    CHECK(g_ptes.at(0) == 0);
+    REQUIRE(g_invlpgs.size() == 1);
+    CHECK(g_invlpgs.at(0) == virt);
+}
+
+TEST_CASE("map_window: unmap releases the slot")
+{
+    MockRepository mocks;
+    setup_pt(mocks);
+
+    map_window window(MAP_WINDOW_START);
+
+    auto virt1 = window.map(phys, attr);
+    auto virt2 = window.map(phys, attr);
+    CHECK(virt2 == virt1 + ::x64::page_size);
+
+    window.unmap(virt1);
+    CHECK(window.map(phys, attr) == virt1);
+
+    window.unmap(virt1);
+    window.unmap(virt2);
+}
+
+TEST_CASE("map_window: unmap outside of the window")
+{
+    MockRepository mocks;
+    setup_pt(mocks);
+
+    map_window window(MAP_WINDOW_START);
+    auto virt = window.map(phys, attr);
+    g_invlpgs.clear();
+
+    window.unmap(MAP_WINDOW_START + map_window::size_bytes);
+
+    CHECK(pte(virt).present());
+    CHECK(g_invlpgs.empty());
+
+    window.unmap(virt);
+}
+
+TEST_CASE("map_window: window exhausted")
+{
+    MockRepository mocks;
+    setup_pt(mocks);
+
+    map_window window(MAP_WINDOW_START);
+    std::vector<uintptr_t> virts;
+
+    for (auto slot = 0ULL; slot < MAP_WINDOW_SLOTS; slot++) {
+        virts.push_back(window.map(phys + (slot * ::x64::page_size), attr));
+        CHECK(virts.back() == MAP_WINDOW_START + (slot * ::x64::page_size));
+    }
+
+    CHECK(window.map(phys, attr) == 0);
+
+    window.unmap(virts.at(1));
+    CHECK(window.map(phys, attr) == virts.at(1));
+
+    for (auto virt : virts) {
+        window.unmap(virt);
+    }
+}
+
+TEST_CASE("map_window_4k: each cpu has its own window")
+{
+    MockRepository mocks;
+    setup_pt(mocks);
+
+    g_cpuid = 0;
+    auto virt0 = map_window_4k(phys, attr);
+
+    g_cpuid = 1;
+    auto virt1 = map_window_4k(phys, attr);
+
+    REQUIRE(cpu_map_window() != nullptr);
+    CHECK(virt0 == MAP_WINDOW_START);
+    CHECK(virt1 == MAP_WINDOW_START + map_window::size_bytes);
+    CHECK(cpu_map_window()->contains(virt1));
+    CHECK_FALSE(cpu_map_window()->contains(virt0));
+
+    CHECK(unmap_window_4k(virt0));
+    CHECK(unmap_window_4k(virt1));
+}
+
+TEST_CASE("map_window_4k: full window does not affect other cpus")
+{
+    MockRepository mocks;
+    setup_pt(mocks);
+
+    std::vector<uintptr_t> virts;
+
+    for (auto slot = 0ULL; slot < MAP_WINDOW_SLOTS; slot++) {
+        virts.push_back(map_window_4k(phys, attr));
+    }
+
+    CHECK(map_window_4k(phys, attr) == 0);
+
+    g_cpuid = 1;
+    auto virt = map_window_4k(phys, attr);
+    CHECK(virt == MAP_WINDOW_START + map_window::size_bytes);
+    CHECK(unmap_window_4k(virt));
+
+    for (auto virt0 : virts) {
+        CHECK(unmap_window_4k(virt0));
+    }
+}
+
+TEST_CASE("map_window_4k: unmap from another cpu")
+{
+    MockRepository mocks;
+    setup_pt(mocks);
+
+    auto virt = map_window_4k(phys, attr);
+    g_invlpgs.clear();
+
+    g_cpuid = 1;
+    CHECK(unmap_window_4k(virt));
+    CHECK_FALSE(pte(virt).present());
+
+    g_cpuid = 0;
+    CHECK(map_window_4k(phys, attr) == virt);
+    CHECK(unmap_window_4k(virt));
+}
+
+TEST_CASE("map_window_4k: cpu without a window")
+{
+    MockRepository mocks;
+    setup_pt(mocks);
+
+    g_cpuid = MAX_MAP_WINDOW_CPUS;
+
+    CHECK(cpu_map_window() == nullptr);
+    CHECK(map_window_4k(phys, attr) == 0);
+}
+
+TEST_CASE("unmap_window_4k: not in a window")
+{
+    MockRepository mocks;
+    setup_pt(mocks);
+
+    CHECK_FALSE(unmap_window_4k(0));
+    CHECK_FALSE(unmap_window_4k(MAP_WINDOW_START - ::x64::page_size));
+    CHECK_FALSE(unmap_window_4k(MAP_WINDOW_START + (MAX_MAP_WINDOW_CPUS * map_window::size_bytes)));
+    CHECK_FALSE(unmap_window_4k(MAP_WINDOW_START + (2 * map_window::size_bytes)));
+}
+
+#endif
@@ -0,0 +1,245 @@
+//
+// Bareflank Hypervisor
+// Copyright (C) 2015 Assured Information Security, Inc.
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+
+#include <catch/catch.hpp>
+
+#include <vector>
+#include <intrinsics.h>
+
+#include <memory_manager/arch/x64/tlb_shootdown.h>
+
+using namespace bfvmm::x64;
+
+uint64_t g_cpuid = 0;
+uint64_t g_cr3 = 0;
+uint64_t g_full_flushes = 0;
+
+std::vector<uintptr_t> g_invlpgs;
+
+extern "C" void
+_invlpg(const void *virt) noexcept
+{ g_invlpgs.push_back(reinterpret_cast<uintptr_t>(virt)); }
+
+extern "C" uint64_t
+_read_cr3(void) noexcept
+{ return g_cr3; }
+
+extern "C" void
+_write_cr3(uint64_t val) noexcept
+{ g_cr3 = val; g_full_flushes++; }
+
+extern "C" uint64_t
+thread_context_cpuid(void)
+{ return g_cpuid; }
+
+// The queue is global, so each test starts by catching up the CPUs that it
+// uses, and then clears what the stubs have recorded.
+//
+
+static void
+reset(std::initializer_list<uint64_t> cpuids)
+{
+    for (auto cpuid : cpuids) {
+        g_cpuid = cpuid;
+        tlb_shootdown_drain();
+    }
+
+    g_cpuid = 0;
+    g_full_flushes = 0;
+    g_invlpgs.clear();
+}
+
+TEST_CASE("tlb_shootdown: empty range")
+{
+    reset({0, 1});
+
+    tlb_shootdown(0x10000, 0);
+    CHECK(g_invlpgs.empty());
+
+    g_cpuid = 1;
+    tlb_shootdown_drain();
+
+    CHECK(g_invlpgs.empty());
+    CHECK(g_full_flushes == 0);
+}
+
+TEST_CASE("tlb_shootdown: flushes the local tlb")
+{
+    reset({0});
+
+    tlb_shootdown(0x10000, 0x1000);
+
+    REQUIRE(g_invlpgs.size() == 1);
+    CHECK(g_invlpgs[0] == 0x10000);
+    CHECK(g_full_flushes == 0);
+}
+
+TEST_CASE("tlb_shootdown_drain: nothing published")
+{
+    reset({1});
+
+    g_cpuid = 1;
+    tlb_shootdown_drain();
+
+    CHECK(g_invlpgs.empty());
+    CHECK(g_full_flushes == 0);
+}
+
+TEST_CASE("tlb_shootdown_drain: drains in order")
+{
+    reset({0, 1});
+
+    tlb_shootdown(0x10000, 0x1000);
+    tlb_shootdown(0x30000, 0x1000);
+    tlb_shootdown(0x20000, 0x1000);
+    g_invlpgs.clear();
+
+    g_cpuid = 1;
+    tlb_shootdown_drain();
+
+    REQUIRE(g_invlpgs.size() == 3);
+    CHECK(g_invlpgs[0] == 0x10000);
+    CHECK(g_invlpgs[1] == 0x30000);
+    CHECK(g_invlpgs[2] == 0x20000);
+    CHECK(g_full_flushes == 0);
+
+    g_invlpgs.clear();
+    tlb_shootdown_drain();
+
+    CHECK(g_invlpgs.empty());
+}
+
+TEST_CASE("tlb_shootdown_drain: each cpu drains once")
+{
+    reset({0, 1, 2});
+
+    tlb_shootdown(0x10000, 0x1000);
+    g_invlpgs.clear();
+
+    g_cpuid = 1;
+    tlb_shootdown_drain();
+    tlb_shootdown_drain();
+
+    g_cpuid = 2;
+    tlb_shootdown_drain();
+    tlb_shootdown_drain();
+
+    REQUIRE(g_invlpgs.size() == 2);
+    CHECK(g_invlpgs[0] == 0x10000);
+    CHECK(g_invlpgs[1] == 0x10000);
+}
+
+TEST_CASE("tlb_shootdown_drain: a range is one entry")
+{
+    reset({0, 1});
+
+    tlb_shootdown(0x10000, 0x4000);
+    g_invlpgs.clear();
+
+    g_cpuid = 1;
+    tlb_shootdown_drain();
+
+    REQUIRE(g_invlpgs.size() == 4);
+    CHECK(g_invlpgs[0] == 0x10000);
+    CHECK(g_invlpgs[1] == 0x11000);
+    CHECK(g_invlpgs[2] == 0x12000);
+    CHECK(g_invlpgs[3] == 0x13000);
+    CHECK(g_full_flushes == 0);
+}
+
+TEST_CASE("tlb_shootdown_drain: unaligned range")
+{
+    reset({0, 1});
+
+    tlb_shootdown(0x10800, 0x1000);
+    g_invlpgs.clear();
+
+    g_cpuid = 1;
+    tlb_shootdown_drain();
+
+    REQUIRE(g_invlpgs.size() == 2);
+    CHECK(g_invlpgs[0] == 0x10000);
+    CHECK(g_invlpgs[1] == 0x11000);
+}
+
+TEST_CASE("tlb_shootdown_drain: large range flushes everything")
+{
+    reset({0, 1});
+
+    tlb_shootdown(0x10000, (TLB_SHOOTDOWN_MAX_PAGES + 1) * ::x64::page_size);
+
+    CHECK(g_invlpgs.empty());
+    CHECK(g_full_flushes == 1);
+
+    g_cpuid = 1;
+    tlb_shootdown_drain();
+
+    CHECK(g_invlpgs.empty());
+    CHECK(g_full_flushes == 2);
+}
+
+TEST_CASE("tlb_shootdown_drain: overflow flushes everything")
+{
+    reset({0, 1});
+
+    for (auto i = 0ULL; i < TLB_SHOOTDOWN_QUEUE_SIZE; i++) {
+        tlb_shootdown(0x10000 + (i * ::x64::page_size), 0x1000);
+    }
+
+    g_invlpgs.clear();
+
+    g_cpuid = 1;
+    tlb_shootdown_drain();
+
+    CHECK(g_invlpgs.empty());
+    CHECK(g_full_flushes == 1);
+
+    tlb_shootdown_drain();
+    CHECK(g_full_flushes == 1);
+}
+
+TEST_CASE("tlb_shootdown_drain: almost full")
+{
+    reset({0, 1});
+
+    for (auto i = 0ULL; i < TLB_SHOOTDOWN_QUEUE_SIZE - 1; i++) {
+        tlb_shootdown(0x10000 + (i * ::x64::page_size), 0x1000);
+    }
+
+    g_invlpgs.clear();
+
+    g_cpuid = 1;
+    tlb_shootdown_drain();
+
+    CHECK(g_invlpgs.size() == TLB_SHOOTDOWN_QUEUE_SIZE - 1);
+    CHECK(g_full_flushes == 0);
+}
+
+TEST_CASE("tlb_shootdown_drain: cpu without a tail")
+{
+    reset({0});
+
+    tlb_shootdown(0x10000, 0x1000);
+    g_invlpgs.clear();
+
+    g_cpuid = MAX_TLB_SHOOTDOWN_CPUS;
+    tlb_shootdown_drain();
+
+    CHECK(g_invlpgs.empty());
+    CHECK(g_full_flushes == 1);
+}
@@ -48,6 +48,8 @@ intel_x64::cr3::value_type g_cr3 = 0;
 intel_x64::cr4::value_type g_cr4 = 0;
 intel_x64::dr7::value_type g_dr7 = 0;
 
+std::vector<uintptr_t> g_invlpgs;
+
 uint16_t g_es;
 uint16_t g_cs;
 uint16_t g_ss;
@@ -83,6 +85,7 @@ alignas(0x1000) static char g_map[100];
 bool g_virt_to_phys_fails = false;
 bool g_phys_to_virt_fails = false;
 bool g_vmload_fails = false;
+bool g_vmclear_fails = false;
 bool g_vmlaunch_fails = false;
 bool g_vmxon_fails = false;
 bool g_vmxoff_fails = false;
@@ -111,6 +114,26 @@ extern "C" void
 _write_msr(uint32_t addr, uint64_t val) noexcept
 { g_msrs[addr] = val; }
 
+extern "C" uint64_t
+_read_tsc(void) noexcept
+{ return 0; }
+
+extern "C" uint8_t
+_inb(uint16_t port) noexcept
+{ bfignored(port); return 0; }
+
+extern "C" void
+_outb(uint16_t port, uint8_t val) noexcept
+{ bfignored(port); bfignored(val); }
+
+extern "C" uint32_t
+_ind(uint16_t port) noexcept
+{ bfignored(port); return 0; }
+
+extern "C" void
+_outd(uint16_t port, uint32_t val) noexcept
+{ bfignored(port); bfignored(val); }
+
 extern "C" uint64_t
 _read_cr0(void) noexcept
 { return g_cr0; }
@@ -239,7 +262,7 @@ _wbinvd() noexcept
 
 extern "C" void
 _invlpg(const void *addr) noexcept
-{ bfignored(addr); }
+{ g_invlpgs.push_back(reinterpret_cast<uintptr_t>(addr)); }
 
 extern "C" void
 _cpuid(void *eax, void *ebx, void *ecx, void *edx) noexcept
@@ -280,6 +303,10 @@ extern "C" bool
 _vmptrld(void *ptr) noexcept
 { (void)ptr; return !g_vmload_fails; }
 
+extern "C" bool
+_vmclear(void *ptr) noexcept
+{ (void)ptr; return !g_vmclear_fails; }
+
 extern "C" bool
 _vmlaunch_demote() noexcept
 { return !g_vmlaunch_fails; }
@@ -319,3 +319,34 @@ TEST_CASE("vcpu_manager: hlt_no_create")
     CHECK_NOTHROW(g_vcm->hlt_vcpu(0));
     g_vcm->delete_vcpu(0);
 }
+
+TEST_CASE("vcpu_manager: vcpu_exists")
+{
+    MockRepository mocks;
+    g_vcpu = setup_vcpu(mocks);
+
+    auto ___ = gsl::finally([&] {
+        g_vcpu = nullptr;
+    });
+
+    CHECK_FALSE(g_vcm->vcpu_exists(0));
+
+    g_vcm->create_vcpu(0);
+    CHECK(g_vcm->vcpu_exists(0));
+
+    g_vcm->delete_vcpu(0);
+    CHECK_FALSE(g_vcm->vcpu_exists(0));
+}
+
+TEST_CASE("vcpu_manager: vcpu_exists_no_create")
+{
+    MockRepository mocks;
+    g_vcpu = setup_vcpu(mocks);
+
+    auto ___ = gsl::finally([&] {
+        g_vcpu = nullptr;
+    });
+
+    CHECK_NOTHROW(g_vcm->run_vcpu(0));
+    CHECK_FALSE(g_vcm->vcpu_exists(0));
+}
@@ -436,6 +436,13 @@ add_config(
     DESCRIPTION "Build unit test components"
 )
 
+add_config(
+    CONFIG_NAME ENABLE_BUILD_BENCHMARK
+    CONFIG_TYPE BOOL
+    DEFAULT_VAL OFF
+    DESCRIPTION "Build benchmarks (not run with the unit tests)"
+)
+
 # ------------------------------------------------------------------------------
 # Developer Features
 # ------------------------------------------------------------------------------
@@ -1287,6 +1287,49 @@ function(do_test FILENAME)
     endif()
 endfunction(do_test)
 
+# ------------------------------------------------------------------------------
+# do_benchmark
+# ------------------------------------------------------------------------------
+
+# Do Benchmark
+#
+# Adds a benchmark. Benchmarks use the same test framework as the unit tests,
+# but are only built if ENABLE_BUILD_BENCHMARK is enabled, and are not run
+# as part of the unit tests. Instead, they are run by hand from the build
+# directory of the subproject that adds them.
+#
+# @param FILENAME the file name of the benchmark. Must start with "benchmark_"
+# @param DEFINES Additional definitions for the benchmark
+# @param DEPENDS Additional dependencies for the benchmark. "_static" is
+#     added for you
+# @param SOURCES The source files to use for the benchmark. If this is not
+#     defined, the file used is ${FILENAME}.cpp.
+#
+function(do_benchmark FILENAME)
+    set(multiVal DEFINES DEPENDS SOURCES)
+    cmake_parse_arguments(ARG "" "" "${multiVal}" ${ARGN})
+
+    if(NOT ENABLE_BUILD_BENCHMARK)
+        return()
+    endif()
+
+    set(DEPENDS "")
+    foreach(d ${ARG_DEPENDS})
+        list(APPEND DEPENDS "${d}_static")
+    endforeach(d)
+
+    if(NOT ARG_SOURCES)
+        set(ARG_SOURCES "${FILENAME}.cpp")
+    endif()
+
+    add_executable(${FILENAME} ${ARG_SOURCES})
+    target_link_libraries(${FILENAME} ${DEPENDS} test_catch)
+    target_compile_definitions(${FILENAME} PRIVATE ${ARG_DEFINES})
+    if(CYGWIN OR WIN32)
+        target_link_libraries(${FILENAME} setupapi)
+    endif()
+endfunction(do_benchmark)
+
 # ------------------------------------------------------------------------------
 # print_xxx
 # ------------------------------------------------------------------------------
@@ -24,6 +24,10 @@ if(ENABLE_BUILD_TEST AND NOT BUILD_SHARED_LIBS)
     invalid_config("BUILD_SHARED_LIBS must be enabled if ENABLE_BUILD_TEST is enabled")
 endif()
 
+if(ENABLE_BUILD_BENCHMARK AND NOT ENABLE_BUILD_TEST)
+    invalid_config("ENABLE_BUILD_TEST must be enabled if ENABLE_BUILD_BENCHMARK is enabled")
+endif()
+
 # ------------------------------------------------------------------------------
 # VMM build type
 # ------------------------------------------------------------------------------